@@ -454,4 +454,125 @@ describe('DeviceAI Module', () => {
       expect(result.relevantData.storage).toBeUndefined(); // Should not include storage
     });
   });
-});
\ No newline at end of file
+
+  describe('Memory Breakdown', () => {
+    it('should reject memory breakdown outside Windows', async () => {
+      await expect(DeviceAI.getMemoryBreakdown()).rejects.toThrow('only available on Windows');
+    });
+
+    it('should flag memory pressure from commit usage and hard faults', () => {
+      const tips = DeviceAI._generateFallbackPerformanceTips({
+        memory: { usedPercentage: 40 },
+        memoryPressure: { commitUsage: 95, hardFaultsPerSec: 0 }
+      });
+
+      expect(tips).toMatch(/memory pressure/);
+    });
+
+    it('should not include memory pressure without the native module', async () => {
+      AzureOpenAI.isConfigured.mockReturnValue(false);
+
+      const result = await DeviceAI.getPerformanceTips();
+
+      expect(result.success).toBe(true);
+      expect(result.performanceInfo.memoryPressure).toBeUndefined();
+    });
+  });
+
+  describe('Memory Pressure Events', () => {
+    it('should reject memory pressure subscriptions outside Windows', () => {
+      expect(() => DeviceAI.onMemoryPressure(() => {})).toThrow('only available on Windows');
+    });
+  });
+
+  describe('Trace Events', () => {
+    it('should reject trace events outside Windows', async () => {
+      expect(() => DeviceAI.setTracingEnabled(true)).toThrow('only available on Windows');
+      await expect(DeviceAI.getTraceEvents()).rejects.toThrow('only available on Windows');
+      await expect(DeviceAI.writeTraceFile('trace.json')).rejects.toThrow('only available on Windows');
+    });
+  });
+
+  describe('Latency Diagnostics', () => {
+    it('should require the native module for diagnostics', () => {
+      expect(() => DeviceAI.getDiagnostics()).toThrow('Native module required');
+    });
+  });
+
+  describe('Last-Known Values', () => {
+    it('should require the native module for fallback stats', () => {
+      expect(() => DeviceAI.getFallbackStats()).toThrow('Native module required');
+    });
+  });
+
+  describe('Collector Deadlines', () => {
+    it('should require the native module for collector stats', () => {
+      expect(() => DeviceAI.getCollectorStats()).toThrow('Native module required');
+    });
+
+    it('should reject budgeted Windows system info outside Windows', async () => {
+      await expect(DeviceAI.getWindowsSystemInfo({ budgetMs: 100 })).rejects.toThrow('only available on Windows');
+    });
+  });
+
+  describe('Request Coalescing', () => {
+    it('should reject coalescing configuration outside Windows', () => {
+      expect(() => DeviceAI.setCoalescingWindow(1000)).toThrow('only available on Windows');
+    });
+  });
+
+  describe('Process Profiling', () => {
+    it('should reject process profiling outside Windows', async () => {
+      await expect(DeviceAI.getProcessProfile()).rejects.toThrow('only available on Windows');
+    });
+
+    it('should reject process trend subscriptions outside Windows', () => {
+      expect(() => DeviceAI.onProcessTrend(() => {})).toThrow('only available on Windows');
+    });
+  });
+
+  describe('Background Sampling', () => {
+    it('should reject sampling outside Windows', () => {
+      expect(() => DeviceAI.startSampling()).toThrow('only available on Windows');
+    });
+
+    it('should require the native module for sampler diagnostics', () => {
+      expect(() => DeviceAI.getSamplerDiagnostics()).toThrow('Native module required');
+    });
+
+    it('should stop sampling safely when it was never started', () => {
+      expect(() => DeviceAI.stopSampling()).not.toThrow();
+    });
+
+    it('should reject metric history outside Windows', () => {
+      expect(() => DeviceAI.getMetricHistory({ metrics: ['cpu.usage'] })).toThrow('only available on Windows');
+    });
+
+    it('should reject metric queries outside Windows', () => {
+      expect(() => DeviceAI.queryMetrics({ metrics: ['cpu.usage'], aggregation: 'p95' })).toThrow('only available on Windows');
+    });
+
+    it('should reject anomaly detection outside Windows', () => {
+      expect(() => DeviceAI.onAnomaly(() => {})).toThrow('only available on Windows');
+      expect(() => DeviceAI.getAnomalies()).toThrow('only available on Windows');
+    });
+
+    it('should reject alert rules outside Windows', () => {
+      expect(() => DeviceAI.setAlertRules([{ id: 'hot', rule: 'cpu.usage > 90 for 30s' }])).toThrow('only available on Windows');
+      expect(() => DeviceAI.onAlert(() => {})).toThrow('only available on Windows');
+      expect(() => DeviceAI.getFiringAlerts()).toThrow('only available on Windows');
+    });
+
+    it('should expose the live snapshot installed by the native module', () => {
+      expect(DeviceAI.live).toBeNull();
+
+      const live = { sequence: 3, cpu: { usage: 12.5, state: 'live', stale: false } };
+      global.__deviceAiLive = live;
+      try {
+        expect(DeviceAI.live.cpu.usage).toBe(12.5);
+      } finally {
+        delete global.__deviceAiLive;
+      }
+    });
+  });
+});
@@ -0,0 +1,168 @@
+#include "AdaptiveSamplingPolicy.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ReactNativeDeviceAiCore {
+
+const char *ToString(PowerSource source) noexcept {
+  switch (source) {
+    case PowerSource::Ac:
+      return "ac";
+    case PowerSource::Battery:
+      return "battery";
+    default:
+      return "unknown";
+  }
+}
+
+const char *ToString(SamplingPolicyKind kind) noexcept {
+  switch (kind) {
+    case SamplingPolicyKind::Performance:
+      return "performance";
+    case SamplingPolicyKind::Balanced:
+      return "balanced";
+    case SamplingPolicyKind::EnergySaver:
+      return "energy-saver";
+    case SamplingPolicyKind::Background:
+      return "background";
+  }
+  return "unknown";
+}
+
+AdaptiveSamplingPolicy::AdaptiveSamplingPolicy(Clock const &clock, SamplingPolicyConfig const &config) noexcept
+    : m_clock(clock), m_config(config) {
+  m_baselineMs = BaselineFor(m_inputs);
+  m_intervalMs = m_baselineMs;
+}
+
+bool AdaptiveSamplingPolicy::SetInputs(SamplingInputs const &inputs) noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // The policy kind picks the tolerable delay, so a change of kind at the same
+  // baseline (say energy saver with a custom factor of 1) still re-arms the timer
+  auto kindChanged = KindFor(inputs) != KindFor(m_inputs);
+  m_inputs = inputs;
+  auto baseline = BaselineFor(inputs);
+  if (baseline == m_baselineMs) {
+    return kindChanged;
+  }
+
+  // A new context restarts adaptation from its own baseline rather than carrying
+  // over an interval that was tuned for different power conditions.
+  m_baselineMs = baseline;
+  m_intervalMs = baseline;
+  return true;
+}
+
+SamplingDecision AdaptiveSamplingPolicy::OnSample(double value) noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_wakeups[m_wakeupHead] = m_clock.NowMs();
+  m_wakeupHead = (m_wakeupHead + 1) % kWakeupHistory;
+  ++m_totalWakeups;
+
+  if (!std::isfinite(value)) {
+    return DecisionLocked();
+  }
+
+  if (m_samples == 0) {
+    m_mean = value;
+    m_variance = 0.0;
+  } else {
+    auto alpha = m_config.ewmaAlpha;
+    auto delta = value - m_mean;
+    m_mean += alpha * delta;
+    m_variance = (1.0 - alpha) * (m_variance + alpha * delta * delta);
+  }
+  ++m_samples;
+
+  if (m_samples > m_config.warmupSamples) {
+    auto stddev = std::sqrt(m_variance);
+    if (stddev >= m_config.volatileThreshold) {
+      m_intervalMs = ClampInterval(m_intervalMs * m_config.speedupStep);
+    } else if (stddev <= m_config.stableThreshold) {
+      m_intervalMs = ClampInterval(m_intervalMs * m_config.backoffStep);
+    }
+  }
+
+  return DecisionLocked();
+}
+
+SamplingDecision AdaptiveSamplingPolicy::Current() const noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return DecisionLocked();
+}
+
+SamplingDiagnostics AdaptiveSamplingPolicy::Diagnostics() const noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  SamplingDiagnostics diagnostics;
+  diagnostics.decision = DecisionLocked();
+  diagnostics.inputs = m_inputs;
+  diagnostics.volatility = std::sqrt(m_variance);
+  diagnostics.wakeupsPerMinute = WakeupsPerMinuteLocked();
+  diagnostics.totalWakeups = m_totalWakeups;
+  return diagnostics;
+}
+
+SamplingPolicyKind AdaptiveSamplingPolicy::KindFor(SamplingInputs const &inputs) const noexcept {
+  if (inputs.energySaver) {
+    return SamplingPolicyKind::EnergySaver;
+  }
+  if (!inputs.foreground) {
+    return SamplingPolicyKind::Background;
+  }
+  if (inputs.powerSource == PowerSource::Battery) {
+    return SamplingPolicyKind::Balanced;
+  }
+  return SamplingPolicyKind::Performance;
+}
+
+int64_t AdaptiveSamplingPolicy::BaselineFor(SamplingInputs const &inputs) const noexcept {
+  double interval = static_cast<double>(m_config.baseIntervalMs);
+  if (inputs.powerSource == PowerSource::Battery) {
+    interval *= m_config.batteryFactor;
+  }
+  if (inputs.energySaver) {
+    interval *= m_config.energySaverFactor;
+  }
+  if (!inputs.foreground) {
+    interval *= m_config.backgroundFactor;
+  }
+  return std::clamp(static_cast<int64_t>(interval), m_config.minIntervalMs, m_config.maxIntervalMs);
+}
+
+int64_t AdaptiveSamplingPolicy::ClampInterval(double intervalMs) const noexcept {
+  auto floor = std::max<double>(static_cast<double>(m_config.minIntervalMs), m_baselineMs / m_config.maxSpeedup);
+  auto ceiling = std::min<double>(static_cast<double>(m_config.maxIntervalMs), m_baselineMs * m_config.maxBackoff);
+  return static_cast<int64_t>(std::clamp(intervalMs, floor, ceiling));
+}
+
+SamplingDecision AdaptiveSamplingPolicy::DecisionLocked() const noexcept {
+  SamplingDecision decision;
+  decision.policy = KindFor(m_inputs);
+  decision.intervalMs = m_intervalMs;
+
+  auto fraction = decision.policy == SamplingPolicyKind::Performance ? m_config.tolerableDelayFraction
+                                                                     : m_config.savingTolerableDelayFraction;
+  decision.tolerableDelayMs = static_cast<int64_t>(m_intervalMs * fraction);
+  return decision;
+}
+
+double AdaptiveSamplingPolicy::WakeupsPerMinuteLocked() const noexcept {
+  auto now = m_clock.NowMs();
+  auto stored = std::min<uint64_t>(m_totalWakeups, kWakeupHistory);
+
+  uint64_t count = 0;
+  for (uint64_t i = 0; i < stored; ++i) {
+    auto index = (m_wakeupHead + kWakeupHistory - 1 - i) % kWakeupHistory;
+    if (now - m_wakeups[index] >= kWakeupWindowMs) {
+      break;
+    }
+    ++count;
+  }
+  return static_cast<double>(count);
+}
+
+} // namespace ReactNativeDeviceAiCore
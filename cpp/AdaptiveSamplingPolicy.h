@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Clock.h"
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+namespace ReactNativeDeviceAiCore {
+
+enum class PowerSource { Unknown, Ac, Battery };
+
+enum class SamplingPolicyKind { Performance, Balanced, EnergySaver, Background };
+
+const char *ToString(PowerSource source) noexcept;
+const char *ToString(SamplingPolicyKind kind) noexcept;
+
+// Environment the sampler is running in. Supplied by the platform layer from
+// power notifications and the JS AppState.
+struct SamplingInputs {
+  PowerSource powerSource = PowerSource::Unknown;
+  bool energySaver = false;
+  bool foreground = true;
+};
+
+struct SamplingPolicyConfig {
+  // Interval used in the foreground on AC power; every other context is a multiple of it.
+  int64_t baseIntervalMs = 1000;
+  int64_t minIntervalMs = 250;
+  int64_t maxIntervalMs = 5 * 60 * 1000;
+
+  double batteryFactor = 2.0;
+  double energySaverFactor = 4.0;
+  double backgroundFactor = 10.0;
+
+  // Volatility moves the interval within [baseline / maxSpeedup, baseline * maxBackoff].
+  double maxSpeedup = 4.0;
+  double maxBackoff = 8.0;
+  double speedupStep = 0.5;
+  double backoffStep = 1.25;
+
+  // Thresholds on the EWMA standard deviation of the sampled metric, in metric units.
+  double volatileThreshold = 5.0;
+  double stableThreshold = 1.0;
+  double ewmaAlpha = 0.2;
+  uint32_t warmupSamples = 3;
+
+  // Share of the interval the OS may delay a wakeup to coalesce it with other timers.
+  double tolerableDelayFraction = 0.1;
+  double savingTolerableDelayFraction = 0.5;
+};
+
+struct SamplingDecision {
+  SamplingPolicyKind policy = SamplingPolicyKind::Performance;
+  int64_t intervalMs = 0;
+  int64_t tolerableDelayMs = 0;
+};
+
+struct SamplingDiagnostics {
+  SamplingDecision decision;
+  SamplingInputs inputs;
+  double volatility = 0.0;
+  double wakeupsPerMinute = 0.0;
+  uint64_t totalWakeups = 0;
+};
+
+// Decides how often the background sampler wakes up. The platform layer owns the
+// timer; this class only turns power/app state and metric volatility into an
+// interval and a tolerable delay, so it can be exercised with a VirtualClock.
+class AdaptiveSamplingPolicy {
+public:
+  explicit AdaptiveSamplingPolicy(Clock const &clock, SamplingPolicyConfig const &config = {}) noexcept;
+
+  // Returns true when the change alters the policy kind or baseline and the timer should be re-armed.
+  bool SetInputs(SamplingInputs const &inputs) noexcept;
+
+  // Records a wakeup carrying the latest value of the tracked metric and returns the next decision.
+  SamplingDecision OnSample(double value) noexcept;
+
+  SamplingDecision Current() const noexcept;
+  SamplingDiagnostics Diagnostics() const noexcept;
+
+private:
+  static constexpr size_t kWakeupHistory = 512;
+  static constexpr int64_t kWakeupWindowMs = 60 * 1000;
+
+  SamplingPolicyKind KindFor(SamplingInputs const &inputs) const noexcept;
+  int64_t BaselineFor(SamplingInputs const &inputs) const noexcept;
+  int64_t ClampInterval(double intervalMs) const noexcept;
+  SamplingDecision DecisionLocked() const noexcept;
+  double WakeupsPerMinuteLocked() const noexcept;
+
+  Clock const &m_clock;
+  SamplingPolicyConfig const m_config;
+
+  mutable std::mutex m_mutex;
+  SamplingInputs m_inputs;
+  int64_t m_baselineMs;
+  int64_t m_intervalMs;
+
+  uint32_t m_samples = 0;
+  double m_mean = 0.0;
+  double m_variance = 0.0;
+
+  std::array<int64_t, kWakeupHistory> m_wakeups{};
+  size_t m_wakeupHead = 0;
+  uint64_t m_totalWakeups = 0;
+};
+
+} // namespace ReactNativeDeviceAiCore
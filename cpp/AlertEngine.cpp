@@ -0,0 +1,434 @@
+#include "AlertEngine.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+bool IsPercent(Metric metric) noexcept {
+  switch (metric) {
+    case Metric::BatteryLevel:
+    case Metric::CpuUsage:
+    case Metric::CounterCpuUsage:
+    case Metric::CounterMemoryUsage:
+    case Metric::CounterDiskUsage:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::optional<Metric> TotalOf(Metric metric) noexcept {
+  switch (metric) {
+    case Metric::MemoryAvailable:
+      return Metric::MemoryTotal;
+    case Metric::StorageAvailable:
+      return Metric::StorageTotal;
+    default:
+      return std::nullopt;
+  }
+}
+
+class RuleScanner {
+public:
+  explicit RuleScanner(std::string_view text) noexcept : m_text(text) {}
+
+  bool AtEnd() noexcept {
+    SkipSpace();
+    return m_pos == m_text.size();
+  }
+
+  // Letters, digits, '_' and '.'
+  std::string_view Name() noexcept {
+    SkipSpace();
+    auto start = m_pos;
+    while (m_pos < m_text.size() && (std::isalnum(static_cast<unsigned char>(m_text[m_pos])) || m_text[m_pos] == '_' || m_text[m_pos] == '.')) {
+      ++m_pos;
+    }
+    return m_text.substr(start, m_pos - start);
+  }
+
+  std::optional<AlertComparison> Comparison() noexcept {
+    SkipSpace();
+    auto rest = m_text.substr(m_pos);
+    for (auto [token, comparison] : {std::pair{">=", AlertComparison::AtLeast}, std::pair{"<=", AlertComparison::AtMost},
+             std::pair{">", AlertComparison::Above}, std::pair{"<", AlertComparison::Below}}) {
+      if (rest.starts_with(token)) {
+        m_pos += std::string_view(token).size();
+        return comparison;
+      }
+    }
+    return std::nullopt;
+  }
+
+  // A number and the unit stuck to it
+  std::optional<std::pair<double, std::string_view>> Quantity() noexcept {
+    SkipSpace();
+    double number = 0.0;
+    auto [end, error] = std::from_chars(m_text.data() + m_pos, m_text.data() + m_text.size(), number);
+    if (error != std::errc() || !std::isfinite(number)) {
+      return std::nullopt;
+    }
+    m_pos = static_cast<size_t>(end - m_text.data());
+    auto start = m_pos;
+    while (m_pos < m_text.size() && !std::isspace(static_cast<unsigned char>(m_text[m_pos]))) {
+      ++m_pos;
+    }
+    return std::pair{number, m_text.substr(start, m_pos - start)};
+  }
+
+  std::string_view Rest() noexcept {
+    SkipSpace();
+    return m_text.substr(m_pos);
+  }
+
+private:
+  void SkipSpace() noexcept {
+    while (m_pos < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_pos]))) {
+      ++m_pos;
+    }
+  }
+
+  std::string_view m_text;
+  size_t m_pos = 0;
+};
+
+std::optional<int64_t> Duration(RuleScanner &scanner) noexcept {
+  auto quantity = scanner.Quantity();
+  if (!quantity || quantity->first < 0) {
+    return std::nullopt;
+  }
+  auto [number, unit] = *quantity;
+  double scale = 0.0;
+  if (unit == "ms") {
+    scale = 1.0;
+  } else if (unit == "s") {
+    scale = 1000.0;
+  } else if (unit == "m" || unit == "min") {
+    scale = 60.0 * 1000.0;
+  } else if (unit == "h") {
+    scale = 60.0 * 60.0 * 1000.0;
+  } else {
+    return std::nullopt;
+  }
+  return static_cast<int64_t>(number * scale);
+}
+
+// A threshold in the metric's own units, per second for rates. An empty unit
+// takes the one given before, if any.
+std::optional<double> Threshold(RuleScanner &scanner, AlertRule &rule, std::string_view &unit, std::string &error) {
+  auto quantity = scanner.Quantity();
+  if (!quantity) {
+    error = "expected a number";
+    return std::nullopt;
+  }
+  auto number = quantity->first;
+  if (!quantity->second.empty()) {
+    unit = quantity->second;
+  }
+
+  auto slash = unit.find('/');
+  auto amount = unit.substr(0, slash);
+  auto per = slash == std::string_view::npos ? std::string_view() : unit.substr(slash + 1);
+
+  double multiplier = 1.0;
+  bool percent = false;
+  if (amount == "%") {
+    percent = true;
+  } else if (amount == "KB") {
+    multiplier = 1024.0;
+  } else if (amount == "MB") {
+    multiplier = 1024.0 * 1024.0;
+  } else if (amount == "GB") {
+    multiplier = 1024.0 * 1024.0 * 1024.0;
+  } else if (!amount.empty()) {
+    error = "unknown unit '" + std::string(amount) + "'";
+    return std::nullopt;
+  }
+
+  double seconds = 1.0;
+  if (slash != std::string_view::npos) {
+    if (rule.signal != AlertSignal::Rate) {
+      error = "'/" + std::string(per) + "' needs a rate, e.g. " + ToString(rule.metric) + ".rate";
+      return std::nullopt;
+    }
+    if (per == "min" || per == "m") {
+      seconds = 60.0;
+    } else if (per == "h") {
+      seconds = 60.0 * 60.0;
+    } else if (per != "s") {
+      error = "unknown time unit '" + std::string(per) + "'";
+      return std::nullopt;
+    }
+  }
+
+  if (percent && !IsPercent(rule.metric) && !TotalOf(rule.metric)) {
+    error = std::string("'%' needs a percentage or an availability metric, not ") + ToString(rule.metric);
+    return std::nullopt;
+  }
+  rule.percentOfTotal = percent && !IsPercent(rule.metric);
+  rule.unitScale = seconds / multiplier;
+  return number * multiplier / seconds;
+}
+
+} // namespace
+
+const char *ToString(AlertState state) noexcept {
+  switch (state) {
+    case AlertState::Ok:
+      return "ok";
+    case AlertState::Pending:
+      return "pending";
+    case AlertState::Firing:
+      return "firing";
+  }
+  return "unknown";
+}
+
+std::optional<AlertRule> ParseAlertRule(std::string_view text, std::string *error) {
+  std::string message;
+  auto fail = [&](std::string reason) -> std::optional<AlertRule> {
+    if (error) {
+      *error = std::move(reason);
+    }
+    return std::nullopt;
+  };
+
+  AlertRule rule;
+  RuleScanner scanner(text);
+
+  auto name = scanner.Name();
+  if (name == "battery.drainRate") {
+    rule.metric = Metric::BatteryLevel;
+    rule.signal = AlertSignal::Rate;
+    rule.negate = true;
+  } else {
+    if (name.ends_with(".rate")) {
+      name.remove_suffix(std::string_view(".rate").size());
+      rule.signal = AlertSignal::Rate;
+    }
+    auto metric = FindMetric(name);
+    if (!metric) {
+      return fail("unknown metric '" + std::string(name) + "'");
+    }
+    rule.metric = *metric;
+  }
+
+  auto comparison = scanner.Comparison();
+  if (!comparison) {
+    return fail("expected one of > >= < <= after the metric");
+  }
+  rule.comparison = *comparison;
+
+  std::string_view unit;
+  auto threshold = Threshold(scanner, rule, unit, message);
+  if (!threshold) {
+    return fail(message);
+  }
+  rule.threshold = *threshold;
+  rule.clearThreshold = *threshold;
+  bool percentOfTotal = rule.percentOfTotal;
+  auto unitScale = rule.unitScale;
+
+  while (!scanner.AtEnd()) {
+    auto keyword = scanner.Name();
+    if (keyword == "for" || keyword == "cooldown") {
+      auto duration = Duration(scanner);
+      if (!duration) {
+        return fail("expected a duration like 30s after '" + std::string(keyword) + "'");
+      }
+      (keyword == "for" ? rule.forMs : rule.cooldownMs) = *duration;
+    } else if (keyword == "clear") {
+      auto clear = Threshold(scanner, rule, unit, message);
+      if (!clear) {
+        return fail(message);
+      }
+      if (rule.percentOfTotal != percentOfTotal) {
+        return fail("the clear threshold must be in the same kind of unit as the threshold");
+      }
+      rule.clearThreshold = *clear;
+      // Values are reported in the threshold's units
+      rule.unitScale = unitScale;
+    } else {
+      return fail("unexpected '" + std::string(keyword.empty() ? scanner.Rest() : keyword) + "'");
+    }
+  }
+
+  bool above = rule.comparison == AlertComparison::Above || rule.comparison == AlertComparison::AtLeast;
+  if (above ? rule.clearThreshold > rule.threshold : rule.clearThreshold < rule.threshold) {
+    return fail("the clear threshold must be on the other side of the threshold");
+  }
+  return rule;
+}
+
+std::optional<std::string> AlertEngine::SetRules(std::vector<std::pair<std::string, std::string>> const &rules) {
+  std::vector<AlertRule> compiled;
+  compiled.reserve(rules.size());
+  std::unordered_map<std::string, size_t> ids;
+  for (auto const &[id, text] : rules) {
+    if (!ids.emplace(id, compiled.size()).second) {
+      return "duplicate rule id '" + id + "'";
+    }
+    std::string error;
+    auto rule = ParseAlertRule(text, &error);
+    if (!rule) {
+      return "rule '" + id + "': " + error;
+    }
+    compiled.push_back(*rule);
+  }
+
+  std::lock_guard lock(m_mutex);
+  std::unordered_map<std::string_view, size_t> previous;
+  for (size_t i = 0; i < m_ids.size(); ++i) {
+    previous.emplace(m_ids[i], i);
+  }
+
+  std::vector<Signal> signals;
+  std::vector<Compiled> hot;
+  std::vector<RuleState> states;
+  hot.reserve(compiled.size());
+  states.reserve(compiled.size());
+  for (size_t i = 0; i < compiled.size(); ++i) {
+    auto const &rule = compiled[i];
+    Signal signal{rule.metric, rule.signal, rule.percentOfTotal, rule.negate};
+    auto found = std::find(signals.begin(), signals.end(), signal);
+    if (found == signals.end()) {
+      found = signals.insert(signals.end(), signal);
+    }
+
+    bool above = rule.comparison == AlertComparison::Above || rule.comparison == AlertComparison::AtLeast;
+    double sign = above ? 1.0 : -1.0;
+    hot.push_back(Compiled{sign, sign * rule.threshold, sign * rule.clearThreshold, rule.forMs, rule.cooldownMs,
+        static_cast<uint32_t>(found - signals.begin()),
+        rule.comparison == AlertComparison::AtLeast || rule.comparison == AlertComparison::AtMost});
+
+    auto kept = previous.find(rules[i].first);
+    states.push_back(kept != previous.end() && m_texts[kept->second] == rules[i].second ? m_states[kept->second] : RuleState{});
+  }
+
+  m_signals = std::move(signals);
+  m_signalValues.assign(m_signals.size(), kNaN);
+  m_compiled = std::move(hot);
+  m_states = std::move(states);
+  m_rules = std::move(compiled);
+  m_ids.clear();
+  m_texts.clear();
+  for (auto const &[id, text] : rules) {
+    m_ids.push_back(id);
+    m_texts.push_back(text);
+  }
+  return std::nullopt;
+}
+
+std::vector<AlertEvent> AlertEngine::Evaluate(int64_t timeMs, std::span<double const, kMetricCount> values) {
+  std::lock_guard lock(m_mutex);
+
+  std::array<double, kMetricCount> percents;
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    percents[i] = kNaN;
+    if (auto total = TotalOf(static_cast<Metric>(i)); total && values[static_cast<size_t>(*total)] > 0) {
+      percents[i] = values[i] * 100.0 / values[static_cast<size_t>(*total)];
+    }
+  }
+
+  // Rates from the anchors as they were, then the anchors move on
+  for (size_t s = 0; s < m_signals.size(); ++s) {
+    auto const &signal = m_signals[s];
+    auto index = static_cast<size_t>(signal.metric);
+    auto value = signal.percentOfTotal ? percents[index] : values[index];
+    if (signal.signal == AlertSignal::Rate) {
+      auto const &anchor = m_anchors[index];
+      auto old = signal.percentOfTotal ? anchor.oldPercent : anchor.oldValue;
+      value = anchor.anchors == 2 && timeMs > anchor.oldMs ? (value - old) * 1000.0 / static_cast<double>(timeMs - anchor.oldMs) : kNaN;
+    }
+    m_signalValues[s] = signal.negate ? -value : value;
+  }
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    auto &anchor = m_anchors[i];
+    if (std::isnan(values[i])) {
+      continue;
+    }
+    if (anchor.anchors == 0 || timeMs - anchor.newMs >= kRateWindowMs / 2) {
+      anchor.oldMs = anchor.newMs;
+      anchor.oldValue = anchor.newValue;
+      anchor.oldPercent = anchor.newPercent;
+      anchor.newMs = timeMs;
+      anchor.newValue = values[i];
+      anchor.newPercent = percents[i];
+      anchor.anchors = static_cast<uint8_t>(std::min(anchor.anchors + 1, 2));
+    }
+  }
+
+  std::vector<AlertEvent> events;
+  for (size_t r = 0; r < m_compiled.size(); ++r) {
+    auto const &rule = m_compiled[r];
+    auto value = m_signalValues[rule.signal];
+    if (std::isnan(value)) {
+      continue;
+    }
+    auto &state = m_states[r];
+    state.value = value;
+    auto x = rule.sign * value;
+
+    if (state.state == AlertState::Firing) {
+      if (rule.inclusive ? x < rule.clear : x <= rule.clear) {
+        state.state = AlertState::Ok;
+        events.push_back(EventFor(r, AlertState::Ok, timeMs));
+      }
+      continue;
+    }
+    if (!(rule.inclusive ? x >= rule.fire : x > rule.fire)) {
+      state.state = AlertState::Ok;
+      continue;
+    }
+    if (state.state == AlertState::Ok) {
+      state.state = AlertState::Pending;
+      state.sinceMs = timeMs;
+    }
+    if (timeMs - state.sinceMs >= rule.forMs && (!state.fired || timeMs - state.firedMs >= rule.cooldownMs)) {
+      state.state = AlertState::Firing;
+      state.fired = true;
+      state.firedMs = timeMs;
+      events.push_back(EventFor(r, AlertState::Firing, timeMs));
+    }
+  }
+  return events;
+}
+
+std::vector<AlertEvent> AlertEngine::Firing() const {
+  std::lock_guard lock(m_mutex);
+  std::vector<AlertEvent> firing;
+  for (size_t r = 0; r < m_states.size(); ++r) {
+    if (m_states[r].state == AlertState::Firing) {
+      firing.push_back(EventFor(r, AlertState::Firing, m_states[r].firedMs));
+    }
+  }
+  return firing;
+}
+
+size_t AlertEngine::Rules() const {
+  std::lock_guard lock(m_mutex);
+  return m_compiled.size();
+}
+
+AlertEvent AlertEngine::EventFor(size_t rule, AlertState state, int64_t timeMs) const {
+  auto const &definition = m_rules[rule];
+  AlertEvent event;
+  event.id = m_ids[rule];
+  event.state = state;
+  event.value = m_states[rule].value * definition.unitScale;
+  event.threshold = definition.threshold * definition.unitScale;
+  event.sinceMs = m_states[rule].sinceMs;
+  event.timeMs = timeMs;
+  return event;
+}
+
+} // namespace ReactNativeDeviceAiCore
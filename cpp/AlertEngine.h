@@ -0,0 +1,159 @@
+#pragma once
+
+#include "DeviceSnapshot.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// What a rule compares: the metric itself, or its change per second over the
+// last few minutes
+enum class AlertSignal : uint8_t { Value, Rate };
+
+enum class AlertComparison : uint8_t { Above, AtLeast, Below, AtMost };
+
+enum class AlertState : uint8_t { Ok, Pending, Firing };
+
+const char *ToString(AlertState state) noexcept;
+
+// A threshold rule compiled from text:
+//
+//   <metric> <op> <number>[unit] [for <duration>] [clear <number>[unit]] [cooldown <duration>]
+//
+// metric is a history metric name, '<metric>.rate' for its change over time,
+// or 'battery.drainRate' for the battery level's fall over time. op is one of
+// > >= < <=. The unit is '%', 'KB', 'MB' or 'GB', optionally followed by
+// '/s', '/min' or '/h' for rates. '%' is the metric itself for percentages
+// (cpu.usage, battery.level, ...) and a share of the total for memory and
+// storage availability. Durations are a number with 'ms', 's', 'm' or 'h'.
+//
+//   cpu.usage > 90 for 30s clear 80
+//   storage.available < 5%
+//   battery.drainRate > 20%/h cooldown 10m
+//
+// The rule fires once the condition has held for the 'for' duration
+// (debounce), but not sooner than the cooldown after it last fired, and
+// resolves once the value is back past the clear threshold (hysteresis,
+// default the threshold itself).
+struct AlertRule {
+  Metric metric = Metric::CpuUsage;
+  AlertSignal signal = AlertSignal::Value;
+  // Memory and storage availability as a percentage of the total
+  bool percentOfTotal = false;
+  // The negated signal, for drain rates
+  bool negate = false;
+  AlertComparison comparison = AlertComparison::Above;
+  // In the metric's own units, per second for rates
+  double threshold = 0.0;
+  double clearThreshold = 0.0;
+  int64_t forMs = 0;
+  int64_t cooldownMs = 0;
+  // Factor from the metric's units to the ones the rule was written in, for
+  // reporting values back
+  double unitScale = 1.0;
+};
+
+// nullopt with a message in error when the text isn't a valid rule
+std::optional<AlertRule> ParseAlertRule(std::string_view text, std::string *error = nullptr);
+
+struct AlertEvent {
+  std::string id;
+  // Firing, or Ok when resolved
+  AlertState state = AlertState::Ok;
+  // In the rule's units
+  double value = 0.0;
+  double threshold = 0.0;
+  // When the condition started to hold
+  int64_t sinceMs = 0;
+  int64_t timeMs = 0;
+};
+
+// Evaluates a set of rules against each sampled MetricHistory row and reports
+// only the rules that started firing or resolved. Rules are compiled into a
+// flat array sharing one table of signals, so a tick computes each metric's
+// percentage or rate once and then costs a few comparisons per rule.
+// Thread-safe: rules are replaced from JS while the sampler evaluates.
+class AlertEngine {
+public:
+  // Rates are measured over a window between half of this and all of it.
+  // Coarse readings such as whole battery percents still make a rate step
+  // around its true value, which a clear threshold absorbs.
+  static constexpr int64_t kRateWindowMs = 10 * 60 * 1000;
+
+  // Replaces the rules, given as id and text pairs. A rule whose id and text
+  // are unchanged keeps its state, so re-registering doesn't fire it again.
+  // When a rule doesn't compile nothing changes and the message names it.
+  std::optional<std::string> SetRules(std::vector<std::pair<std::string, std::string>> const &rules);
+
+  std::vector<AlertEvent> Evaluate(int64_t timeMs, std::span<double const, kMetricCount> values);
+
+  // Rules currently firing, with their latest value
+  std::vector<AlertEvent> Firing() const;
+
+  size_t Rules() const;
+
+private:
+  struct Signal {
+    Metric metric;
+    AlertSignal signal;
+    bool percentOfTotal;
+    bool negate;
+
+    bool operator==(Signal const &) const = default;
+  };
+
+  // What a tick reads, with comparisons turned into 'x > fire' or 'x >= fire'
+  // on x = sign * value
+  struct Compiled {
+    double sign;
+    double fire;
+    double clear;
+    int64_t forMs;
+    int64_t cooldownMs;
+    uint32_t signal;
+    bool inclusive;
+  };
+
+  struct RuleState {
+    AlertState state = AlertState::Ok;
+    int64_t sinceMs = 0;
+    int64_t firedMs = 0;
+    bool fired = false;
+    double value = 0.0;
+  };
+
+  // Two anchors at least half a window apart; the rate runs from the older
+  struct RateAnchor {
+    int64_t oldMs = 0;
+    double oldValue = 0.0;
+    double oldPercent = 0.0;
+    int64_t newMs = 0;
+    double newValue = 0.0;
+    double newPercent = 0.0;
+    uint8_t anchors = 0;
+  };
+
+  AlertEvent EventFor(size_t rule, AlertState state, int64_t timeMs) const;
+
+  mutable std::mutex m_mutex;
+  std::vector<Signal> m_signals;
+  std::vector<double> m_signalValues;
+  std::vector<Compiled> m_compiled;
+  std::vector<RuleState> m_states;
+  // Cold per-rule data
+  std::vector<std::string> m_ids;
+  std::vector<std::string> m_texts;
+  std::vector<AlertRule> m_rules;
+  std::array<RateAnchor, kMetricCount> m_anchors{};
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,304 @@
+#include "AnomalyDetector.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+constexpr std::array kMethods{AnomalyMethod::Ewma, AnomalyMethod::Robust, AnomalyMethod::Seasonal};
+
+// MAD of a normal distribution in standard deviations
+constexpr double kMadScale = 0.6745;
+// Spread below which a change is a change no matter its size
+constexpr double kMinSpread = 1e-9;
+// Days of a slot before its baseline replaces the Ewma fallback; the second
+// gives the spread between days
+constexpr uint32_t kSeasonDays = 2;
+
+double Floor(AnomalyConfig const &config, double expected) noexcept {
+  return std::max(config.minRelativeDeviation * std::abs(expected), kMinSpread);
+}
+
+double Sign(double value) noexcept {
+  return static_cast<double>((value > 0.0) - (value < 0.0));
+}
+
+int64_t FloorDiv(int64_t value, int64_t divisor) noexcept {
+  auto quotient = value / divisor;
+  return quotient * divisor > value ? quotient - 1 : quotient;
+}
+
+// Period index and slot within it
+std::pair<int64_t, uint32_t> SlotOf(AnomalyConfig const &config, int64_t timeMs) noexcept {
+  auto periodMs = std::max<int64_t>(config.seasonPeriodMs, 1);
+  auto slots = std::max<uint32_t>(config.seasonSlots, 1);
+  auto period = FloorDiv(timeMs, periodMs);
+  auto offset = static_cast<double>(timeMs - period * periodMs) / static_cast<double>(periodMs);
+  return {period, std::min(static_cast<uint32_t>(offset * slots), slots - 1)};
+}
+
+} // namespace
+
+const char *ToString(AnomalyMethod method) noexcept {
+  switch (method) {
+    case AnomalyMethod::Ewma:
+      return "ewma";
+    case AnomalyMethod::Robust:
+      return "robust";
+    case AnomalyMethod::Seasonal:
+      return "seasonal";
+  }
+  return "unknown";
+}
+
+std::optional<AnomalyMethod> ParseAnomalyMethod(std::string_view name) noexcept {
+  for (auto method : kMethods) {
+    if (name == ToString(method)) {
+      return method;
+    }
+  }
+  return std::nullopt;
+}
+
+const char *ToString(AnomalySeverity severity) noexcept {
+  switch (severity) {
+    case AnomalySeverity::Warning:
+      return "warning";
+    case AnomalySeverity::Critical:
+      return "critical";
+  }
+  return "unknown";
+}
+
+const char *ToString(AnomalyPhase phase) noexcept {
+  switch (phase) {
+    case AnomalyPhase::Start:
+      return "start";
+    case AnomalyPhase::Escalate:
+      return "escalate";
+    case AnomalyPhase::End:
+      return "end";
+  }
+  return "unknown";
+}
+
+std::optional<AnomalyEvent> AnomalyDetector::Add(AnomalyConfig const &config, int64_t timeMs, double value) {
+  if (std::isnan(value)) {
+    return std::nullopt;
+  }
+
+  std::optional<AnomalyEvent> event;
+  if (auto baseline = Baseline(config, timeMs)) {
+    auto [expected, spread] = *baseline;
+    auto score = (value - expected) / std::max(spread, Floor(config, expected));
+    auto magnitude = std::abs(score);
+
+    if (!m_open) {
+      if (magnitude >= config.warningScore) {
+        auto severity = magnitude >= config.criticalScore ? AnomalySeverity::Critical : AnomalySeverity::Warning;
+        m_open = AnomalyEvent{0, AnomalyPhase::Start, severity, timeMs, timeMs, value, expected, score, score};
+        event = m_open;
+      }
+    } else {
+      m_open->timeMs = timeMs;
+      m_open->value = value;
+      m_open->expected = expected;
+      m_open->score = score;
+      if (magnitude > std::abs(m_open->peakScore)) {
+        m_open->peakScore = score;
+      }
+      if (magnitude < config.clearScore) {
+        event = m_open;
+        event->phase = AnomalyPhase::End;
+        m_open.reset();
+      } else if (m_open->severity == AnomalySeverity::Warning && magnitude >= config.criticalScore) {
+        m_open->severity = AnomalySeverity::Critical;
+        event = m_open;
+        event->phase = AnomalyPhase::Escalate;
+      }
+    }
+  }
+
+  Update(config, timeMs, value);
+  return event;
+}
+
+std::optional<AnomalyEvent> AnomalyDetector::Open() const noexcept {
+  return m_open;
+}
+
+std::optional<std::pair<double, double>> AnomalyDetector::Baseline(AnomalyConfig const &config, int64_t timeMs) const noexcept {
+  if (m_samples < std::max<uint32_t>(config.warmupSamples, 1)) {
+    return std::nullopt;
+  }
+  switch (config.method) {
+    case AnomalyMethod::Robust:
+      return std::pair{m_median, m_mad / kMadScale};
+    case AnomalyMethod::Seasonal:
+      if (m_season) {
+        auto const &slot = m_season->slots[SlotOf(config, timeMs).second];
+        if (slot.days >= kSeasonDays) {
+          return std::pair{slot.mean, std::sqrt(slot.variance)};
+        }
+      }
+      [[fallthrough]];
+    case AnomalyMethod::Ewma:
+      break;
+  }
+  return std::pair{m_mean, std::sqrt(m_variance)};
+}
+
+void AnomalyDetector::Update(AnomalyConfig const &config, int64_t timeMs, double value) {
+  if (config.method == AnomalyMethod::Seasonal) {
+    UpdateSeason(config, timeMs, value);
+  }
+
+  if (m_samples == 0) {
+    m_mean = value;
+    m_median = value;
+    m_samples = 1;
+    return;
+  }
+
+  auto alpha = config.alpha;
+  auto deviation = std::sqrt(m_variance);
+  auto diff = value - m_mean;
+  if (m_samples >= config.warmupSamples) {
+    auto limit = config.warningScore * std::max(deviation, Floor(config, m_mean));
+    diff = std::clamp(diff, -limit, limit);
+  }
+  auto increment = alpha * diff;
+  m_mean += increment;
+  m_variance = (1.0 - alpha) * (m_variance + diff * increment);
+
+  // Frugal streaming median and MAD: a fixed step towards the sample, so an
+  // outlier moves them no further than any other sample. The step scales with
+  // the spread, helped by the Ewma's while warming up; after that the Ewma's
+  // would grow with every burst of outliers.
+  auto scale = m_samples < config.warmupSamples ? std::max(m_mad, kMadScale * deviation) : m_mad;
+  auto step = alpha * std::max(scale, Floor(config, m_median));
+  m_median += step * Sign(value - m_median);
+  m_mad = std::max(m_mad + step * Sign(std::abs(value - m_median) - m_mad), 0.0);
+
+  if (m_samples < UINT32_MAX) {
+    ++m_samples;
+  }
+}
+
+void AnomalyDetector::UpdateSeason(AnomalyConfig const &config, int64_t timeMs, double value) {
+  auto [period, slot] = SlotOf(config, timeMs);
+  if (!m_season) {
+    m_season = std::make_unique<Season>();
+    m_season->slots.resize(std::max<uint32_t>(config.seasonSlots, 1));
+    m_season->period = period;
+    m_season->slot = slot;
+  }
+
+  auto &season = *m_season;
+  if (period != season.period || slot != season.slot) {
+    // The slot is done for this period: fold it into that slot's baseline.
+    // Its spread covers both the samples around their mean and that mean
+    // around the baseline, i.e. how far a sample strays from the baseline.
+    if (season.count > 0) {
+      auto &baseline = season.slots[season.slot];
+      auto variance = season.m2 / season.count;
+      if (baseline.days == 0) {
+        baseline.mean = season.mean;
+        baseline.variance = variance;
+      } else {
+        auto beta = config.seasonAlpha;
+        auto diff = season.mean - baseline.mean;
+        baseline.mean += beta * diff;
+        baseline.variance = (1.0 - beta) * baseline.variance + beta * (variance + diff * diff);
+      }
+      baseline.days = std::min(baseline.days, UINT32_MAX - 1) + 1;
+    }
+    season.period = period;
+    season.slot = slot;
+    season.count = 0;
+    season.mean = 0.0;
+    season.m2 = 0.0;
+  }
+
+  // Welford
+  ++season.count;
+  auto diff = value - season.mean;
+  season.mean += diff / season.count;
+  season.m2 += diff * (value - season.mean);
+}
+
+AnomalyMonitor::AnomalyMonitor(AnomalyConfig const &config, size_t maxSeries) : m_config(config), m_maxSeries(std::max<size_t>(maxSeries, 1)) {}
+
+std::optional<AnomalyEvent> AnomalyMonitor::Observe(uint64_t series, int64_t timeMs, double value) {
+  std::lock_guard lock(m_mutex);
+  return ObserveLocked(series, timeMs, value);
+}
+
+std::vector<AnomalyEvent> AnomalyMonitor::ObserveRow(int64_t timeMs, std::span<double const, kMetricCount> values) {
+  std::vector<AnomalyEvent> events;
+  std::lock_guard lock(m_mutex);
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    if (auto event = ObserveLocked(i, timeMs, values[i])) {
+      events.push_back(*event);
+    }
+  }
+  return events;
+}
+
+std::optional<AnomalyEvent> AnomalyMonitor::ObserveLocked(uint64_t series, int64_t timeMs, double value) {
+  if (auto found = m_index.find(series); found != m_index.end()) {
+    m_entries.splice(m_entries.begin(), m_entries, found->second);
+  } else if (m_index.size() >= m_maxSeries) {
+    // Reuse the least recently fed entry's node
+    m_index.erase(m_entries.back().series);
+    m_entries.splice(m_entries.begin(), m_entries, std::prev(m_entries.end()));
+    m_entries.front() = Entry{series, AnomalyDetector{}};
+    m_index.emplace(series, m_entries.begin());
+  } else {
+    m_entries.push_front(Entry{series, AnomalyDetector{}});
+    m_index.emplace(series, m_entries.begin());
+  }
+
+  auto event = m_entries.front().detector.Add(m_config, timeMs, value);
+  if (event) {
+    event->series = series;
+    m_events.push_back(*event);
+    if (m_events.size() > kEventLogCapacity) {
+      m_events.pop_front();
+    }
+  }
+  return event;
+}
+
+std::vector<AnomalyEvent> AnomalyMonitor::Events(int64_t sinceMs) const {
+  std::lock_guard lock(m_mutex);
+  std::vector<AnomalyEvent> events;
+  for (auto const &event : m_events) {
+    if (event.timeMs >= sinceMs) {
+      events.push_back(event);
+    }
+  }
+  return events;
+}
+
+std::vector<AnomalyEvent> AnomalyMonitor::Open() const {
+  std::lock_guard lock(m_mutex);
+  std::vector<AnomalyEvent> open;
+  for (auto const &entry : m_entries) {
+    if (auto event = entry.detector.Open()) {
+      event->series = entry.series;
+      open.push_back(*event);
+    }
+  }
+  return open;
+}
+
+size_t AnomalyMonitor::Series() const {
+  std::lock_guard lock(m_mutex);
+  return m_index.size();
+}
+
+} // namespace ReactNativeDeviceAiCore
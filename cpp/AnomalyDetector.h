@@ -0,0 +1,171 @@
+#pragma once
+
+#include "DeviceSnapshot.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// How a series' expected value and spread are estimated:
+//   Ewma      exponentially weighted mean and variance; score is the z-score
+//   Robust    streaming median and median absolute deviation, which a burst of
+//             outliers cannot drag along; score is the robust z-score
+//   Seasonal  a baseline per slot of the day, learned one day at a time, so a
+//             nightly backup is expected at night but not at noon. Falls back
+//             to Ewma for slots without a baseline yet.
+enum class AnomalyMethod { Ewma, Robust, Seasonal };
+
+const char *ToString(AnomalyMethod method) noexcept;
+std::optional<AnomalyMethod> ParseAnomalyMethod(std::string_view name) noexcept;
+
+enum class AnomalySeverity { Warning, Critical };
+
+const char *ToString(AnomalySeverity severity) noexcept;
+
+enum class AnomalyPhase { Start, Escalate, End };
+
+const char *ToString(AnomalyPhase phase) noexcept;
+
+struct AnomalyConfig {
+  AnomalyMethod method = AnomalyMethod::Ewma;
+  // Weight of each new sample in the running estimates
+  double alpha = 0.05;
+  // Samples before a series is scored
+  uint32_t warmupSamples = 30;
+  // An anomaly starts at |score| >= warningScore, escalates at criticalScore
+  // and ends once |score| drops below clearScore
+  double warningScore = 4.0;
+  double criticalScore = 8.0;
+  double clearScore = 2.0;
+  // Spread floor as a share of the expected value, so that a series that
+  // never moved isn't flagged for the smallest change
+  double minRelativeDeviation = 0.01;
+  // Seasonal: slots per period and how fast a slot's baseline follows new days
+  int64_t seasonPeriodMs = 24 * 60 * 60 * 1000;
+  uint32_t seasonSlots = 24;
+  double seasonAlpha = 0.3;
+};
+
+struct AnomalyEvent {
+  uint64_t series = 0;
+  AnomalyPhase phase = AnomalyPhase::Start;
+  AnomalySeverity severity = AnomalySeverity::Warning;
+  int64_t startMs = 0;
+  // The sample that caused the event
+  int64_t timeMs = 0;
+  double value = 0.0;
+  double expected = 0.0;
+  double score = 0.0;
+  // Largest |score| of the anomaly so far, signed
+  double peakScore = 0.0;
+};
+
+// Scores one series sample by sample in O(1) time and fixed memory, and turns
+// scores into anomaly episodes with a start, an optional escalation and an
+// end. The estimates are updated with each deviation clamped to warningScore
+// spreads, so one spike doesn't inflate the spread enough to hide the next,
+// while a lasting level shift is still learned and ends its anomaly. NaN
+// samples are skipped. The config is passed in rather than stored, so that
+// thousands of detectors share one.
+class AnomalyDetector {
+public:
+  // An event when this sample starts, escalates or ends an anomaly
+  std::optional<AnomalyEvent> Add(AnomalyConfig const &config, int64_t timeMs, double value);
+
+  // The anomaly in progress, as of its latest sample
+  std::optional<AnomalyEvent> Open() const noexcept;
+
+  uint32_t Samples() const noexcept {
+    return m_samples;
+  }
+
+private:
+  struct Slot {
+    double mean = 0.0;
+    double variance = 0.0;
+    uint32_t days = 0;
+  };
+
+  // Seasonal baseline, allocated only for that method
+  struct Season {
+    std::vector<Slot> slots;
+    // The slot being filled: which one, in which period, and its running
+    // mean and sum of squared deviations
+    int64_t period = 0;
+    uint32_t slot = 0;
+    uint32_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+  };
+
+  // Expected value and spread for the next sample; nullopt while warming up
+  std::optional<std::pair<double, double>> Baseline(AnomalyConfig const &config, int64_t timeMs) const noexcept;
+  void Update(AnomalyConfig const &config, int64_t timeMs, double value);
+  void UpdateSeason(AnomalyConfig const &config, int64_t timeMs, double value);
+
+  uint32_t m_samples = 0;
+  double m_mean = 0.0;
+  double m_variance = 0.0;
+  double m_median = 0.0;
+  double m_mad = 0.0;
+  std::unique_ptr<Season> m_season;
+
+  std::optional<AnomalyEvent> m_open;
+};
+
+// Detectors for any number of series under one config, keyed by caller-chosen
+// ids: metric rows use the Metric value, other series any id at or above
+// kMetricCount. At most maxSeries are kept; a new series evicts the one least
+// recently fed, anomaly in progress included. Events are kept in a bounded log
+// for later reads. Thread-safe: the sampler feeds it while JS reads.
+class AnomalyMonitor {
+public:
+  static constexpr size_t kDefaultMaxSeries = 4096;
+  static constexpr size_t kEventLogCapacity = 1024;
+
+  explicit AnomalyMonitor(AnomalyConfig const &config = {}, size_t maxSeries = kDefaultMaxSeries);
+
+  std::optional<AnomalyEvent> Observe(uint64_t series, int64_t timeMs, double value);
+  // Every metric of a MetricHistory row
+  std::vector<AnomalyEvent> ObserveRow(int64_t timeMs, std::span<double const, kMetricCount> values);
+
+  // Logged events at or after sinceMs, oldest first
+  std::vector<AnomalyEvent> Events(int64_t sinceMs = std::numeric_limits<int64_t>::min()) const;
+  // Anomalies in progress
+  std::vector<AnomalyEvent> Open() const;
+
+  size_t Series() const;
+  AnomalyConfig const &Config() const noexcept {
+    return m_config;
+  }
+
+private:
+  std::optional<AnomalyEvent> ObserveLocked(uint64_t series, int64_t timeMs, double value);
+
+  struct Entry {
+    uint64_t series;
+    AnomalyDetector detector;
+  };
+
+  AnomalyConfig const m_config;
+  size_t const m_maxSeries;
+  mutable std::mutex m_mutex;
+  // Most recently fed first
+  std::list<Entry> m_entries;
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> m_index;
+  std::deque<AnomalyEvent> m_events;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,73 @@
+#include "CircuitBreaker.h"
+
+#include <algorithm>
+
+namespace ReactNativeDeviceAiCore {
+
+const char *ToString(BreakerState state) noexcept {
+  switch (state) {
+    case BreakerState::Closed:
+      return "closed";
+    case BreakerState::Open:
+      return "open";
+    case BreakerState::HalfOpen:
+      return "halfOpen";
+  }
+  return "closed";
+}
+
+CircuitBreaker::CircuitBreaker(BreakerOptions options, Clock const &clock) noexcept
+    : m_options(options), m_clock(clock) {}
+
+bool CircuitBreaker::Allow() noexcept {
+  switch (m_state) {
+    case BreakerState::Closed:
+      return true;
+    case BreakerState::Open:
+      if (m_clock.NowMs() < m_retryAtMs) {
+        return false;
+      }
+      m_state = BreakerState::HalfOpen;
+      return true;
+    case BreakerState::HalfOpen:
+      // The probe is still outstanding
+      return false;
+  }
+  return true;
+}
+
+void CircuitBreaker::RecordSuccess() noexcept {
+  m_state = BreakerState::Closed;
+  m_consecutiveFailures = 0;
+  m_backoffMs = 0;
+}
+
+void CircuitBreaker::RecordFailure() noexcept {
+  ++m_consecutiveFailures;
+  if (m_state == BreakerState::HalfOpen) {
+    m_backoffMs = std::min(m_backoffMs * 2, m_options.maxBackoffMs);
+    Open();
+  } else if (m_state == BreakerState::Closed && m_consecutiveFailures >= m_options.failureThreshold) {
+    m_backoffMs = m_options.baseBackoffMs;
+    Open();
+  }
+}
+
+BreakerSnapshot CircuitBreaker::Snapshot() const noexcept {
+  BreakerSnapshot snapshot;
+  snapshot.state = m_state;
+  snapshot.consecutiveFailures = m_consecutiveFailures;
+  snapshot.opens = m_opens;
+  if (m_state == BreakerState::Open) {
+    snapshot.retryInMs = std::max<int64_t>(0, m_retryAtMs - m_clock.NowMs());
+  }
+  return snapshot;
+}
+
+void CircuitBreaker::Open() noexcept {
+  m_state = BreakerState::Open;
+  m_retryAtMs = m_clock.NowMs() + m_backoffMs;
+  ++m_opens;
+}
+
+} // namespace ReactNativeDeviceAiCore
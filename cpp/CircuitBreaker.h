@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Clock.h"
+
+#include <cstdint>
+#include <optional>
+
+namespace ReactNativeDeviceAiCore {
+
+enum class BreakerState { Closed, Open, HalfOpen };
+
+const char *ToString(BreakerState state) noexcept;
+
+struct BreakerOptions {
+  // Consecutive failures that open a closed breaker
+  uint32_t failureThreshold = 3;
+  // First open interval; doubles on every failed probe up to maxBackoffMs
+  int64_t baseBackoffMs = 5000;
+  int64_t maxBackoffMs = 5 * 60 * 1000;
+};
+
+struct BreakerSnapshot {
+  BreakerState state = BreakerState::Closed;
+  uint32_t consecutiveFailures = 0;
+  uint64_t opens = 0;
+  // Time left until the next probe; only set while open
+  std::optional<int64_t> retryInMs;
+};
+
+// Failure gate for one data source. After failureThreshold consecutive
+// failures it opens and Allow() refuses runs for a back-off window; the first
+// Allow() after the window half-opens it and admits a single probe, whose
+// outcome either closes the breaker or reopens it with twice the back-off.
+// Not synchronized; the owner calls it under its own lock.
+class CircuitBreaker {
+public:
+  explicit CircuitBreaker(BreakerOptions options = {}, Clock const &clock = SteadyClock::Instance()) noexcept;
+
+  bool Allow() noexcept;
+  void RecordSuccess() noexcept;
+  void RecordFailure() noexcept;
+  BreakerSnapshot Snapshot() const noexcept;
+
+private:
+  void Open() noexcept;
+
+  BreakerOptions const m_options;
+  Clock const &m_clock;
+
+  BreakerState m_state = BreakerState::Closed;
+  uint32_t m_consecutiveFailures = 0;
+  uint64_t m_opens = 0;
+  int64_t m_backoffMs = 0;
+  int64_t m_retryAtMs = 0;
+};
+
+} // namespace ReactNativeDeviceAiCore
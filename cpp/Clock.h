@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace ReactNativeDeviceAiCore {
+
+// Monotonic millisecond time source. Policy code takes a Clock so that it can be
+// driven by a VirtualClock in tests instead of waiting on real time.
+struct Clock {
+  virtual ~Clock() = default;
+  virtual int64_t NowMs() const noexcept = 0;
+};
+
+struct SteadyClock final : Clock {
+  int64_t NowMs() const noexcept override {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  static SteadyClock &Instance() noexcept {
+    static SteadyClock clock;
+    return clock;
+  }
+};
+
+struct VirtualClock final : Clock {
+  explicit VirtualClock(int64_t startMs = 0) noexcept : m_nowMs(startMs) {}
+
+  int64_t NowMs() const noexcept override {
+    return m_nowMs.load(std::memory_order_acquire);
+  }
+
+  void Advance(int64_t deltaMs) noexcept {
+    m_nowMs.fetch_add(deltaMs, std::memory_order_acq_rel);
+  }
+
+  void Set(int64_t nowMs) noexcept {
+    m_nowMs.store(nowMs, std::memory_order_release);
+  }
+
+private:
+  std::atomic<int64_t> m_nowMs;
+};
+
+} // namespace ReactNativeDeviceAiCore
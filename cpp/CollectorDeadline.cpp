@@ -0,0 +1,53 @@
+#include "CollectorDeadline.h"
+
+namespace ReactNativeDeviceAiCore {
+
+const char *ToString(Collector collector) noexcept {
+  switch (collector) {
+    case Collector::Memory:
+      return "memory";
+    case Collector::Storage:
+      return "storage";
+    case Collector::Battery:
+      return "battery";
+    case Collector::Cpu:
+      return "cpu";
+    case Collector::Network:
+      return "network";
+    case Collector::PerformanceCounters:
+      return "performanceCounters";
+    case Collector::Wmi:
+      return "wmi";
+  }
+  return "unknown";
+}
+
+void CollectorStats::RecordRun(Collector collector, double durationMs, bool succeeded) noexcept {
+  auto &counters = m_counters[static_cast<size_t>(collector)];
+  counters.runs.fetch_add(1, std::memory_order_relaxed);
+  if (!succeeded) {
+    counters.failures.fetch_add(1, std::memory_order_relaxed);
+  }
+  counters.lastDurationMs.store(durationMs, std::memory_order_relaxed);
+}
+
+void CollectorStats::RecordTimeout(Collector collector) noexcept {
+  m_counters[static_cast<size_t>(collector)].timeouts.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CollectorStats::RecordSkip(Collector collector) noexcept {
+  m_counters[static_cast<size_t>(collector)].skipped.fetch_add(1, std::memory_order_relaxed);
+}
+
+CollectorStatsSnapshot CollectorStats::Snapshot(Collector collector) const noexcept {
+  auto const &counters = m_counters[static_cast<size_t>(collector)];
+  CollectorStatsSnapshot snapshot;
+  snapshot.runs = counters.runs.load(std::memory_order_relaxed);
+  snapshot.failures = counters.failures.load(std::memory_order_relaxed);
+  snapshot.timeouts = counters.timeouts.load(std::memory_order_relaxed);
+  snapshot.skipped = counters.skipped.load(std::memory_order_relaxed);
+  snapshot.lastDurationMs = counters.lastDurationMs.load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+} // namespace ReactNativeDeviceAiCore
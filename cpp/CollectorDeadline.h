@@ -0,0 +1,189 @@
+#pragma once
+
+#include "CircuitBreaker.h"
+#include "Clock.h"
+#include "Task.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace ReactNativeDeviceAiCore {
+
+// Independent data sources behind getDeviceInfo and getWindowsSystemInfo.
+enum class Collector { Memory, Storage, Battery, Cpu, Network, PerformanceCounters, Wmi };
+
+constexpr size_t kCollectorCount = 7;
+
+const char *ToString(Collector collector) noexcept;
+
+struct CollectorStatsSnapshot {
+  uint64_t runs = 0;
+  uint64_t failures = 0;
+  uint64_t timeouts = 0;
+  uint64_t skipped = 0;
+  double lastDurationMs = 0.0;
+};
+
+// Per-collector counters, updated from worker threads and read from JS without locking.
+class CollectorStats {
+public:
+  void RecordRun(Collector collector, double durationMs, bool succeeded) noexcept;
+  void RecordTimeout(Collector collector) noexcept;
+  void RecordSkip(Collector collector) noexcept;
+  CollectorStatsSnapshot Snapshot(Collector collector) const noexcept;
+
+private:
+  struct Counters {
+    std::atomic<uint64_t> runs{0};
+    std::atomic<uint64_t> failures{0};
+    std::atomic<uint64_t> timeouts{0};
+    std::atomic<uint64_t> skipped{0};
+    std::atomic<double> lastDurationMs{0.0};
+  };
+
+  std::array<Counters, kCollectorCount> m_counters;
+};
+
+// One section of a method result. value is nullopt only when the deadline was
+// missed before the collector ever produced a value.
+template <typename T>
+struct SectionResult {
+  std::optional<T> value;
+  bool stale = false;
+  int64_t ageMs = 0;
+};
+
+// Runs one collector on an executor and lets callers wait for it with a
+// deadline. A caller that gives up gets the last good value marked stale; the
+// collection keeps running and refreshes that value when it finishes. While a
+// run is outstanding, new callers wait on it instead of starting another, so a
+// stalled source never piles up worker threads. A source that keeps failing
+// trips its circuit breaker, and while it is open Start() skips the run so
+// callers get the last good value at once instead of waiting out the failure.
+template <typename T>
+class DeadlineCollector {
+public:
+  using Collect = std::function<std::optional<T>()>;
+
+  // Ticket for a run the open breaker refused
+  static constexpr uint64_t kSkipped = 0;
+
+  DeadlineCollector(Collector id, int64_t deadlineMs, CollectorStats &stats, BreakerOptions breaker = {},
+                    Clock const &clock = SteadyClock::Instance()) noexcept
+      : m_id(id), m_deadlineMs(deadlineMs), m_stats(stats), m_clock(clock), m_breaker(breaker, clock) {}
+
+  DeadlineCollector(DeadlineCollector const &) = delete;
+  DeadlineCollector &operator=(DeadlineCollector const &) = delete;
+
+  Collector Id() const noexcept {
+    return m_id;
+  }
+
+  // Returns the ticket to Await(), or kSkipped while the breaker is open. The
+  // token keeps the owner alive until the run ends.
+  uint64_t Start(Executor &executor, Collect collect, AsyncScope::Token token) {
+    uint64_t ticket;
+    {
+      std::lock_guard lock(m_mutex);
+      if (m_running) {
+        return m_started;
+      }
+      if (!m_breaker.Allow()) {
+        m_stats.RecordSkip(m_id);
+        return kSkipped;
+      }
+      m_running = true;
+      ticket = ++m_started;
+    }
+    Run(executor, std::move(collect), std::move(token));
+    return ticket;
+  }
+
+  // Waits until the run for ticket ends or min(own deadline, budgetMs) passes since startMs.
+  SectionResult<T> Await(uint64_t ticket, int64_t startMs, int64_t budgetMs) {
+    auto deadlineMs = startMs + std::min(m_deadlineMs, budgetMs);
+    auto remainingMs = std::max<int64_t>(0, deadlineMs - m_clock.NowMs());
+
+    std::unique_lock lock(m_mutex);
+    bool skipped = ticket == kSkipped;
+    bool finished = skipped || m_done.wait_for(lock, std::chrono::milliseconds(remainingMs), [&] { return m_completed >= ticket; });
+    if (!finished) {
+      m_stats.RecordTimeout(m_id);
+    }
+
+    SectionResult<T> result;
+    result.value = m_lastGood;
+    if (m_lastGood) {
+      result.ageMs = m_clock.NowMs() - m_lastGoodAtMs;
+    }
+    // A finished run that failed also leaves only an older value to report
+    result.stale = skipped || !finished || !m_lastSucceeded || m_lastGoodTicket < ticket;
+    return result;
+  }
+
+  BreakerSnapshot Breaker() const noexcept {
+    std::lock_guard lock(m_mutex);
+    return m_breaker.Snapshot();
+  }
+
+  int64_t DeadlineMs() const noexcept {
+    return m_deadlineMs;
+  }
+
+private:
+  // Only held: the token lives in the coroutine frame, so the scope counts the
+  // run until it has finished touching this collector
+  FireAndForget Run(Executor &executor, Collect collect, [[maybe_unused]] AsyncScope::Token token) {
+    co_await ScheduleOn(executor);
+
+    auto startedMs = m_clock.NowMs();
+    std::optional<T> value;
+    try {
+      value = collect();
+    } catch (...) {
+    }
+    auto finishedMs = m_clock.NowMs();
+    m_stats.RecordRun(m_id, static_cast<double>(finishedMs - startedMs), value.has_value());
+
+    // Notify under the lock so the owner cannot be torn down mid-notify
+    std::lock_guard lock(m_mutex);
+    m_completed = m_started;
+    m_lastSucceeded = value.has_value();
+    if (value) {
+      m_breaker.RecordSuccess();
+      m_lastGood = std::move(value);
+      m_lastGoodAtMs = finishedMs;
+      m_lastGoodTicket = m_completed;
+    } else {
+      m_breaker.RecordFailure();
+    }
+    m_running = false;
+    m_done.notify_all();
+  }
+
+  Collector const m_id;
+  int64_t const m_deadlineMs;
+  CollectorStats &m_stats;
+  Clock const &m_clock;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_done;
+  CircuitBreaker m_breaker;
+  bool m_running = false;
+  uint64_t m_started = 0;
+  uint64_t m_completed = 0;
+  bool m_lastSucceeded = false;
+  std::optional<T> m_lastGood;
+  int64_t m_lastGoodAtMs = 0;
+  uint64_t m_lastGoodTicket = 0;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,46 @@
+#include "Crc32.h"
+
+#include <array>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+// Slicing-by-8 tables: table[0] is the classic byte-at-a-time table
+constexpr auto kTables = [] {
+  std::array<std::array<uint32_t, 256>, 8> tables{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    tables[0][i] = crc;
+  }
+  for (uint32_t i = 0; i < 256; ++i) {
+    for (size_t t = 1; t < 8; ++t) {
+      tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xFF];
+    }
+  }
+  return tables;
+}();
+
+} // namespace
+
+uint32_t Crc32(std::span<uint8_t const> bytes, uint32_t crc) noexcept {
+  crc = ~crc;
+  auto const *data = bytes.data();
+  auto size = bytes.size();
+  while (size >= 8) {
+    auto low = crc ^ (uint32_t{data[0]} | uint32_t{data[1]} << 8 | uint32_t{data[2]} << 16 | uint32_t{data[3]} << 24);
+    crc = kTables[7][low & 0xFF] ^ kTables[6][(low >> 8) & 0xFF] ^ kTables[5][(low >> 16) & 0xFF] ^ kTables[4][low >> 24] ^
+        kTables[3][data[4]] ^ kTables[2][data[5]] ^ kTables[1][data[6]] ^ kTables[0][data[7]];
+    data += 8;
+    size -= 8;
+  }
+  while (size-- > 0) {
+    crc = (crc >> 8) ^ kTables[0][(crc ^ *data++) & 0xFF];
+  }
+  return ~crc;
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace ReactNativeDeviceAiCore {
+
+// CRC-32 (IEEE 802.3, as in zlib and PNG). Pass the previous result as crc to
+// continue over more bytes.
+uint32_t Crc32(std::span<uint8_t const> bytes, uint32_t crc = 0) noexcept;
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,147 @@
+#include "DeviceSnapshot.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ReactNativeDeviceAiCore {
+
+const char *ToString(Metric metric) noexcept {
+  switch (metric) {
+    case Metric::MemoryTotal:
+      return "memory.total";
+    case Metric::MemoryAvailable:
+      return "memory.available";
+    case Metric::StorageTotal:
+      return "storage.total";
+    case Metric::StorageAvailable:
+      return "storage.available";
+    case Metric::BatteryLevel:
+      return "battery.level";
+    case Metric::BatteryCharging:
+      return "battery.isCharging";
+    case Metric::CpuUsage:
+      return "cpu.usage";
+    case Metric::CpuCores:
+      return "cpu.cores";
+    case Metric::NetworkConnected:
+      return "network.isConnected";
+    case Metric::CounterCpuUsage:
+      return "performanceCounters.cpuUsage";
+    case Metric::CounterMemoryUsage:
+      return "performanceCounters.memoryUsage";
+    case Metric::CounterDiskUsage:
+      return "performanceCounters.diskUsage";
+  }
+  return "unknown";
+}
+
+const char *ToString(TextField field) noexcept {
+  switch (field) {
+    case TextField::NetworkType:
+      return "network.type";
+    case TextField::WmiComputerSystem:
+      return "wmiData.computerSystem";
+    case TextField::WmiOperatingSystem:
+      return "wmiData.operatingSystem";
+    case TextField::WmiProcessor:
+      return "wmiData.processor";
+    case TextField::OsVersion:
+      return "osVersion";
+    case TextField::BuildNumber:
+      return "buildNumber";
+    case TextField::Processor:
+      return "processor";
+    case TextField::Architecture:
+      return "architecture";
+  }
+  return "unknown";
+}
+
+std::span<Metric const> MetricsOf(Collector collector) noexcept {
+  static constexpr Metric kMemory[] = {Metric::MemoryTotal, Metric::MemoryAvailable};
+  static constexpr Metric kStorage[] = {Metric::StorageTotal, Metric::StorageAvailable};
+  static constexpr Metric kBattery[] = {Metric::BatteryLevel, Metric::BatteryCharging};
+  static constexpr Metric kCpu[] = {Metric::CpuUsage, Metric::CpuCores};
+  static constexpr Metric kNetwork[] = {Metric::NetworkConnected};
+  static constexpr Metric kCounters[] = {Metric::CounterCpuUsage, Metric::CounterMemoryUsage, Metric::CounterDiskUsage};
+  switch (collector) {
+    case Collector::Memory:
+      return kMemory;
+    case Collector::Storage:
+      return kStorage;
+    case Collector::Battery:
+      return kBattery;
+    case Collector::Cpu:
+      return kCpu;
+    case Collector::Network:
+      return kNetwork;
+    case Collector::PerformanceCounters:
+      return kCounters;
+    case Collector::Wmi:
+      return {};
+  }
+  return {};
+}
+
+std::span<TextField const> TextsOf(Collector collector) noexcept {
+  static constexpr TextField kNetwork[] = {TextField::NetworkType};
+  static constexpr TextField kWmi[] = {TextField::WmiComputerSystem, TextField::WmiOperatingSystem, TextField::WmiProcessor};
+  switch (collector) {
+    case Collector::Network:
+      return kNetwork;
+    case Collector::Wmi:
+      return kWmi;
+    default:
+      return {};
+  }
+}
+
+const char *ShortName(Metric metric) noexcept {
+  auto const *name = ToString(metric);
+  auto const *dot = std::strchr(name, '.');
+  return dot ? dot + 1 : name;
+}
+
+const char *ShortName(TextField field) noexcept {
+  auto const *name = ToString(field);
+  auto const *dot = std::strchr(name, '.');
+  return dot ? dot + 1 : name;
+}
+
+std::optional<Metric> FindMetric(std::string_view name) noexcept {
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    if (name == ToString(static_cast<Metric>(i))) {
+      return static_cast<Metric>(i);
+    }
+  }
+  return std::nullopt;
+}
+
+const char *SectionName(Collector collector) noexcept {
+  switch (collector) {
+    case Collector::PerformanceCounters:
+      return "performanceCounters";
+    case Collector::Wmi:
+      return "wmiData";
+    default:
+      return ToString(collector);
+  }
+}
+
+bool IsBoolean(Metric metric) noexcept {
+  return metric == Metric::BatteryCharging || metric == Metric::NetworkConnected;
+}
+
+void TextValue::Assign(std::string_view text) noexcept {
+  auto length = std::min(text.size(), kCapacity);
+  // Back up over continuation bytes so a multi-byte character is not split
+  if (length < text.size()) {
+    while (length > 0 && (static_cast<unsigned char>(text[length]) & 0xC0) == 0x80) {
+      --length;
+    }
+  }
+  std::memcpy(chars.data(), text.data(), length);
+  this->length = static_cast<uint8_t>(length);
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CollectorDeadline.h"
+#include "LastKnownValue.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace ReactNativeDeviceAiCore {
+
+// Numeric fields of a snapshot. Booleans are stored as 0 or 1.
+enum class Metric : uint8_t {
+  MemoryTotal,
+  MemoryAvailable,
+  StorageTotal,
+  StorageAvailable,
+  BatteryLevel,
+  BatteryCharging,
+  CpuUsage,
+  CpuCores,
+  NetworkConnected,
+  CounterCpuUsage,
+  CounterMemoryUsage,
+  CounterDiskUsage
+};
+
+constexpr size_t kMetricCount = 12;
+
+// Same names as the fields reported by getFallbackStats, e.g. "memory.total"
+const char *ToString(Metric metric) noexcept;
+
+enum class TextField : uint8_t {
+  NetworkType,
+  WmiComputerSystem,
+  WmiOperatingSystem,
+  WmiProcessor,
+  OsVersion,
+  BuildNumber,
+  Processor,
+  Architecture
+};
+
+constexpr size_t kTextFieldCount = 8;
+
+const char *ToString(TextField field) noexcept;
+
+// Fields each collector fills, in the order its section reports them.
+// Identity texts (OsVersion onwards) belong to no collector.
+std::span<Metric const> MetricsOf(Collector collector) noexcept;
+std::span<TextField const> TextsOf(Collector collector) noexcept;
+
+// Field name without its section prefix, e.g. "total" for memory.total
+const char *ShortName(Metric metric) noexcept;
+const char *ShortName(TextField field) noexcept;
+
+// Metric by its ToString() name, e.g. "cpu.usage"
+std::optional<Metric> FindMetric(std::string_view name) noexcept;
+
+// Prefix of the collector's field names, which is also its section's name in
+// the codegen structs, e.g. "wmiData" for Collector::Wmi
+const char *SectionName(Collector collector) noexcept;
+
+// Metrics reported to JS as booleans
+bool IsBoolean(Metric metric) noexcept;
+
+struct MetricValue {
+  double value = 0.0;
+  ValueState state = ValueState::Unknown;
+  // How old a last-known value is; 0 when live or unknown
+  int64_t ageMs = 0;
+};
+
+// Fixed-capacity UTF-8 text. Longer strings are cut at a code point boundary.
+struct TextValue {
+  static constexpr size_t kCapacity = 120;
+
+  std::array<char, kCapacity> chars{};
+  uint8_t length = 0;
+  ValueState state = ValueState::Unknown;
+  int64_t ageMs = 0;
+
+  std::string_view View() const noexcept {
+    return {chars.data(), length};
+  }
+
+  void Assign(std::string_view text) noexcept;
+};
+
+// Worst field state in a collector's section and the age of its oldest
+// last-known value, as reported in each section's state/ageMs.
+struct SectionSummary {
+  ValueState state = ValueState::Unknown;
+  int64_t ageMs = 0;
+};
+
+// Everything one collection produced, in a flat trivially copyable block that
+// can be copied between threads and processes without allocation.
+struct DeviceSnapshot {
+  uint64_t sequence = 0;
+  int64_t timestampMs = 0;
+  std::array<MetricValue, kMetricCount> metrics{};
+  std::array<TextValue, kTextFieldCount> texts{};
+  std::array<SectionSummary, kCollectorCount> sections{};
+
+  MetricValue &operator[](Metric metric) noexcept {
+    return metrics[static_cast<size_t>(metric)];
+  }
+
+  MetricValue const &operator[](Metric metric) const noexcept {
+    return metrics[static_cast<size_t>(metric)];
+  }
+
+  TextValue &operator[](TextField field) noexcept {
+    return texts[static_cast<size_t>(field)];
+  }
+
+  TextValue const &operator[](TextField field) const noexcept {
+    return texts[static_cast<size_t>(field)];
+  }
+
+  SectionSummary &Section(Collector collector) noexcept {
+    return sections[static_cast<size_t>(collector)];
+  }
+
+  SectionSummary const &Section(Collector collector) const noexcept {
+    return sections[static_cast<size_t>(collector)];
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<DeviceSnapshot>);
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,173 @@
+#include "Downsample.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+std::vector<uint32_t> FiniteIndices(std::span<double const> y) {
+  std::vector<uint32_t> indices;
+  indices.reserve(y.size());
+  for (size_t i = 0; i < y.size(); ++i) {
+    if (std::isfinite(y[i])) {
+      indices.push_back(static_cast<uint32_t>(i));
+    }
+  }
+  return indices;
+}
+
+} // namespace
+
+const char *ToString(DownsampleMode mode) noexcept {
+  switch (mode) {
+    case DownsampleMode::None:
+      return "none";
+    case DownsampleMode::Lttb:
+      return "lttb";
+    case DownsampleMode::M4:
+      return "m4";
+  }
+  return "unknown";
+}
+
+std::optional<DownsampleMode> ParseDownsampleMode(std::string_view name) noexcept {
+  for (auto mode : {DownsampleMode::None, DownsampleMode::Lttb, DownsampleMode::M4}) {
+    if (name == ToString(mode)) {
+      return mode;
+    }
+  }
+  return std::nullopt;
+}
+
+std::vector<uint32_t> LttbIndices(std::span<double const> x, std::span<double const> y, size_t maxPoints) {
+  auto points = FiniteIndices(y);
+  auto count = points.size();
+  if (maxPoints >= count || maxPoints == 0) {
+    return points;
+  }
+  if (maxPoints < 3) {
+    return {points.front(), points.back()};
+  }
+
+  std::vector<uint32_t> kept;
+  kept.reserve(maxPoints);
+  kept.push_back(points.front());
+
+  // Interior points split evenly into maxPoints - 2 buckets
+  double bucketSize = static_cast<double>(count - 2) / static_cast<double>(maxPoints - 2);
+  size_t previous = 0;
+  for (size_t bucket = 0; bucket < maxPoints - 2; ++bucket) {
+    auto begin = static_cast<size_t>(bucket * bucketSize) + 1;
+    auto end = std::min(static_cast<size_t>((bucket + 1) * bucketSize) + 1, count - 1);
+
+    // Average of the next bucket, or the last point for the final bucket
+    auto nextBegin = end;
+    auto nextEnd = std::min(static_cast<size_t>((bucket + 2) * bucketSize) + 1, count);
+    double averageX = 0.0;
+    double averageY = 0.0;
+    for (auto i = nextBegin; i < nextEnd; ++i) {
+      averageX += x[points[i]];
+      averageY += y[points[i]];
+    }
+    auto nextCount = static_cast<double>(nextEnd - nextBegin);
+    averageX /= nextCount;
+    averageY /= nextCount;
+
+    auto ax = x[points[previous]];
+    auto ay = y[points[previous]];
+    double largestArea = -1.0;
+    auto chosen = begin;
+    for (auto i = begin; i < end; ++i) {
+      // Twice the triangle area; only the comparison matters
+      auto area = std::abs((ax - averageX) * (y[points[i]] - ay) - (ax - x[points[i]]) * (averageY - ay));
+      if (area > largestArea) {
+        largestArea = area;
+        chosen = i;
+      }
+    }
+    kept.push_back(points[chosen]);
+    previous = chosen;
+  }
+
+  kept.push_back(points.back());
+  return kept;
+}
+
+std::vector<uint32_t> M4Indices(std::span<double const> x, std::span<double const> y, size_t maxPoints) {
+  // Single pass over the raw series, skipping NaNs in place
+  size_t firstFinite = 0;
+  while (firstFinite < y.size() && !std::isfinite(y[firstFinite])) {
+    ++firstFinite;
+  }
+  size_t lastFinite = y.size();
+  while (lastFinite > firstFinite && !std::isfinite(y[lastFinite - 1])) {
+    --lastFinite;
+  }
+  if (firstFinite == lastFinite) {
+    return {};
+  }
+  if (maxPoints == 0 || maxPoints >= lastFinite - firstFinite) {
+    auto points = FiniteIndices(y);
+    if (maxPoints == 0 || maxPoints >= points.size()) {
+      return points;
+    }
+  }
+
+  auto buckets = std::max<size_t>(maxPoints / 4, 1);
+  auto startX = x[firstFinite];
+  auto spanX = x[lastFinite - 1] - startX;
+
+  std::vector<uint32_t> kept;
+  kept.reserve(buckets * 4);
+  size_t i = firstFinite;
+  for (size_t bucket = 0; bucket < buckets && i < lastFinite; ++bucket) {
+    // Points up to the bucket's right edge; the last bucket takes the rest
+    auto edge = bucket + 1 == buckets ? x[lastFinite - 1] : startX + spanX * static_cast<double>(bucket + 1) / static_cast<double>(buckets);
+    size_t first = lastFinite;
+    size_t last = 0;
+    size_t minimum = 0;
+    size_t maximum = 0;
+    for (; i < lastFinite && x[i] <= edge; ++i) {
+      auto value = y[i];
+      if (!std::isfinite(value)) {
+        continue;
+      }
+      if (first == lastFinite) {
+        first = minimum = maximum = i;
+      } else if (value < y[minimum]) {
+        minimum = i;
+      } else if (value > y[maximum]) {
+        maximum = i;
+      }
+      last = i;
+    }
+    if (first == lastFinite) {
+      continue;
+    }
+
+    size_t picks[] = {first, minimum, maximum, last};
+    std::sort(std::begin(picks), std::end(picks));
+    for (size_t p = 0; p < 4; ++p) {
+      if (p == 0 || picks[p] != picks[p - 1]) {
+        kept.push_back(static_cast<uint32_t>(picks[p]));
+      }
+    }
+  }
+  return kept;
+}
+
+std::vector<uint32_t> DownsampleIndices(DownsampleMode mode, std::span<double const> x, std::span<double const> y, size_t maxPoints) {
+  switch (mode) {
+    case DownsampleMode::Lttb:
+      return LttbIndices(x, y, maxPoints);
+    case DownsampleMode::M4:
+      return M4Indices(x, y, maxPoints);
+    case DownsampleMode::None:
+      break;
+  }
+  return FiniteIndices(y);
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+enum class DownsampleMode { None, Lttb, M4 };
+
+const char *ToString(DownsampleMode mode) noexcept;
+std::optional<DownsampleMode> ParseDownsampleMode(std::string_view name) noexcept;
+
+// Indices of the points kept when decimating the series (x ascending) to at
+// most maxPoints, ascending. NaN values are dropped first; a series that
+// already fits is returned whole.
+//
+// Largest-Triangle-Three-Buckets: keeps the first and last point and, from
+// each bucket in between, the point forming the largest triangle with the
+// previous pick and the next bucket's average. Follows the visual shape.
+std::vector<uint32_t> LttbIndices(std::span<double const> x, std::span<double const> y, size_t maxPoints);
+
+// M4: splits the x range into maxPoints / 4 equal-width buckets and keeps the
+// first, last, minimum and maximum of each, so every peak and trough survives.
+std::vector<uint32_t> M4Indices(std::span<double const> x, std::span<double const> y, size_t maxPoints);
+
+std::vector<uint32_t> DownsampleIndices(DownsampleMode mode, std::span<double const> x, std::span<double const> y, size_t maxPoints);
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CollectorDeadline.h"
+#include "PlatformProvider.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace ReactNativeDeviceAiCore {
+
+// Deterministic provider for tests and benchmarks. Each collector answers with
+// fixed values, except CPU and disk usage, which walk a repeating ramp so that
+// consecutive snapshots differ. A collector can be given a latency or be made
+// to fail every read. Latency is slept like a blocking platform call, except
+// for the last stretch, which is spun so that short delays stay accurate.
+class FakePlatformProvider final : public PlatformProvider {
+public:
+  static constexpr const char *kSource = "fake";
+
+  void SetLatency(Collector collector, std::chrono::nanoseconds latency) noexcept {
+    m_collectors[static_cast<size_t>(collector)].latencyNs.store(latency.count(), std::memory_order_relaxed);
+  }
+
+  void SetFailing(Collector collector, bool failing) noexcept {
+    m_collectors[static_cast<size_t>(collector)].failing.store(failing, std::memory_order_relaxed);
+  }
+
+  uint64_t Reads(Collector collector) const noexcept {
+    return m_collectors[static_cast<size_t>(collector)].reads.load(std::memory_order_relaxed);
+  }
+
+  const char *Name() const noexcept override {
+    return "fake";
+  }
+
+  MemoryReading ReadMemory() override {
+    MemoryReading reading;
+    if (auto step = Enter(Collector::Memory)) {
+      reading.total = Value(16.0 * kGiB);
+      reading.available = Value(6.0 * kGiB + static_cast<double>(*step % 64) * kMiB);
+    }
+    return reading;
+  }
+
+  StorageReading ReadStorage() override {
+    StorageReading reading;
+    if (Enter(Collector::Storage)) {
+      reading.total = Value(512.0 * kGiB);
+      reading.available = Value(200.0 * kGiB);
+    }
+    return reading;
+  }
+
+  BatteryReading ReadBattery() override {
+    BatteryReading reading;
+    if (Enter(Collector::Battery)) {
+      reading.level = Value(80.0);
+      reading.charging = Value(true);
+    }
+    return reading;
+  }
+
+  CpuReading ReadCpu() override {
+    CpuReading reading;
+    if (auto step = Enter(Collector::Cpu)) {
+      reading.usage = Value(Ramp(*step));
+      reading.cores = Value(8.0);
+    }
+    return reading;
+  }
+
+  NetworkReading ReadNetwork() override {
+    NetworkReading reading;
+    if (Enter(Collector::Network)) {
+      reading.type = Value(std::string("wifi"));
+      reading.connected = Value(true);
+    }
+    return reading;
+  }
+
+  CounterReading ReadPerformanceCounters() override {
+    CounterReading reading;
+    if (auto step = Enter(Collector::PerformanceCounters)) {
+      reading.cpuUsage = Value(Ramp(*step));
+      reading.memoryUsage = Value(62.5);
+      reading.diskUsage = Value(Ramp(*step + 50));
+    }
+    return reading;
+  }
+
+  WmiReading ReadWmi() override {
+    WmiReading reading;
+    if (Enter(Collector::Wmi)) {
+      reading.computerSystem = Value(std::string("Fake Device 1"));
+      reading.operatingSystem = Value(std::string("Fake OS"));
+      reading.processor = Value(std::string("Fake CPU @ 3.00GHz"));
+    }
+    return reading;
+  }
+
+  IdentityReading ReadIdentity() override {
+    IdentityReading reading;
+    reading.osVersion = Value(std::string("10.0.22631"));
+    reading.buildNumber = Value(std::string("22631"));
+    reading.processor = Value(std::string("Fake CPU @ 3.00GHz"));
+    reading.architecture = Value(std::string("x64"));
+    return reading;
+  }
+
+private:
+  static constexpr double kMiB = 1024.0 * 1024.0;
+  static constexpr double kGiB = 1024.0 * kMiB;
+  static constexpr std::chrono::microseconds kSpinTail{200};
+
+  struct CollectorState {
+    std::atomic<int64_t> latencyNs{0};
+    std::atomic<bool> failing{false};
+    std::atomic<uint64_t> reads{0};
+  };
+
+  template <typename T>
+  static Sourced<T> Value(T value) {
+    return {std::move(value), kSource};
+  }
+
+  // 5..95 and back down in steps of 1
+  static double Ramp(uint64_t step) noexcept {
+    auto phase = static_cast<double>(step % 180);
+    return phase < 90.0 ? 5.0 + phase : 185.0 - phase;
+  }
+
+  // Counts the read and spends its latency; returns the read's index, or
+  // nullopt when the collector is set to fail
+  std::optional<uint64_t> Enter(Collector collector) noexcept {
+    auto &state = m_collectors[static_cast<size_t>(collector)];
+    auto step = state.reads.fetch_add(1, std::memory_order_relaxed);
+    if (auto latencyNs = state.latencyNs.load(std::memory_order_relaxed); latencyNs > 0) {
+      auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(latencyNs);
+      if (auto sleepFor = std::chrono::nanoseconds(latencyNs) - kSpinTail; sleepFor.count() > 0) {
+        std::this_thread::sleep_for(sleepFor);
+      }
+      while (std::chrono::steady_clock::now() < until) {
+      }
+    }
+    if (state.failing.load(std::memory_order_relaxed)) {
+      return std::nullopt;
+    }
+    return step;
+  }
+
+  std::array<CollectorState, kCollectorCount> m_collectors;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,252 @@
+#include "GorillaCodec.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace ReactNativeDeviceAiCore::Gorilla {
+
+namespace {
+
+// Most significant bit first
+class BitWriter {
+public:
+  explicit BitWriter(std::vector<uint8_t> &out) noexcept : m_out(out) {}
+
+  void Write(uint64_t bits, int count) {
+    while (count > 0) {
+      if (m_free == 0) {
+        m_out.push_back(0);
+        m_free = 8;
+      }
+      auto take = count < m_free ? count : m_free;
+      auto chunk = static_cast<uint8_t>((bits >> (count - take)) & ((1u << take) - 1));
+      m_out.back() |= static_cast<uint8_t>(chunk << (m_free - take));
+      m_free -= take;
+      count -= take;
+    }
+  }
+
+  void WriteBit(bool bit) {
+    Write(bit ? 1 : 0, 1);
+  }
+
+private:
+  std::vector<uint8_t> &m_out;
+  int m_free = 0;
+};
+
+// Reads up to 56 bits at a time from an unaligned big-endian window
+class BitReader {
+public:
+  explicit BitReader(std::span<uint8_t const> bytes) noexcept : m_bytes(bytes) {}
+
+  bool Overrun() const noexcept {
+    return m_position > m_bytes.size() * 8;
+  }
+
+  size_t BytesConsumed() const noexcept {
+    return (m_position + 7) / 8;
+  }
+
+  // The next count bits, at most 56, without consuming them
+  uint64_t Peek(int count) const noexcept {
+    return (Window() << (m_position & 7)) >> (64 - count);
+  }
+
+  void Skip(int count) noexcept {
+    m_position += static_cast<size_t>(count);
+  }
+
+  uint64_t Read(int count) noexcept {
+    if (count > 56) {
+      auto high = Read(count - 32);
+      return (high << 32) | Read(32);
+    }
+    if (count == 0) {
+      return 0;
+    }
+    auto value = Peek(count);
+    Skip(count);
+    return value;
+  }
+
+private:
+  uint64_t Window() const noexcept {
+    auto offset = m_position / 8;
+    uint8_t buffer[8] = {};
+    if (offset + 8 <= m_bytes.size()) {
+      std::memcpy(buffer, m_bytes.data() + offset, 8);
+    } else if (offset < m_bytes.size()) {
+      std::memcpy(buffer, m_bytes.data() + offset, m_bytes.size() - offset);
+    }
+    uint64_t window = 0;
+    for (auto byte : buffer) {
+      window = (window << 8) | byte;
+    }
+    return window;
+  }
+
+  std::span<uint8_t const> m_bytes;
+  size_t m_position = 0;
+};
+
+uint64_t ZigZag(int64_t value) noexcept {
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(uint64_t value) noexcept {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// Delta-of-delta buckets: control prefix, then that many zigzagged bits
+struct Bucket {
+  uint64_t prefix;
+  int prefixBits;
+  int valueBits;
+};
+
+constexpr Bucket kBuckets[] = {{0b10, 2, 7}, {0b110, 3, 9}, {0b1110, 4, 12}, {0b11110, 5, 32}, {0b11111, 5, 64}};
+
+} // namespace
+
+void EncodeTimestamps(std::span<int64_t const> timestamps, std::vector<uint8_t> &out) {
+  BitWriter writer(out);
+  int64_t previous = 0;
+  int64_t previousDelta = 0;
+  for (size_t i = 0; i < timestamps.size(); ++i) {
+    if (i == 0) {
+      writer.Write(static_cast<uint64_t>(timestamps[0]), 64);
+      previous = timestamps[0];
+      continue;
+    }
+
+    // Wrapping arithmetic keeps any pair of int64 timestamps lossless
+    auto delta = static_cast<int64_t>(static_cast<uint64_t>(timestamps[i]) - static_cast<uint64_t>(previous));
+    auto deltaOfDelta = static_cast<int64_t>(static_cast<uint64_t>(delta) - static_cast<uint64_t>(previousDelta));
+    previous = timestamps[i];
+    previousDelta = delta;
+
+    if (deltaOfDelta == 0) {
+      writer.WriteBit(false);
+      continue;
+    }
+    auto encoded = ZigZag(deltaOfDelta);
+    for (auto const &bucket : kBuckets) {
+      if (bucket.valueBits == 64 || encoded < (uint64_t{1} << bucket.valueBits)) {
+        writer.Write(bucket.prefix, bucket.prefixBits);
+        writer.Write(encoded, bucket.valueBits);
+        break;
+      }
+    }
+  }
+}
+
+size_t DecodeTimestamps(std::span<uint8_t const> bytes, size_t count, int64_t *out) {
+  BitReader reader(bytes);
+  int64_t previous = 0;
+  int64_t previousDelta = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (i == 0) {
+      previous = static_cast<int64_t>(reader.Read(64));
+      out[0] = previous;
+      continue;
+    }
+
+    // The control prefix is up to five one bits, ended by a zero unless all five are set
+    auto ones = std::countl_one(reader.Peek(5) << 59);
+    int64_t deltaOfDelta = 0;
+    if (ones == 0) {
+      reader.Skip(1);
+    } else {
+      auto const &bucket = kBuckets[ones - 1];
+      reader.Skip(bucket.prefixBits);
+      deltaOfDelta = UnZigZag(reader.Read(bucket.valueBits));
+    }
+
+    previousDelta = static_cast<int64_t>(static_cast<uint64_t>(previousDelta) + static_cast<uint64_t>(deltaOfDelta));
+    previous = static_cast<int64_t>(static_cast<uint64_t>(previous) + static_cast<uint64_t>(previousDelta));
+    out[i] = previous;
+  }
+  return reader.Overrun() ? 0 : reader.BytesConsumed();
+}
+
+void EncodeValues(std::span<double const> values, std::vector<uint8_t> &out) {
+  BitWriter writer(out);
+  uint64_t previous = 0;
+  int previousLeading = -1;
+  int previousTrailing = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    auto bits = std::bit_cast<uint64_t>(values[i]);
+    if (i == 0) {
+      writer.Write(bits, 64);
+      previous = bits;
+      continue;
+    }
+
+    auto xored = bits ^ previous;
+    previous = bits;
+    if (xored == 0) {
+      writer.WriteBit(false);
+      continue;
+    }
+    writer.WriteBit(true);
+
+    // Leading zeros are stored in 5 bits, so at most 31
+    auto leading = std::min(std::countl_zero(xored), 31);
+    auto trailing = std::countr_zero(xored);
+    if (previousLeading >= 0 && leading >= previousLeading && trailing >= previousTrailing) {
+      // Fits in the previous window of meaningful bits
+      writer.WriteBit(false);
+      writer.Write(xored >> previousTrailing, 64 - previousLeading - previousTrailing);
+      continue;
+    }
+
+    auto meaningful = 64 - leading - trailing;
+    writer.WriteBit(true);
+    writer.Write(static_cast<uint64_t>(leading), 5);
+    // 64 meaningful bits is stored as 0
+    writer.Write(static_cast<uint64_t>(meaningful & 63), 6);
+    writer.Write(xored >> trailing, meaningful);
+    previousLeading = leading;
+    previousTrailing = trailing;
+  }
+}
+
+size_t DecodeValues(std::span<uint8_t const> bytes, size_t count, double *out) {
+  BitReader reader(bytes);
+  uint64_t previous = 0;
+  int leading = 0;
+  int trailing = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (i == 0) {
+      previous = reader.Read(64);
+    } else {
+      // Control bits, then the new window's leading zero count and length
+      auto header = reader.Peek(13);
+      if ((header >> 12) == 0) {
+        reader.Skip(1);
+      } else {
+        if ((header >> 11) == 0b11) {
+          leading = static_cast<int>((header >> 6) & 31);
+          auto meaningful = static_cast<int>(header & 63);
+          if (meaningful == 0) {
+            meaningful = 64;
+          }
+          if (leading + meaningful > 64) {
+            return 0;
+          }
+          trailing = 64 - leading - meaningful;
+          reader.Skip(13);
+        } else {
+          reader.Skip(2);
+        }
+        previous ^= reader.Read(64 - leading - trailing) << trailing;
+      }
+    }
+    out[i] = std::bit_cast<double>(previous);
+  }
+  return reader.Overrun() ? 0 : reader.BytesConsumed();
+}
+
+} // namespace ReactNativeDeviceAiCore::Gorilla
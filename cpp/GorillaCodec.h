@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// Compression of timestamp and value columns as in Facebook's Gorilla
+// (Pelkonen et al., VLDB 2015). Timestamps store the delta of deltas in a
+// variable-width bucket, so a steady cadence costs one bit per sample;
+// values store the XOR with the previous value, reusing the previous run of
+// meaningful bits when it fits, so a repeated value costs one bit. Both are
+// lossless, NaNs included.
+//
+// Each column decodes as one tight loop over a word-buffered bit reader.
+// The bit stream is inherently serial, so columns, not samples, are the unit
+// of parallel work.
+namespace Gorilla {
+
+// Appends the encoded column to out
+void EncodeTimestamps(std::span<int64_t const> timestamps, std::vector<uint8_t> &out);
+void EncodeValues(std::span<double const> values, std::vector<uint8_t> &out);
+
+// Decodes count entries from the start of bytes into out. Returns the number
+// of bytes consumed, or 0 when the column is cut short.
+size_t DecodeTimestamps(std::span<uint8_t const> bytes, size_t count, int64_t *out);
+size_t DecodeValues(std::span<uint8_t const> bytes, size_t count, double *out);
+
+} // namespace Gorilla
+
+} // namespace ReactNativeDeviceAiCore
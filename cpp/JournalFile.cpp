@@ -0,0 +1,202 @@
+#include "JournalFile.h"
+
+#include <algorithm>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX 1
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN 1
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ReactNativeDeviceAiCore {
+
+#if defined(_WIN32)
+
+std::optional<AppendFile> AppendFile::Open(std::filesystem::path const &path) {
+  auto handle = CreateFileW(path.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+      OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (handle == INVALID_HANDLE_VALUE) {
+    return std::nullopt;
+  }
+  LARGE_INTEGER size{};
+  if (!GetFileSizeEx(handle, &size)) {
+    CloseHandle(handle);
+    return std::nullopt;
+  }
+  return AppendFile(reinterpret_cast<intptr_t>(handle), static_cast<uint64_t>(size.QuadPart));
+}
+
+void AppendFile::Close() noexcept {
+  if (m_handle != -1) {
+    CloseHandle(reinterpret_cast<HANDLE>(m_handle));
+    m_handle = -1;
+  }
+}
+
+bool AppendFile::Write(std::span<uint8_t const> bytes) noexcept {
+  while (!bytes.empty()) {
+    DWORD written = 0;
+    auto chunk = static_cast<DWORD>(std::min<size_t>(bytes.size(), 1u << 30));
+    if (!WriteFile(reinterpret_cast<HANDLE>(m_handle), bytes.data(), chunk, &written, nullptr) || written == 0) {
+      return false;
+    }
+    m_size += written;
+    bytes = bytes.subspan(written);
+  }
+  return true;
+}
+
+bool AppendFile::Sync() noexcept {
+  return FlushFileBuffers(reinterpret_cast<HANDLE>(m_handle)) != 0;
+}
+
+std::optional<MappedFile> MappedFile::Open(std::filesystem::path const &path, uint64_t maxBytes) {
+  auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return std::nullopt;
+  }
+  LARGE_INTEGER fileSize{};
+  GetFileSizeEx(file, &fileSize);
+  auto size = static_cast<size_t>(std::min<uint64_t>(static_cast<uint64_t>(fileSize.QuadPart), maxBytes));
+  if (size == 0) {
+    CloseHandle(file);
+    return MappedFile(nullptr, 0);
+  }
+
+  // The view keeps the file mapped after both handles are closed
+  auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping) {
+    return std::nullopt;
+  }
+  auto *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+  CloseHandle(mapping);
+  if (!data) {
+    return std::nullopt;
+  }
+  return MappedFile(data, size);
+}
+
+void MappedFile::Unmap() noexcept {
+  if (m_data) {
+    UnmapViewOfFile(m_data);
+    m_data = nullptr;
+  }
+}
+
+#else
+
+std::optional<AppendFile> AppendFile::Open(std::filesystem::path const &path) {
+  auto fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    return std::nullopt;
+  }
+  struct stat info{};
+  if (::fstat(fd, &info) != 0) {
+    ::close(fd);
+    return std::nullopt;
+  }
+  return AppendFile(fd, static_cast<uint64_t>(info.st_size));
+}
+
+void AppendFile::Close() noexcept {
+  if (m_handle != -1) {
+    ::close(static_cast<int>(m_handle));
+    m_handle = -1;
+  }
+}
+
+bool AppendFile::Write(std::span<uint8_t const> bytes) noexcept {
+  while (!bytes.empty()) {
+    auto written = ::write(static_cast<int>(m_handle), bytes.data(), bytes.size());
+    if (written <= 0) {
+      return false;
+    }
+    m_size += static_cast<uint64_t>(written);
+    bytes = bytes.subspan(static_cast<size_t>(written));
+  }
+  return true;
+}
+
+bool AppendFile::Sync() noexcept {
+  return ::fsync(static_cast<int>(m_handle)) == 0;
+}
+
+std::optional<MappedFile> MappedFile::Open(std::filesystem::path const &path, uint64_t maxBytes) {
+  auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return std::nullopt;
+  }
+  struct stat info{};
+  if (::fstat(fd, &info) != 0) {
+    ::close(fd);
+    return std::nullopt;
+  }
+  auto size = static_cast<size_t>(std::min<uint64_t>(static_cast<uint64_t>(info.st_size), maxBytes));
+  if (size == 0) {
+    ::close(fd);
+    return MappedFile(nullptr, 0);
+  }
+
+  // The mapping outlives the descriptor
+  auto *data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return std::nullopt;
+  }
+  return MappedFile(data, size);
+}
+
+void MappedFile::Unmap() noexcept {
+  if (m_data) {
+    ::munmap(const_cast<void *>(m_data), m_size);
+    m_data = nullptr;
+  }
+}
+
+#endif
+
+AppendFile::AppendFile(AppendFile &&other) noexcept
+    : m_handle(std::exchange(other.m_handle, -1)), m_size(std::exchange(other.m_size, 0)) {}
+
+AppendFile &AppendFile::operator=(AppendFile &&other) noexcept {
+  if (this != &other) {
+    Close();
+    m_handle = std::exchange(other.m_handle, -1);
+    m_size = std::exchange(other.m_size, 0);
+  }
+  return *this;
+}
+
+AppendFile::~AppendFile() {
+  Close();
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+  if (this != &other) {
+    Unmap();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile() {
+  Unmap();
+}
+
+} // namespace ReactNativeDeviceAiCore
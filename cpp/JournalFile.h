@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+namespace ReactNativeDeviceAiCore {
+
+// File handle that only appends: every write goes to the end of the file and
+// Sync() waits until what was written is on disk (fsync, FlushFileBuffers).
+class AppendFile {
+public:
+  // Creates the file when missing
+  static std::optional<AppendFile> Open(std::filesystem::path const &path);
+
+  AppendFile(AppendFile &&other) noexcept;
+  AppendFile &operator=(AppendFile &&other) noexcept;
+  ~AppendFile();
+
+  // False when not every byte was written; the file may then end in a partial write
+  bool Write(std::span<uint8_t const> bytes) noexcept;
+  bool Sync() noexcept;
+
+  uint64_t Size() const noexcept {
+    return m_size;
+  }
+
+private:
+  AppendFile(intptr_t handle, uint64_t size) noexcept : m_handle(handle), m_size(size) {}
+  void Close() noexcept;
+
+  intptr_t m_handle = -1;
+  uint64_t m_size = 0;
+};
+
+// Read-only memory mapping of a whole file, or of its first maxBytes. The
+// mapping stays valid after the file is appended to, renamed or (on POSIX)
+// deleted.
+class MappedFile {
+public:
+  static std::optional<MappedFile> Open(std::filesystem::path const &path, uint64_t maxBytes = UINT64_MAX);
+
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+  ~MappedFile();
+
+  std::span<uint8_t const> Bytes() const noexcept {
+    return {static_cast<uint8_t const *>(m_data), m_size};
+  }
+
+private:
+  MappedFile(void const *data, size_t size) noexcept : m_data(data), m_size(size) {}
+  void Unmap() noexcept;
+
+  void const *m_data = nullptr;
+  size_t m_size = 0;
+};
+
+} // namespace ReactNativeDeviceAiCore
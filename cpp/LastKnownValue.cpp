@@ -0,0 +1,44 @@
+#include "LastKnownValue.h"
+
+namespace ReactNativeDeviceAiCore {
+
+const char *ToString(ValueState state) noexcept {
+  switch (state) {
+    case ValueState::Live:
+      return "live";
+    case ValueState::LastKnown:
+      return "lastKnown";
+    case ValueState::Unknown:
+      return "unknown";
+  }
+  return "unknown";
+}
+
+LastKnownValueBase::LastKnownValueBase(ValueStore &store, const char *name) : m_name(name) {
+  store.m_fields.push_back(this);
+}
+
+FieldStats LastKnownValueBase::Stats(int64_t nowMs) const {
+  std::lock_guard lock(m_mutex);
+  FieldStats stats;
+  stats.name = m_name;
+  stats.source = m_source;
+  if (m_lastGoodAtMs) {
+    stats.lastGoodAgeMs = nowMs - *m_lastGoodAtMs;
+  }
+  stats.live = m_live;
+  stats.lastKnown = m_lastKnown;
+  stats.unknown = m_unknown;
+  return stats;
+}
+
+std::vector<FieldStats> ValueStore::Stats(int64_t nowMs) const {
+  std::vector<FieldStats> stats;
+  stats.reserve(m_fields.size());
+  for (auto const *field : m_fields) {
+    stats.push_back(field->Stats(nowMs));
+  }
+  return stats;
+}
+
+} // namespace ReactNativeDeviceAiCore
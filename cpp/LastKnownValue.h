@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// How a reported field was obtained. Unknown means nothing was ever collected,
+// so the field is left out rather than filled with a made-up number.
+enum class ValueState { Live, LastKnown, Unknown };
+
+const char *ToString(ValueState state) noexcept;
+
+template <typename T>
+struct FieldReading {
+  std::optional<T> value;
+  ValueState state = ValueState::Unknown;
+  int64_t ageMs = 0;
+};
+
+struct FieldStats {
+  const char *name = nullptr;
+  const char *source = nullptr;
+  std::optional<int64_t> lastGoodAgeMs;
+  uint64_t live = 0;
+  uint64_t lastKnown = 0;
+  uint64_t unknown = 0;
+};
+
+class ValueStore;
+
+// Type-independent part of a field: where its last good value came from, when,
+// and how often each fallback path has answered for it.
+class LastKnownValueBase {
+public:
+  LastKnownValueBase(LastKnownValueBase const &) = delete;
+  LastKnownValueBase &operator=(LastKnownValueBase const &) = delete;
+
+  FieldStats Stats(int64_t nowMs) const;
+
+protected:
+  LastKnownValueBase(ValueStore &store, const char *name);
+  ~LastKnownValueBase() = default;
+
+  mutable std::mutex m_mutex;
+  const char *const m_name;
+  const char *m_source = nullptr;
+  std::optional<int64_t> m_lastGoodAtMs;
+  uint64_t m_live = 0;
+  uint64_t m_lastKnown = 0;
+  uint64_t m_unknown = 0;
+};
+
+// Last successfully collected value of one field. Resolve() passes a live
+// read through and remembers it, or substitutes the remembered value when the
+// read failed.
+template <typename T>
+class LastKnownValue final : public LastKnownValueBase {
+public:
+  LastKnownValue(ValueStore &store, const char *name) : LastKnownValueBase(store, name) {}
+
+  FieldReading<T> Resolve(std::optional<T> live, const char *source, int64_t nowMs) {
+    std::lock_guard lock(m_mutex);
+    FieldReading<T> reading;
+
+    if (live) {
+      ++m_live;
+      m_value = live;
+      m_source = source;
+      m_lastGoodAtMs = nowMs;
+      reading.value = std::move(live);
+      reading.state = ValueState::Live;
+    } else if (m_value) {
+      ++m_lastKnown;
+      reading.value = m_value;
+      reading.state = ValueState::LastKnown;
+      reading.ageMs = nowMs - *m_lastGoodAtMs;
+    } else {
+      ++m_unknown;
+    }
+    return reading;
+  }
+
+private:
+  std::optional<T> m_value;
+};
+
+// Registry of every field so their fallback counters can be exported together.
+// Fields register themselves on construction and must not outlive the store.
+class ValueStore {
+public:
+  ValueStore() = default;
+  ValueStore(ValueStore const &) = delete;
+  ValueStore &operator=(ValueStore const &) = delete;
+
+  std::vector<FieldStats> Stats(int64_t nowMs) const;
+
+private:
+  friend class LastKnownValueBase;
+  std::vector<LastKnownValueBase const *> m_fields;
+};
+
+// Worst state and oldest fallback age across the fields of one result section.
+class SectionState {
+public:
+  template <typename T>
+  std::optional<T> Add(FieldReading<T> reading) {
+    m_state = std::max(m_state, reading.state);
+    m_anyLive = m_anyLive || reading.state == ValueState::Live;
+    if (reading.state == ValueState::LastKnown) {
+      m_ageMs = std::max(m_ageMs.value_or(0), reading.ageMs);
+    }
+    return std::move(reading.value);
+  }
+
+  ValueState State() const noexcept {
+    return m_state;
+  }
+
+  // Whether the read produced anything new; a section without a live field failed.
+  bool AnyLive() const noexcept {
+    return m_anyLive;
+  }
+
+  // Age of the oldest last-known value; nullopt when no field fell back to one.
+  std::optional<int64_t> AgeMs() const noexcept {
+    return m_ageMs;
+  }
+
+private:
+  ValueState m_state = ValueState::Live;
+  bool m_anyLive = false;
+  std::optional<int64_t> m_ageMs;
+};
+
+} // namespace ReactNativeDeviceAiCore
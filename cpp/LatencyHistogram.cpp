@@ -0,0 +1,75 @@
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace ReactNativeDeviceAiCore {
+
+size_t LatencyHistogram::BucketIndex(uint64_t durationNs) noexcept {
+  if (durationNs < kSubBucketCount) {
+    return static_cast<size_t>(durationNs);
+  }
+
+  int exponent = std::bit_width(durationNs) - 1;
+  if (exponent > kMaxExponent) {
+    return kBucketCount - 1;
+  }
+  // The top kSubBucketBits + 1 bits pick the bucket within the power of two
+  int shift = exponent - kSubBucketBits;
+  auto mantissa = static_cast<size_t>(durationNs >> shift);
+  return static_cast<size_t>(shift + 1) * kSubBucketCount + (mantissa - kSubBucketCount);
+}
+
+uint64_t LatencyHistogram::BucketUpperBound(size_t index) noexcept {
+  if (index < 2 * kSubBucketCount) {
+    return index;
+  }
+  auto shift = index / kSubBucketCount - 1;
+  auto mantissa = kSubBucketCount + index % kSubBucketCount;
+  return ((mantissa + 1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(uint64_t durationNs) noexcept {
+  m_buckets[BucketIndex(durationNs)].fetch_add(1, std::memory_order_relaxed);
+  m_sumNs.fetch_add(durationNs, std::memory_order_relaxed);
+
+  auto max = m_maxNs.load(std::memory_order_relaxed);
+  while (durationNs > max && !m_maxNs.compare_exchange_weak(max, durationNs, std::memory_order_relaxed)) {
+  }
+}
+
+HistogramSnapshot LatencyHistogram::Snapshot() const noexcept {
+  std::array<uint64_t, kBucketCount> counts;
+  uint64_t total = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+    total += counts[i];
+  }
+
+  HistogramSnapshot snapshot;
+  snapshot.count = total;
+  snapshot.sumNs = m_sumNs.load(std::memory_order_relaxed);
+  snapshot.maxNs = m_maxNs.load(std::memory_order_relaxed);
+  if (total == 0) {
+    return snapshot;
+  }
+
+  // Nearest-rank percentiles, clamped to the exact maximum
+  auto percentile = [&](double quantile) {
+    auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(quantile * static_cast<double>(total) + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+      seen += counts[i];
+      if (seen >= rank) {
+        return std::min(BucketUpperBound(i), snapshot.maxNs);
+      }
+    }
+    return snapshot.maxNs;
+  };
+  snapshot.p50Ns = percentile(0.50);
+  snapshot.p90Ns = percentile(0.90);
+  snapshot.p99Ns = percentile(0.99);
+  return snapshot;
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ReactNativeDeviceAiCore {
+
+struct HistogramSnapshot {
+  uint64_t count = 0;
+  uint64_t sumNs = 0;
+  uint64_t maxNs = 0;
+  uint64_t p50Ns = 0;
+  uint64_t p90Ns = 0;
+  uint64_t p99Ns = 0;
+};
+
+// HDR-style log-linear histogram of nanosecond durations. Each power of two is
+// split into 32 linear sub-buckets, so a reported percentile is within ~3% of
+// the true value from 1 ns up to ~68 s; longer durations land in the top
+// bucket. Record() is a handful of relaxed atomic increments and never
+// allocates or locks, so any thread may call it. Snapshot() is not atomic
+// across buckets and may miss records that race with it.
+class LatencyHistogram {
+public:
+  static constexpr int kSubBucketBits = 5;
+  static constexpr int kMaxExponent = 36;
+  static constexpr size_t kSubBucketCount = size_t{1} << kSubBucketBits;
+  static constexpr size_t kBucketCount = (kMaxExponent - kSubBucketBits + 2) * kSubBucketCount;
+
+  void Record(uint64_t durationNs) noexcept;
+  HistogramSnapshot Snapshot() const noexcept;
+
+  static size_t BucketIndex(uint64_t durationNs) noexcept;
+  // Largest duration that maps to the bucket
+  static uint64_t BucketUpperBound(size_t index) noexcept;
+
+  // Records in one bucket so far
+  uint64_t BucketCount(size_t index) const noexcept {
+    return m_buckets[index].load(std::memory_order_relaxed);
+  }
+
+private:
+  std::array<std::atomic<uint64_t>, kBucketCount> m_buckets{};
+  std::atomic<uint64_t> m_sumNs{0};
+  std::atomic<uint64_t> m_maxNs{0};
+};
+
+} // namespace ReactNativeDeviceAiCore
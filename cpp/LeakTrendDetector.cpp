@@ -0,0 +1,94 @@
+#include "LeakTrendDetector.h"
+
+#include <cmath>
+
+namespace ReactNativeDeviceAiCore {
+
+const char *ToString(TrendVerdict verdict) noexcept {
+  switch (verdict) {
+    case TrendVerdict::Stable:
+      return "stable";
+    case TrendVerdict::Growing:
+      return "growing";
+    case TrendVerdict::Leaking:
+      return "leaking";
+    default:
+      return "insufficient";
+  }
+}
+
+LeakTrendDetector::LeakTrendDetector(LeakTrendConfig const &config) noexcept : m_config(config) {}
+
+LeakTrend LeakTrendDetector::Add(int64_t timeMs, double value) noexcept {
+  m_times[m_head] = timeMs;
+  m_values[m_head] = value;
+  m_head = (m_head + 1) % kWindow;
+  if (m_count < kWindow) {
+    ++m_count;
+  }
+
+  m_current = Evaluate();
+  return m_current;
+}
+
+LeakTrend LeakTrendDetector::Current() const noexcept {
+  return m_current;
+}
+
+LeakTrend LeakTrendDetector::Evaluate() const noexcept {
+  LeakTrend trend;
+  trend.samples = m_count;
+  if (m_count < 2) {
+    return trend;
+  }
+
+  auto oldest = (m_head + kWindow - m_count) % kWindow;
+  auto t0 = m_times[oldest];
+
+  // Regress in hours relative to the oldest sample to keep the sums well conditioned.
+  double sumT = 0.0, sumV = 0.0, sumTT = 0.0, sumTV = 0.0, sumVV = 0.0;
+  size_t rises = 0;
+  for (size_t i = 0; i < m_count; ++i) {
+    auto index = (oldest + i) % kWindow;
+    double t = (m_times[index] - t0) / 3600000.0;
+    double v = m_values[index];
+    sumT += t;
+    sumV += v;
+    sumTT += t * t;
+    sumTV += t * v;
+    sumVV += v * v;
+    if (i > 0 && v > m_values[(index + kWindow - 1) % kWindow]) {
+      ++rises;
+    }
+  }
+
+  double n = static_cast<double>(m_count);
+  double covTV = sumTV - sumT * sumV / n;
+  double varT = sumTT - sumT * sumT / n;
+  double varV = sumVV - sumV * sumV / n;
+  if (varT <= 0.0) {
+    return trend;
+  }
+
+  trend.slopePerHour = covTV / varT;
+  trend.monotonicFraction = static_cast<double>(rises) / (n - 1.0);
+  trend.rSquared = varV > 0.0 ? (covTV * covTV) / (varT * varV) : 0.0;
+
+  auto newest = (m_head + kWindow - 1) % kWindow;
+  if (m_count < m_config.minSamples || m_times[newest] - t0 < m_config.minSpanMs) {
+    return trend;
+  }
+
+  double mean = sumV / n;
+  double relativeSlope = mean != 0.0 ? trend.slopePerHour / std::fabs(mean) : 0.0;
+  if (relativeSlope < m_config.minRelativeSlopePerHour) {
+    trend.verdict = TrendVerdict::Stable;
+  } else if (trend.monotonicFraction >= m_config.minMonotonicFraction && trend.rSquared >= m_config.minRSquared) {
+    trend.verdict = TrendVerdict::Leaking;
+  } else {
+    trend.verdict = TrendVerdict::Growing;
+  }
+  return trend;
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ReactNativeDeviceAiCore {
+
+enum class TrendVerdict { Insufficient, Stable, Growing, Leaking };
+
+const char *ToString(TrendVerdict verdict) noexcept;
+
+struct LeakTrendConfig {
+  size_t minSamples = 10;
+  int64_t minSpanMs = 60 * 1000;
+  // Growth below this share of the window mean per hour is treated as noise.
+  double minRelativeSlopePerHour = 0.05;
+  // A leak grows steadily: most steps go up and a straight line explains the window.
+  double minMonotonicFraction = 0.7;
+  double minRSquared = 0.8;
+};
+
+struct LeakTrend {
+  TrendVerdict verdict = TrendVerdict::Insufficient;
+  double slopePerHour = 0.0;
+  double monotonicFraction = 0.0;
+  double rSquared = 0.0;
+  size_t samples = 0;
+};
+
+// Least-squares growth detector over a sliding window of timestamped samples.
+// Storage is fixed so a tracker per process counter costs a few kilobytes.
+class LeakTrendDetector {
+public:
+  static constexpr size_t kWindow = 120;
+
+  explicit LeakTrendDetector(LeakTrendConfig const &config = {}) noexcept;
+
+  LeakTrend Add(int64_t timeMs, double value) noexcept;
+  LeakTrend Current() const noexcept;
+
+private:
+  LeakTrend Evaluate() const noexcept;
+
+  LeakTrendConfig m_config;
+  std::array<int64_t, kWindow> m_times{};
+  std::array<double, kWindow> m_values{};
+  size_t m_head = 0;
+  size_t m_count = 0;
+  LeakTrend m_current;
+};
+
+} // namespace ReactNativeDeviceAiCore
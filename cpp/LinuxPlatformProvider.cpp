@@ -0,0 +1,358 @@
+#include "LinuxPlatformProvider.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <sys/statvfs.h>
+#include <sys/utsname.h>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+std::optional<std::string> ReadFile(std::string const &path) {
+  std::ifstream file(path);
+  if (!file) {
+    return std::nullopt;
+  }
+  std::ostringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+std::string Trim(std::string_view text) {
+  auto begin = text.find_first_not_of(" \t\r\n");
+  if (begin == std::string_view::npos) {
+    return {};
+  }
+  auto end = text.find_last_not_of(" \t\r\n");
+  return std::string(text.substr(begin, end - begin + 1));
+}
+
+std::optional<std::string> ReadTrimmed(std::string const &path) {
+  auto content = ReadFile(path);
+  if (!content) {
+    return std::nullopt;
+  }
+  return Trim(*content);
+}
+
+// Value of a "Key: value" line, as in /proc/meminfo and /proc/cpuinfo
+std::optional<std::string> FindKey(std::string const &content, std::string_view key) {
+  std::istringstream lines(content);
+  std::string line;
+  while (std::getline(lines, line)) {
+    auto colon = line.find(':');
+    if (colon != std::string::npos && Trim(std::string_view(line).substr(0, colon)) == key) {
+      return Trim(std::string_view(line).substr(colon + 1));
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<double> MeminfoBytes(std::string const &meminfo, std::string_view key) {
+  auto value = FindKey(meminfo, key);
+  if (!value) {
+    return std::nullopt;
+  }
+  try {
+    // Values are in kB regardless of the unit column
+    return static_cast<double>(std::stoull(*value)) * 1024.0;
+  } catch (...) {
+    return std::nullopt;
+  }
+}
+
+int64_t SteadyNowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Interface carrying the default route in /proc/net/route, the Linux
+// counterpart of the Windows internet connection profile
+std::optional<std::string> DefaultRouteInterface(std::string const &routes) {
+  constexpr unsigned kRouteUp = 0x1;
+  std::istringstream lines(routes);
+  std::string line;
+  std::getline(lines, line); // header
+  while (std::getline(lines, line)) {
+    std::istringstream fields(line);
+    std::string iface, destination, gateway;
+    unsigned flags = 0;
+    if (fields >> iface >> destination >> gateway >> std::hex >> flags && destination == "00000000" && (flags & kRouteUp)) {
+      return iface;
+    }
+  }
+  return std::nullopt;
+}
+
+std::string ArchitectureName(std::string_view machine) {
+  if (machine == "x86_64") {
+    return "x64";
+  }
+  if (machine == "aarch64" || machine == "arm64") {
+    return "ARM64";
+  }
+  if (machine.size() == 4 && machine[0] == 'i' && machine.substr(2) == "86") {
+    return "x86";
+  }
+  if (machine.starts_with("arm")) {
+    return "ARM";
+  }
+  return std::string(machine);
+}
+
+} // namespace
+
+LinuxPlatformProvider::LinuxPlatformProvider(std::string rootPath, std::string storagePath)
+    : m_rootPath(std::move(rootPath)), m_storagePath(std::move(storagePath)) {
+  // Prime the rate counters so the first reads measure from here
+  if (auto times = ReadCpuTimes()) {
+    m_cpuBaseline = *times;
+    m_counterCpuBaseline = *times;
+  }
+  m_diskBaseline = ReadDiskTimes();
+}
+
+MemoryReading LinuxPlatformProvider::ReadMemory() {
+  MemoryReading reading;
+  if (auto meminfo = ReadFile(Path("/proc/meminfo"))) {
+    reading.total = {MeminfoBytes(*meminfo, "MemTotal"), "/proc/meminfo"};
+    reading.available = {MeminfoBytes(*meminfo, "MemAvailable"), "/proc/meminfo"};
+  }
+  return reading;
+}
+
+StorageReading LinuxPlatformProvider::ReadStorage() {
+  StorageReading reading;
+  struct statvfs stats {};
+  if (statvfs(m_storagePath.c_str(), &stats) == 0) {
+    auto blockSize = static_cast<double>(stats.f_frsize ? stats.f_frsize : stats.f_bsize);
+    reading.total = {static_cast<double>(stats.f_blocks) * blockSize, "statvfs"};
+    reading.available = {static_cast<double>(stats.f_bavail) * blockSize, "statvfs"};
+  }
+  return reading;
+}
+
+BatteryReading LinuxPlatformProvider::ReadBattery() {
+  BatteryReading reading;
+  std::error_code error;
+  std::filesystem::directory_iterator supplies(Path("/sys/class/power_supply"), error);
+  if (error) {
+    return reading;
+  }
+
+  for (auto const &supply : supplies) {
+    auto base = supply.path().string();
+    if (ReadTrimmed(base + "/type") != "Battery") {
+      continue;
+    }
+    if (auto capacity = ReadTrimmed(base + "/capacity")) {
+      try {
+        reading.level = {std::stod(*capacity), "/sys/class/power_supply"};
+      } catch (...) {
+      }
+    }
+    if (auto status = ReadTrimmed(base + "/status")) {
+      reading.charging = {*status == "Charging", "/sys/class/power_supply"};
+    }
+    return reading;
+  }
+
+  // No battery: mains-powered, reported as full and not charging like Windows desktops
+  reading.level = {100.0, "/sys/class/power_supply"};
+  reading.charging = {false, "/sys/class/power_supply"};
+  return reading;
+}
+
+std::optional<LinuxPlatformProvider::CpuTimes> LinuxPlatformProvider::ReadCpuTimes() const {
+  auto stat = ReadFile(Path("/proc/stat"));
+  if (!stat) {
+    return std::nullopt;
+  }
+  std::istringstream line(stat->substr(0, stat->find('\n')));
+  std::string label;
+  uint64_t user = 0, nice = 0, system = 0, idle = 0, iowait = 0, irq = 0, softirq = 0, steal = 0;
+  if (!(line >> label >> user >> nice >> system >> idle) || label != "cpu") {
+    return std::nullopt;
+  }
+  // Older kernels stop after idle; guest time is already counted in user
+  line >> iowait >> irq >> softirq >> steal;
+  CpuTimes times;
+  times.total = user + nice + system + idle + iowait + irq + softirq + steal;
+  times.busy = times.total - idle - iowait;
+  return times;
+}
+
+std::optional<double> LinuxPlatformProvider::CpuUsageSince(CpuTimes &baseline) {
+  auto current = ReadCpuTimes();
+  if (!current) {
+    return std::nullopt;
+  }
+  std::lock_guard lock(m_mutex);
+  if (current->total <= baseline.total) {
+    // Less than a clock tick since the last read; nothing new to report
+    return std::nullopt;
+  }
+  auto busy = static_cast<double>(current->busy - std::min(current->busy, baseline.busy));
+  auto usage = 100.0 * busy / static_cast<double>(current->total - baseline.total);
+  baseline = *current;
+  return std::clamp(usage, 0.0, 100.0);
+}
+
+CpuReading LinuxPlatformProvider::ReadCpu() {
+  CpuReading reading;
+  reading.usage = {CpuUsageSince(m_cpuBaseline), "/proc/stat"};
+
+  if (auto stat = ReadFile(Path("/proc/stat"))) {
+    // One "cpuN" line per online CPU after the aggregate "cpu" line
+    double cores = 0;
+    std::istringstream lines(*stat);
+    std::string line;
+    while (std::getline(lines, line)) {
+      if (line.size() > 3 && line.starts_with("cpu") && std::isdigit(static_cast<unsigned char>(line[3]))) {
+        ++cores;
+      }
+    }
+    if (cores > 0) {
+      reading.cores = {cores, "/proc/stat"};
+    }
+  }
+  return reading;
+}
+
+NetworkReading LinuxPlatformProvider::ReadNetwork() {
+  NetworkReading reading;
+  auto routes = ReadFile(Path("/proc/net/route"));
+  if (!routes) {
+    return reading;
+  }
+
+  auto iface = DefaultRouteInterface(*routes);
+  reading.connected = {iface.has_value(), "/proc/net/route"};
+  if (!iface) {
+    reading.type = {std::string("none"), "/proc/net/route"};
+    return reading;
+  }
+
+  auto base = Path("/sys/class/net/") + *iface;
+  std::error_code error;
+  std::string type = "unknown";
+  if (std::filesystem::exists(base + "/wireless", error) || std::filesystem::exists(base + "/phy80211", error)) {
+    type = "wifi";
+  } else if (iface->starts_with("wwan")) {
+    type = "cellular";
+  } else if (ReadTrimmed(base + "/type") == "1") {
+    // ARPHRD_ETHER
+    type = "ethernet";
+  }
+  reading.type = {std::move(type), "/sys/class/net"};
+  return reading;
+}
+
+std::optional<LinuxPlatformProvider::DiskTimes> LinuxPlatformProvider::ReadDiskTimes() const {
+  auto diskstats = ReadFile(Path("/proc/diskstats"));
+  if (!diskstats) {
+    return std::nullopt;
+  }
+
+  DiskTimes times;
+  times.atMs = SteadyNowMs();
+  std::istringstream lines(*diskstats);
+  std::string line;
+  while (std::getline(lines, line)) {
+    std::istringstream fields(line);
+    unsigned major = 0, minor = 0;
+    std::string name;
+    uint64_t stats[10] = {};
+    if (!(fields >> major >> minor >> name)) {
+      continue;
+    }
+    for (auto &stat : stats) {
+      fields >> stat;
+    }
+    // Only whole physical disks have a device link; partitions, loop and dm devices are skipped
+    std::error_code error;
+    if (!fields || !std::filesystem::exists(Path("/sys/block/") + name + "/device", error)) {
+      continue;
+    }
+    // Tenth field: milliseconds spent doing I/O
+    times.ioMs += stats[9];
+    ++times.disks;
+  }
+  if (times.disks == 0) {
+    return std::nullopt;
+  }
+  return times;
+}
+
+CounterReading LinuxPlatformProvider::ReadPerformanceCounters() {
+  CounterReading reading;
+  reading.cpuUsage = {CpuUsageSince(m_counterCpuBaseline), "/proc/stat"};
+
+  // Committed memory against the commit limit, like Windows commit usage
+  if (auto meminfo = ReadFile(Path("/proc/meminfo"))) {
+    auto committed = MeminfoBytes(*meminfo, "Committed_AS");
+    auto limit = MeminfoBytes(*meminfo, "CommitLimit");
+    if (committed && limit && *limit > 0) {
+      reading.memoryUsage = {100.0 * *committed / *limit, "/proc/meminfo"};
+    }
+  }
+
+  // Average percent of time the disks were busy, like % Disk Time
+  if (auto current = ReadDiskTimes()) {
+    std::lock_guard lock(m_mutex);
+    if (m_diskBaseline && m_diskBaseline->disks == current->disks && current->atMs > m_diskBaseline->atMs) {
+      auto ioMs = static_cast<double>(current->ioMs - std::min(current->ioMs, m_diskBaseline->ioMs));
+      auto elapsedMs = static_cast<double>(current->atMs - m_diskBaseline->atMs) * current->disks;
+      reading.diskUsage = {std::clamp(100.0 * ioMs / elapsedMs, 0.0, 100.0), "/proc/diskstats"};
+    }
+    m_diskBaseline = current;
+  }
+  return reading;
+}
+
+WmiReading LinuxPlatformProvider::ReadWmi() {
+  WmiReading reading;
+  reading.computerSystem = {ReadTrimmed(Path("/sys/class/dmi/id/product_name")), "/sys/class/dmi"};
+
+  if (auto osRelease = ReadFile(Path("/etc/os-release"))) {
+    std::istringstream lines(*osRelease);
+    std::string line;
+    while (std::getline(lines, line)) {
+      if (line.starts_with("PRETTY_NAME=")) {
+        auto value = Trim(std::string_view(line).substr(std::strlen("PRETTY_NAME=")));
+        if (value.size() >= 2 && (value.front() == '"' || value.front() == '\'') && value.back() == value.front()) {
+          value = value.substr(1, value.size() - 2);
+        }
+        reading.operatingSystem = {std::move(value), "/etc/os-release"};
+        break;
+      }
+    }
+  }
+
+  if (auto cpuinfo = ReadFile(Path("/proc/cpuinfo"))) {
+    reading.processor = {FindKey(*cpuinfo, "model name"), "/proc/cpuinfo"};
+  }
+  return reading;
+}
+
+IdentityReading LinuxPlatformProvider::ReadIdentity() {
+  IdentityReading reading;
+  struct utsname names {};
+  if (uname(&names) == 0) {
+    reading.osVersion = {std::string(names.release), "uname"};
+    reading.buildNumber = {std::string(names.version), "uname"};
+    reading.architecture = {ArchitectureName(names.machine), "uname"};
+  }
+  if (auto cpuinfo = ReadFile(Path("/proc/cpuinfo"))) {
+    reading.processor = {FindKey(*cpuinfo, "model name"), "/proc/cpuinfo"};
+  }
+  return reading;
+}
+
+} // namespace ReactNativeDeviceAiCore
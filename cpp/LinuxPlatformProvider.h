@@ -0,0 +1,66 @@
+#pragma once
+
+#include "PlatformProvider.h"
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace ReactNativeDeviceAiCore {
+
+// Linux counterpart of the Win32 reads, from /proc, /sys, /etc/os-release,
+// statvfs and uname. rootPath prefixes every file path so tests can point it
+// at a fixture tree; storagePath is the mount whose capacity is reported.
+//
+// CPU and disk usage are rates, measured between consecutive reads rather
+// than by sleeping between two samples: the first read after construction
+// covers the time since the constructor primed the counters.
+class LinuxPlatformProvider final : public PlatformProvider {
+public:
+  explicit LinuxPlatformProvider(std::string rootPath = "", std::string storagePath = "/");
+
+  const char *Name() const noexcept override {
+    return "linux";
+  }
+
+  MemoryReading ReadMemory() override;
+  StorageReading ReadStorage() override;
+  BatteryReading ReadBattery() override;
+  CpuReading ReadCpu() override;
+  NetworkReading ReadNetwork() override;
+  CounterReading ReadPerformanceCounters() override;
+  WmiReading ReadWmi() override;
+  IdentityReading ReadIdentity() override;
+
+private:
+  struct CpuTimes {
+    uint64_t busy = 0;
+    uint64_t total = 0;
+  };
+
+  struct DiskTimes {
+    uint64_t ioMs = 0;
+    uint32_t disks = 0;
+    int64_t atMs = 0;
+  };
+
+  std::string Path(char const *path) const {
+    return m_rootPath + path;
+  }
+
+  std::optional<CpuTimes> ReadCpuTimes() const;
+  std::optional<DiskTimes> ReadDiskTimes() const;
+  // Percent busy since the previous call that used the same baseline
+  std::optional<double> CpuUsageSince(CpuTimes &baseline);
+
+  std::string const m_rootPath;
+  std::string const m_storagePath;
+
+  std::mutex m_mutex;
+  CpuTimes m_cpuBaseline;
+  CpuTimes m_counterCpuBaseline;
+  std::optional<DiskTimes> m_diskBaseline;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,38 @@
+#include "MemoryBreakdown.h"
+
+namespace ReactNativeDeviceAiCore {
+
+MemoryBreakdown FaultRateTracker::Update(MemoryCounters const &counters, int64_t nowMs) noexcept {
+  MemoryBreakdown breakdown;
+  breakdown.counters = counters;
+  if (counters.commitLimit > 0) {
+    breakdown.commitPercent = 100.0 * static_cast<double>(counters.commitTotal) / static_cast<double>(counters.commitLimit);
+  }
+
+  auto elapsedMs = nowMs - m_previousMs;
+  if (m_hasPrevious && elapsedMs > 0) {
+    // Unsigned subtraction keeps the delta correct across a 32-bit wrap.
+    uint32_t pageFaults = counters.pageFaultCount - m_previousPageFaults;
+    uint32_t hardFaults = counters.hardFaultCount - m_previousHardFaults;
+    m_pageFaultsPerSec = pageFaults * 1000.0 / elapsedMs;
+    m_hardFaultsPerSec = hardFaults * 1000.0 / elapsedMs;
+  }
+
+  // Calls closer together than the clock resolution reuse the last rate.
+  if (!m_hasPrevious || elapsedMs > 0) {
+    m_hasPrevious = true;
+    m_previousMs = nowMs;
+    m_previousPageFaults = counters.pageFaultCount;
+    m_previousHardFaults = counters.hardFaultCount;
+  }
+
+  breakdown.pageFaultsPerSec = m_pageFaultsPerSec;
+  breakdown.hardFaultsPerSec = m_hardFaultsPerSec;
+  return breakdown;
+}
+
+void FaultRateTracker::Reset() noexcept {
+  *this = FaultRateTracker{};
+}
+
+} // namespace ReactNativeDeviceAiCore
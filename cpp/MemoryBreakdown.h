@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace ReactNativeDeviceAiCore {
+
+// Raw memory counters read from the OS in a single pass. Byte values are
+// instantaneous; fault counts are cumulative since boot and may wrap at 32 bits.
+struct MemoryCounters {
+  uint64_t totalPhys = 0;
+  uint64_t availablePhys = 0;
+  uint64_t commitTotal = 0;
+  uint64_t commitLimit = 0;
+  uint64_t commitPeak = 0;
+  uint64_t systemCache = 0;
+  uint64_t kernelPaged = 0;
+  uint64_t kernelNonpaged = 0;
+  // Page-list sizes need a privileged query on Windows and are absent when it is denied.
+  std::optional<uint64_t> standbyList;
+  std::optional<uint64_t> modifiedList;
+  uint32_t pageFaultCount = 0;
+  uint32_t hardFaultCount = 0;
+};
+
+struct MemoryBreakdown {
+  MemoryCounters counters;
+  double commitPercent = 0.0;
+  double pageFaultsPerSec = 0.0;
+  double hardFaultsPerSec = 0.0;
+};
+
+// Turns successive cumulative fault counters into per-second rates. Not
+// thread-safe; callers serialize Update.
+class FaultRateTracker {
+public:
+  MemoryBreakdown Update(MemoryCounters const &counters, int64_t nowMs) noexcept;
+  void Reset() noexcept;
+
+private:
+  bool m_hasPrevious = false;
+  int64_t m_previousMs = 0;
+  uint32_t m_previousPageFaults = 0;
+  uint32_t m_previousHardFaults = 0;
+  double m_pageFaultsPerSec = 0.0;
+  double m_hardFaultsPerSec = 0.0;
+};
+
+} // namespace ReactNativeDeviceAiCore
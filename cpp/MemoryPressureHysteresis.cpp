@@ -0,0 +1,48 @@
+#include "MemoryPressureHysteresis.h"
+
+namespace ReactNativeDeviceAiCore {
+
+const char *ToString(MemoryPressureLevel level) noexcept {
+  return level == MemoryPressureLevel::Low ? "low" : "normal";
+}
+
+MemoryPressureHysteresis::MemoryPressureHysteresis(int64_t recoveryHoldMs) noexcept
+    : m_recoveryHoldMs(recoveryHoldMs) {}
+
+std::optional<MemoryPressureLevel> MemoryPressureHysteresis::Observe(MemoryPressureLevel observed, int64_t nowMs) noexcept {
+  if (observed == MemoryPressureLevel::Low) {
+    m_clearSinceMs.reset();
+    if (m_level == MemoryPressureLevel::Low) {
+      return std::nullopt;
+    }
+    m_level = MemoryPressureLevel::Low;
+    ++m_transitions;
+    return m_level;
+  }
+
+  if (m_level == MemoryPressureLevel::Normal) {
+    return std::nullopt;
+  }
+
+  if (!m_clearSinceMs) {
+    m_clearSinceMs = nowMs;
+  }
+  if (nowMs - *m_clearSinceMs < m_recoveryHoldMs) {
+    return std::nullopt;
+  }
+
+  m_level = MemoryPressureLevel::Normal;
+  m_clearSinceMs.reset();
+  ++m_transitions;
+  return m_level;
+}
+
+MemoryPressureLevel MemoryPressureHysteresis::Level() const noexcept {
+  return m_level;
+}
+
+uint64_t MemoryPressureHysteresis::Transitions() const noexcept {
+  return m_transitions;
+}
+
+} // namespace ReactNativeDeviceAiCore
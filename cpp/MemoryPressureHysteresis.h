@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace ReactNativeDeviceAiCore {
+
+enum class MemoryPressureLevel { Normal, Low };
+
+const char *ToString(MemoryPressureLevel level) noexcept;
+
+// Debounces raw low-memory observations into pressure transitions. Entering
+// Low is reported immediately so the app can shed memory right away; leaving it
+// requires the condition to stay clear for recoveryHoldMs, so a system hovering
+// around the OS threshold produces one Low/Normal pair instead of a storm.
+class MemoryPressureHysteresis {
+public:
+  explicit MemoryPressureHysteresis(int64_t recoveryHoldMs = 5000) noexcept;
+
+  // Returns the new level when this observation completes a transition.
+  std::optional<MemoryPressureLevel> Observe(MemoryPressureLevel observed, int64_t nowMs) noexcept;
+
+  MemoryPressureLevel Level() const noexcept;
+  uint64_t Transitions() const noexcept;
+
+private:
+  int64_t const m_recoveryHoldMs;
+  MemoryPressureLevel m_level = MemoryPressureLevel::Normal;
+  std::optional<int64_t> m_clearSinceMs;
+  uint64_t m_transitions = 0;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,373 @@
+#include "MetricHistory.h"
+
+#include "GorillaCodec.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ReactNativeDeviceAiCore {
+
+HistoryBlock HistoryBlock::Seal(std::span<int64_t const> timesMs, std::array<std::vector<double>, kMetricCount> const &values) {
+  HistoryBlock block;
+  block.rows = timesMs.size();
+  if (block.rows == 0) {
+    return block;
+  }
+  block.firstMs = timesMs.front();
+  block.lastMs = timesMs.back();
+
+  Gorilla::EncodeTimestamps(timesMs, block.bytes);
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    block.offsets[i + 1] = static_cast<uint32_t>(block.bytes.size());
+    Gorilla::EncodeValues(std::span<double const>(values[i]).first(block.rows), block.bytes);
+  }
+  block.offsets[kMetricCount + 1] = static_cast<uint32_t>(block.bytes.size());
+  block.bytes.shrink_to_fit();
+  return block;
+}
+
+bool HistoryBlock::DecodeTimes(int64_t *out) const {
+  std::span<uint8_t const> column(bytes.data() + offsets[0], offsets[1] - offsets[0]);
+  return rows == 0 || Gorilla::DecodeTimestamps(column, rows, out) != 0;
+}
+
+bool HistoryBlock::DecodeValues(Metric metric, double *out) const {
+  auto index = static_cast<size_t>(metric) + 1;
+  std::span<uint8_t const> column(bytes.data() + offsets[index], offsets[index + 1] - offsets[index]);
+  return rows == 0 || Gorilla::DecodeValues(column, rows, out) != 0;
+}
+
+MetricHistory::MetricHistory(size_t capacity, size_t blockRows, std::span<RollupTierConfig const> tiers)
+    : m_capacity(std::max<size_t>(capacity, 1)), m_blockRows(std::max<size_t>(blockRows, 1)), m_rollup(tiers) {
+  m_openTimes.reserve(m_blockRows);
+  for (auto &column : m_openValues) {
+    column.reserve(m_blockRows);
+  }
+}
+
+std::array<double, kMetricCount> LiveValues(DeviceSnapshot const &snapshot) noexcept {
+  std::array<double, kMetricCount> values;
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    auto const &value = snapshot.metrics[i];
+    values[i] = value.state == ValueState::Live ? value.value : std::numeric_limits<double>::quiet_NaN();
+  }
+  return values;
+}
+
+void MetricHistory::Append(int64_t timeMs, DeviceSnapshot const &snapshot) {
+  Append(timeMs, LiveValues(snapshot));
+}
+
+void MetricHistory::Append(int64_t timeMs, std::span<double const, kMetricCount> values) {
+  std::lock_guard lock(m_mutex);
+  if (!m_openTimes.empty()) {
+    timeMs = std::max(timeMs, m_openTimes.back());
+  } else if (!m_blocks.empty()) {
+    timeMs = std::max(timeMs, m_blocks.back()->lastMs);
+  }
+
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    m_openValues[i].push_back(values[i]);
+  }
+  m_openTimes.push_back(timeMs);
+  m_rollup.Add(timeMs, values);
+  ++m_appended;
+  if (OpenRows() >= m_blockRows) {
+    SealOpenBlock();
+  }
+
+  // Drop blocks once the newer rows alone cover the capacity
+  while (!m_blocks.empty() && m_sealedRows - m_blocks.front()->rows + OpenRows() >= m_capacity) {
+    m_sealedRows -= m_blocks.front()->rows;
+    m_blocks.pop_front();
+  }
+}
+
+void MetricHistory::SealOpenBlock() {
+  auto block = std::make_shared<HistoryBlock const>(HistoryBlock::Seal(m_openTimes, m_openValues));
+  m_sealedRows += block->rows;
+  m_blocks.push_back(std::move(block));
+  m_openTimes.clear();
+  for (auto &column : m_openValues) {
+    column.clear();
+  }
+}
+
+size_t MetricHistory::Size() const {
+  std::lock_guard lock(m_mutex);
+  return std::min(m_sealedRows + OpenRows(), m_capacity);
+}
+
+size_t MetricHistory::Blocks() const {
+  std::lock_guard lock(m_mutex);
+  return m_blocks.size();
+}
+
+std::shared_ptr<HistoryBlock const> MetricHistory::Block(size_t index) const {
+  std::lock_guard lock(m_mutex);
+  return index < m_blocks.size() ? m_blocks[index] : nullptr;
+}
+
+HistoryStats MetricHistory::Stats() const {
+  std::lock_guard lock(m_mutex);
+  HistoryStats stats;
+  stats.rows = std::min(m_sealedRows + OpenRows(), m_capacity);
+  stats.blocks = m_blocks.size();
+  stats.sealedRows = m_sealedRows;
+  for (auto const &block : m_blocks) {
+    stats.sealedBytes += block->bytes.size();
+  }
+  stats.openBytes = OpenRows() * (kMetricCount + 1) * sizeof(double);
+  return stats;
+}
+
+int64_t MetricHistory::OldestRowMs() const {
+  auto total = m_sealedRows + OpenRows();
+  auto skip = total > m_capacity ? total - m_capacity : 0;
+  if (m_blocks.empty()) {
+    return m_openTimes.empty() ? std::numeric_limits<int64_t>::max() : m_openTimes[skip];
+  }
+  // Blocks are only kept while they hold visible rows, so it is in the front one
+  auto const &front = *m_blocks.front();
+  if (skip == 0) {
+    return front.firstMs;
+  }
+  std::vector<int64_t> times(front.rows);
+  return front.DecodeTimes(times.data()) ? times[std::min(skip, front.rows - 1)] : front.lastMs;
+}
+
+std::pair<int64_t, int64_t> MetricHistory::BoundsLocked() const {
+  if (m_appended == 0) {
+    return {std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()};
+  }
+  auto oldestMs = OldestRowMs();
+  for (size_t tier = 0; tier < m_rollup.Tiers(); ++tier) {
+    oldestMs = std::min(oldestMs, m_rollup.OldestMs(tier));
+  }
+  auto newestMs = m_openTimes.empty() ? m_blocks.back()->lastMs : m_openTimes.back();
+  return {oldestMs, newestMs};
+}
+
+size_t MetricHistory::EstimateRowsLocked(int64_t fromMs, int64_t toMs) const {
+  auto visible = std::min(m_sealedRows + OpenRows(), m_capacity);
+  if (visible == 0) {
+    return 0;
+  }
+  // Kept blocks may start before the oldest visible row; their rows count too
+  auto oldestMs = m_blocks.empty() ? m_openTimes.front() : m_blocks.front()->firstMs;
+  auto newestMs = m_openTimes.empty() ? m_blocks.back()->lastMs : m_openTimes.back();
+  fromMs = std::max(fromMs, oldestMs);
+  toMs = std::min(toMs, newestMs);
+  if (toMs < fromMs) {
+    return 0;
+  }
+  if (newestMs == oldestMs) {
+    return visible;
+  }
+  auto share = static_cast<double>(toMs - fromMs) / static_cast<double>(newestMs - oldestMs);
+  auto estimate = static_cast<size_t>(share * static_cast<double>(m_sealedRows + OpenRows())) + 1;
+  return std::min(estimate, visible);
+}
+
+size_t MetricHistory::SourceLocked(int64_t fromMs, int64_t stepMs) const {
+  // The coarsest source fine enough
+  size_t source = 0;
+  for (size_t tier = 0; tier < m_rollup.Tiers(); ++tier) {
+    if (m_rollup.StepMs(tier) <= stepMs) {
+      source = tier + 1;
+    }
+  }
+
+  // Then coarser ones until one reaches back far enough
+  fromMs = std::max(fromMs, BoundsLocked().first);
+  auto covers = [&](size_t candidate) {
+    return candidate == 0 ? m_appended <= m_capacity || OldestRowMs() <= fromMs : m_rollup.Covers(candidate - 1, fromMs);
+  };
+  while (source < m_rollup.Tiers() && !covers(source)) {
+    ++source;
+  }
+  return source;
+}
+
+std::pair<int64_t, int64_t> MetricHistory::Bounds() const {
+  std::lock_guard lock(m_mutex);
+  return BoundsLocked();
+}
+
+size_t MetricHistory::SourceFor(int64_t fromMs, int64_t stepMs) const {
+  std::lock_guard lock(m_mutex);
+  return SourceLocked(fromMs, stepMs);
+}
+
+int64_t MetricHistory::SourceStepMs(size_t source) const noexcept {
+  return source == 0 || source > m_rollup.Tiers() ? 0 : m_rollup.StepMs(source - 1);
+}
+
+void MetricHistory::ScanRollup(size_t tier, int64_t fromMs, int64_t toMs, MetricRollup::BucketVisitor const &visit) const {
+  std::lock_guard lock(m_mutex);
+  if (tier < m_rollup.Tiers()) {
+    m_rollup.ForEachBucket(tier, fromMs, toMs, visit);
+  }
+}
+
+RollupWindow MetricHistory::Rollup(RollupQuery const &query) const {
+  {
+    std::lock_guard lock(m_mutex);
+    if (m_appended == 0) {
+      RollupWindow window;
+      window.series.resize(query.metrics.size());
+      for (size_t s = 0; s < query.metrics.size(); ++s) {
+        window.series[s].metric = query.metrics[s];
+      }
+      return window;
+    }
+
+    // The part of the range that has data decides the resolution
+    auto [oldestMs, newestMs] = BoundsLocked();
+    auto fromMs = std::max(query.fromMs, oldestMs);
+    auto toMs = std::min(query.toMs, newestMs);
+    auto targetStepMs = query.maxPoints == 0 || toMs <= fromMs ? 0 : (toMs - fromMs) / static_cast<int64_t>(query.maxPoints);
+    if (auto source = SourceLocked(fromMs, targetStepMs); source > 0) {
+      return m_rollup.Query(source - 1, query);
+    }
+  }
+
+  // Raw rows are decoded outside the lock, as for Query()
+  HistoryQuery raw;
+  raw.metrics = query.metrics;
+  raw.fromMs = query.fromMs;
+  raw.toMs = query.toMs;
+  auto rows = Query(raw);
+
+  RollupWindow window;
+  window.timestampsMs = std::move(rows.timestampsMs);
+  window.series.resize(rows.series.size());
+  for (size_t s = 0; s < rows.series.size(); ++s) {
+    auto &series = window.series[s];
+    auto &values = rows.series[s].values;
+    series.metric = rows.series[s].metric;
+    series.count.reserve(values.size());
+    for (auto value : values) {
+      series.count.push_back(std::isnan(value) ? 0 : 1);
+    }
+    series.min = values;
+    series.max = values;
+    series.quantiles.assign(query.quantiles.size(), values);
+    series.mean = std::move(values);
+  }
+  return window;
+}
+
+void MetricHistory::Scan(std::span<Metric const> metrics, int64_t fromMs, int64_t toMs, RowVisitor const &visit) const {
+  // Sealed blocks overlapping the range are only referenced under the lock;
+  // the open block is small and copied
+  std::vector<std::pair<std::shared_ptr<HistoryBlock const>, size_t>> blocks;
+  std::vector<int64_t> openTimes;
+  std::array<std::vector<double>, kMetricCount> openValues;
+  size_t openSkip = 0;
+  {
+    std::lock_guard lock(m_mutex);
+    auto total = m_sealedRows + OpenRows();
+    auto skip = total > m_capacity ? total - m_capacity : 0;
+
+    size_t firstRow = 0;
+    for (auto const &block : m_blocks) {
+      auto blockSkip = skip > firstRow ? std::min(skip - firstRow, block->rows) : 0;
+      if (blockSkip < block->rows && block->lastMs >= fromMs && block->firstMs <= toMs) {
+        blocks.emplace_back(block, blockSkip);
+      }
+      firstRow += block->rows;
+    }
+
+    openSkip = skip > firstRow ? skip - firstRow : 0;
+    if (openSkip < OpenRows() && m_openTimes.back() >= fromMs && m_openTimes.front() <= toMs) {
+      openTimes = m_openTimes;
+      for (auto metric : metrics) {
+        openValues[static_cast<size_t>(metric)] = m_openValues[static_cast<size_t>(metric)];
+      }
+    }
+  }
+
+  // Passes on rows [begin, end) of one block's columns that fall in the range
+  std::vector<double const *> columns(metrics.size());
+  auto visitRows = [&](int64_t const *times, size_t begin, size_t end, auto &&valueColumn) {
+    begin = static_cast<size_t>(std::lower_bound(times + begin, times + end, fromMs) - times);
+    end = static_cast<size_t>(std::upper_bound(times + begin, times + end, toMs) - times);
+    if (begin >= end) {
+      return;
+    }
+    for (size_t s = 0; s < metrics.size(); ++s) {
+      columns[s] = valueColumn(metrics[s]) + begin;
+    }
+    visit(std::span<int64_t const>(times + begin, end - begin), columns);
+  };
+
+  std::vector<int64_t> times;
+  std::array<std::vector<double>, kMetricCount> decoded;
+  for (auto const &[block, blockSkip] : blocks) {
+    times.resize(block->rows);
+    if (!block->DecodeTimes(times.data())) {
+      continue;
+    }
+    bool intact = true;
+    for (auto metric : metrics) {
+      auto &column = decoded[static_cast<size_t>(metric)];
+      column.resize(block->rows);
+      intact = intact && block->DecodeValues(metric, column.data());
+    }
+    if (intact) {
+      visitRows(times.data(), blockSkip, block->rows, [&](Metric metric) { return decoded[static_cast<size_t>(metric)].data(); });
+    }
+  }
+  if (!openTimes.empty()) {
+    visitRows(openTimes.data(), openSkip, openTimes.size(), [&](Metric metric) { return openValues[static_cast<size_t>(metric)].data(); });
+  }
+}
+
+HistoryWindow MetricHistory::Query(HistoryQuery const &query) const {
+  HistoryWindow window;
+  window.series.resize(query.metrics.size());
+  for (size_t s = 0; s < query.metrics.size(); ++s) {
+    window.series[s].metric = query.metrics[s];
+  }
+
+  // Sized for the window rather than the whole history; uneven spacing only
+  // costs a reallocation
+  size_t rows = 0;
+  {
+    std::lock_guard lock(m_mutex);
+    rows = EstimateRowsLocked(query.fromMs, query.toMs);
+  }
+  window.timestampsMs.reserve(rows);
+  for (auto &series : window.series) {
+    series.values.reserve(rows);
+  }
+
+  Scan(query.metrics, query.fromMs, query.toMs, [&](std::span<int64_t const> times, std::span<double const *const> columns) {
+    for (auto time : times) {
+      window.timestampsMs.push_back(static_cast<double>(time));
+    }
+    for (size_t s = 0; s < columns.size(); ++s) {
+      window.series[s].values.insert(window.series[s].values.end(), columns[s], columns[s] + times.size());
+    }
+  });
+
+  // Decimation runs on the copies
+  if (query.maxPoints == 0 || query.mode == DownsampleMode::None || window.timestampsMs.size() <= query.maxPoints) {
+    return window;
+  }
+  window.decimated = true;
+  for (auto &series : window.series) {
+    auto indices = DownsampleIndices(query.mode, window.timestampsMs, series.values, query.maxPoints);
+    std::vector<double> values(indices.size());
+    series.timestampsMs.resize(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+      series.timestampsMs[i] = window.timestampsMs[indices[i]];
+      values[i] = series.values[indices[i]];
+    }
+    series.values = std::move(values);
+  }
+  return window;
+}
+
+} // namespace ReactNativeDeviceAiCore
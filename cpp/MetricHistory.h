@@ -0,0 +1,168 @@
+#pragma once
+
+#include "DeviceSnapshot.h"
+#include "Downsample.h"
+#include "MetricRollup.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+struct HistoryQuery {
+  std::vector<Metric> metrics;
+  // Inclusive
+  int64_t fromMs = std::numeric_limits<int64_t>::min();
+  int64_t toMs = std::numeric_limits<int64_t>::max();
+  // Decimate each series to at most this many points; 0 keeps every row
+  size_t maxPoints = 0;
+  DownsampleMode mode = DownsampleMode::M4;
+};
+
+struct HistorySeries {
+  Metric metric = Metric::MemoryTotal;
+  // Only filled when the window is decimated; otherwise the window's apply
+  std::vector<double> timestampsMs;
+  std::vector<double> values;
+};
+
+struct HistoryWindow {
+  // Every recorded row in the query range
+  std::vector<double> timestampsMs;
+  std::vector<HistorySeries> series;
+  bool decimated = false;
+};
+
+// The row MetricHistory records for a snapshot: live values, NaN otherwise
+std::array<double, kMetricCount> LiveValues(DeviceSnapshot const &snapshot) noexcept;
+
+// A run of sealed rows, Gorilla-compressed one column at a time: the
+// timestamps, then every metric in Metric order. Immutable once built.
+struct HistoryBlock {
+  int64_t firstMs = 0;
+  int64_t lastMs = 0;
+  size_t rows = 0;
+  std::vector<uint8_t> bytes;
+  // Start of each column in bytes; the last entry is the end of the block
+  std::array<uint32_t, kMetricCount + 2> offsets{};
+
+  static HistoryBlock Seal(std::span<int64_t const> timesMs, std::array<std::vector<double>, kMetricCount> const &values);
+
+  // Each fills rows entries; false when the block is corrupt
+  bool DecodeTimes(int64_t *out) const;
+  bool DecodeValues(Metric metric, double *out) const;
+};
+
+struct HistoryStats {
+  size_t rows = 0;
+  size_t blocks = 0;
+  size_t sealedRows = 0;
+  size_t sealedBytes = 0;
+  // Uncompressed rows not yet sealed
+  size_t openBytes = 0;
+
+  // Compressed bytes per metric value in sealed blocks, timestamps included
+  double BytesPerValue() const noexcept {
+    return sealedRows == 0 ? 0.0 : static_cast<double>(sealedBytes) / static_cast<double>(sealedRows * kMetricCount);
+  }
+};
+
+// Timestamped snapshots, one column per metric, keeping the newest capacity
+// rows. Rows collect uncompressed in an open block; every blockRows rows it is
+// sealed into a compressed HistoryBlock, and blocks whose rows have all aged
+// out are dropped. Every row also feeds MetricRollup's per-minute and
+// per-hour aggregates, which outlive the raw rows. Only live values are
+// recorded and anything else is NaN, so a gap in collection stays a gap in
+// the chart. Undecimated series keep their NaNs; decimation drops them.
+// Appends and queries may run on different threads; queries decode sealed
+// blocks outside the lock.
+class MetricHistory {
+public:
+  // 24 hours at one row per second
+  static constexpr size_t kDefaultCapacity = 24 * 60 * 60;
+  // About 17 minutes at one row per second
+  static constexpr size_t kDefaultBlockRows = 1024;
+
+  explicit MetricHistory(size_t capacity = kDefaultCapacity, size_t blockRows = kDefaultBlockRows,
+      std::span<RollupTierConfig const> tiers = MetricRollup::kDefaultTiers);
+  MetricHistory(MetricHistory const &) = delete;
+  MetricHistory &operator=(MetricHistory const &) = delete;
+
+  // Rows are kept in time order: a timestamp earlier than the newest row, e.g.
+  // after a wall clock change, is recorded at the newest row's time
+  void Append(int64_t timeMs, DeviceSnapshot const &snapshot);
+  void Append(int64_t timeMs, std::span<double const, kMetricCount> values);
+
+  HistoryWindow Query(HistoryQuery const &query) const;
+
+  // Raw rows in [fromMs, toMs] in time order, a run of rows at a time, with
+  // columns[i] holding times.size() values of metrics[i]. Runs are decoded
+  // and visited outside the lock.
+  using RowVisitor = std::function<void(std::span<int64_t const> timesMs, std::span<double const *const> columns)>;
+  void Scan(std::span<Metric const> metrics, int64_t fromMs, int64_t toMs, RowVisitor const &visit) const;
+
+  // Aggregates from the cheapest source for the requested resolution: the
+  // coarsest rollup tier whose step fits the range into maxPoints, or the raw
+  // rows when none does, moving to coarser tiers when that one no longer
+  // reaches back to fromMs. Raw rows come back as single-sample buckets.
+  RollupWindow Rollup(RollupQuery const &query) const;
+
+  // Oldest and newest time held by the raw rows or any rollup tier;
+  // {INT64_MAX, INT64_MIN} when empty
+  std::pair<int64_t, int64_t> Bounds() const;
+
+  // The cheapest source for data at stepMs resolution from fromMs on, chosen
+  // as Rollup() does: 0 for the raw rows, otherwise rollup tier + 1
+  size_t SourceFor(int64_t fromMs, int64_t stepMs) const;
+  // 0 for the raw rows
+  int64_t SourceStepMs(size_t source) const noexcept;
+
+  // Rollup buckets of one tier overlapping [fromMs, toMs], oldest first,
+  // visited under the lock
+  void ScanRollup(size_t tier, int64_t fromMs, int64_t toMs, MetricRollup::BucketVisitor const &visit) const;
+
+  size_t Size() const;
+  size_t Capacity() const noexcept {
+    return m_capacity;
+  }
+
+  // Sealed blocks, oldest first. The oldest may still hold rows that have
+  // aged out of Query().
+  size_t Blocks() const;
+  std::shared_ptr<HistoryBlock const> Block(size_t index) const;
+
+  HistoryStats Stats() const;
+
+private:
+  void SealOpenBlock();
+  // The lock must be held for these
+  int64_t OldestRowMs() const;
+  std::pair<int64_t, int64_t> BoundsLocked() const;
+  size_t SourceLocked(int64_t fromMs, int64_t stepMs) const;
+  // Rows between fromMs and toMs if they were evenly spaced, for reserving
+  size_t EstimateRowsLocked(int64_t fromMs, int64_t toMs) const;
+  size_t OpenRows() const noexcept {
+    return m_openTimes.size();
+  }
+
+  size_t m_capacity;
+  size_t m_blockRows;
+  mutable std::mutex m_mutex;
+  std::deque<std::shared_ptr<HistoryBlock const>> m_blocks;
+  size_t m_sealedRows = 0;
+  std::vector<int64_t> m_openTimes;
+  std::array<std::vector<double>, kMetricCount> m_openValues;
+  uint64_t m_appended = 0;
+  MetricRollup m_rollup;
+};
+
+} // namespace ReactNativeDeviceAiCore
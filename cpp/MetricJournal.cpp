@@ -0,0 +1,433 @@
+#include "MetricJournal.h"
+
+#include "Crc32.h"
+#include "GorillaCodec.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+// Segment header: magic, format version, columns per row (timestamps included)
+constexpr char kSegmentMagic[8] = {'D', 'E', 'V', 'A', 'I', 'J', 'N', 'L'};
+constexpr uint32_t kSegmentVersion = 1;
+constexpr size_t kSegmentHeaderBytes = 16;
+
+// Record header: magic, rows, payload bytes, CRC-32 of the whole record with
+// this field zeroed, first and last time, column offsets into the payload
+constexpr uint32_t kRecordMagic = 0x4B4C4244; // "DBLK"
+constexpr size_t kOffsetCount = kMetricCount + 2;
+constexpr size_t kRecordHeaderBytes = 4 * 4 + 2 * 8 + 4 * kOffsetCount;
+constexpr size_t kCrcOffset = 12;
+
+constexpr char kSegmentPrefix[] = "segment-";
+constexpr char kSegmentExtension[] = ".dj";
+
+// Native byte order: the journal never leaves the device that wrote it
+template <typename T>
+void Put(std::vector<uint8_t> &out, T value) {
+  auto const *bytes = reinterpret_cast<uint8_t const *>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+T Get(uint8_t const *at) noexcept {
+  T value;
+  std::memcpy(&value, at, sizeof(T));
+  return value;
+}
+
+std::array<uint8_t, kSegmentHeaderBytes> SegmentHeader() noexcept {
+  std::array<uint8_t, kSegmentHeaderBytes> header{};
+  auto columns = static_cast<uint32_t>(kMetricCount + 1);
+  std::memcpy(header.data(), kSegmentMagic, sizeof(kSegmentMagic));
+  std::memcpy(header.data() + 8, &kSegmentVersion, sizeof(kSegmentVersion));
+  std::memcpy(header.data() + 12, &columns, sizeof(columns));
+  return header;
+}
+
+std::vector<uint8_t> EncodeRecord(HistoryBlock const &block) {
+  std::vector<uint8_t> record;
+  record.reserve(kRecordHeaderBytes + block.bytes.size());
+  Put(record, kRecordMagic);
+  Put(record, static_cast<uint32_t>(block.rows));
+  Put(record, static_cast<uint32_t>(block.bytes.size()));
+  Put(record, uint32_t{0});
+  Put(record, block.firstMs);
+  Put(record, block.lastMs);
+  for (auto offset : block.offsets) {
+    Put(record, offset);
+  }
+  record.insert(record.end(), block.bytes.begin(), block.bytes.end());
+
+  auto crc = Crc32(record);
+  std::memcpy(record.data() + kCrcOffset, &crc, sizeof(crc));
+  return record;
+}
+
+uint32_t RecordCrc(std::span<uint8_t const> record) noexcept {
+  constexpr std::array<uint8_t, 4> kZeroCrc{};
+  auto crc = Crc32(record.first(kCrcOffset));
+  crc = Crc32(kZeroCrc, crc);
+  return Crc32(record.subspan(kCrcOffset + kZeroCrc.size()), crc);
+}
+
+// Most rows a Gorilla column of this many bytes can hold: 64 bits for the
+// first and at least one for each after it
+uint64_t MaxRows(uint32_t columnBytes) noexcept {
+  return columnBytes < 8 ? 0 : 8ull * columnBytes - 63;
+}
+
+// Length of the intact prefix of a segment, visiting each intact record in
+// order; nullopt when the segment header is missing or from another format
+template <typename Visit>
+std::optional<size_t> ScanSegment(std::span<uint8_t const> bytes, Visit &&visit) {
+  auto header = SegmentHeader();
+  if (bytes.size() < kSegmentHeaderBytes || !std::equal(header.begin(), header.end(), bytes.begin())) {
+    return std::nullopt;
+  }
+
+  size_t position = kSegmentHeaderBytes;
+  while (bytes.size() - position >= kRecordHeaderBytes) {
+    auto const *at = bytes.data() + position;
+    auto rows = Get<uint32_t>(at + 4);
+    auto payloadBytes = Get<uint32_t>(at + 8);
+    if (Get<uint32_t>(at) != kRecordMagic || rows == 0 || payloadBytes > bytes.size() - position - kRecordHeaderBytes) {
+      break;
+    }
+    auto record = bytes.subspan(position, kRecordHeaderBytes + payloadBytes);
+    if (RecordCrc(record) != Get<uint32_t>(at + kCrcOffset)) {
+      break;
+    }
+
+    JournalBlock block;
+    block.rows = rows;
+    block.firstMs = Get<int64_t>(at + 16);
+    block.lastMs = Get<int64_t>(at + 24);
+    for (size_t i = 0; i < kOffsetCount; ++i) {
+      block.offsets[i] = Get<uint32_t>(at + 32 + 4 * i);
+    }
+    block.bytes = record.subspan(kRecordHeaderBytes);
+    // The CRC only vouches for what was written, so the offsets are checked
+    // too, and the row count against what each column can hold, since readers
+    // size their buffers by it
+    if (block.offsets.front() != 0 || block.offsets.back() != payloadBytes ||
+        !std::is_sorted(block.offsets.begin(), block.offsets.end())) {
+      break;
+    }
+    bool fits = true;
+    for (size_t i = 0; i + 1 < kOffsetCount; ++i) {
+      fits = fits && rows <= MaxRows(block.offsets[i + 1] - block.offsets[i]);
+    }
+    if (!fits) {
+      break;
+    }
+    visit(block);
+    position += record.size();
+  }
+  return position;
+}
+
+std::optional<uint64_t> SegmentSequence(std::filesystem::path const &path) {
+  auto name = path.filename().string();
+  std::string_view view(name);
+  if (!view.starts_with(kSegmentPrefix) || !view.ends_with(kSegmentExtension)) {
+    return std::nullopt;
+  }
+  view.remove_prefix(sizeof(kSegmentPrefix) - 1);
+  view.remove_suffix(sizeof(kSegmentExtension) - 1);
+  uint64_t sequence = 0;
+  auto [end, error] = std::from_chars(view.data(), view.data() + view.size(), sequence);
+  if (error != std::errc() || end != view.data() + view.size()) {
+    return std::nullopt;
+  }
+  return sequence;
+}
+
+} // namespace
+
+bool JournalBlock::DecodeTimes(int64_t *out) const {
+  auto column = bytes.subspan(offsets[0], offsets[1] - offsets[0]);
+  return Gorilla::DecodeTimestamps(column, rows, out) != 0;
+}
+
+bool JournalBlock::DecodeValues(Metric metric, double *out) const {
+  auto index = static_cast<size_t>(metric) + 1;
+  auto column = bytes.subspan(offsets[index], offsets[index + 1] - offsets[index]);
+  return Gorilla::DecodeValues(column, rows, out) != 0;
+}
+
+MetricJournal::MetricJournal(std::filesystem::path directory, JournalConfig const &config, Clock const &clock)
+    : m_directory(std::move(directory)), m_config(config), m_clock(clock), m_lastSyncMs(clock.NowMs()) {
+  auto blockRows = std::max<size_t>(m_config.blockRows, 1);
+  m_times.reserve(blockRows);
+  for (auto &column : m_values) {
+    column.reserve(blockRows);
+  }
+}
+
+std::unique_ptr<MetricJournal> MetricJournal::Open(std::filesystem::path directory, JournalConfig const &config, Clock const &clock) {
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+  if (error) {
+    return nullptr;
+  }
+
+  std::vector<std::pair<uint64_t, std::filesystem::path>> files;
+  for (auto const &entry : std::filesystem::directory_iterator(directory, error)) {
+    if (auto sequence = SegmentSequence(entry.path()); sequence && entry.is_regular_file()) {
+      files.emplace_back(*sequence, entry.path());
+    }
+  }
+  if (error) {
+    return nullptr;
+  }
+  std::sort(files.begin(), files.end());
+
+  std::unique_ptr<MetricJournal> journal(new MetricJournal(std::move(directory), config, clock));
+  // New segments are numbered past every file on disk, including ones left
+  // alone below, so none is ever reopened
+  if (!files.empty()) {
+    journal->m_nextSequence = files.back().first + 1;
+  }
+  for (auto const &[sequence, path] : files) {
+    auto fileSize = std::filesystem::file_size(path, error);
+    if (error) {
+      continue;
+    }
+
+    Segment segment{path, sequence};
+    std::optional<size_t> intact;
+    {
+      // Unmapped before the file is truncated, which Windows requires
+      auto mapped = MappedFile::Open(path);
+      if (!mapped) {
+        continue;
+      }
+      intact = ScanSegment(mapped->Bytes(), [&](JournalBlock const &block) {
+        segment.firstMs = std::min(segment.firstMs, block.firstMs);
+        segment.lastMs = std::max(segment.lastMs, block.lastMs);
+      });
+    }
+
+    if (!intact) {
+      // A crash while creating the segment; anything else is left alone
+      if (fileSize < kSegmentHeaderBytes && std::filesystem::remove(path, error)) {
+        journal->m_stats.truncatedBytes += fileSize;
+      }
+      continue;
+    }
+    if (*intact < fileSize) {
+      std::filesystem::resize_file(path, *intact, error);
+      if (error) {
+        continue;
+      }
+      journal->m_stats.truncatedBytes += fileSize - *intact;
+    }
+    segment.bytes = *intact;
+    journal->m_segments.push_back(std::move(segment));
+  }
+
+  // Appending continues in the newest segment
+  if (!journal->m_segments.empty()) {
+    journal->m_file = AppendFile::Open(journal->m_segments.back().path);
+  }
+  return journal;
+}
+
+MetricJournal::~MetricJournal() {
+  Flush();
+  Sync();
+}
+
+void MetricJournal::Append(int64_t timeMs, std::span<double const, kMetricCount> values) {
+  m_times.push_back(timeMs);
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    m_values[i].push_back(values[i]);
+  }
+  if (m_times.size() >= std::max<size_t>(m_config.blockRows, 1)) {
+    Flush();
+  }
+}
+
+bool MetricJournal::Flush() {
+  if (m_times.empty()) {
+    return true;
+  }
+  auto block = HistoryBlock::Seal(m_times, m_values);
+  m_times.clear();
+  for (auto &column : m_values) {
+    column.clear();
+  }
+
+  if (!WriteBlock(block)) {
+    return false;
+  }
+  if (m_config.sync == JournalSync::EveryBlock ||
+      (m_config.sync == JournalSync::Interval && m_clock.NowMs() - m_lastSyncMs >= m_config.syncIntervalMs)) {
+    return Sync();
+  }
+  return true;
+}
+
+bool MetricJournal::Sync() {
+  if (!m_file || !m_unsynced) {
+    return true;
+  }
+  auto synced = m_file->Sync();
+  m_lastSyncMs = m_clock.NowMs();
+  m_unsynced = !synced;
+  std::lock_guard lock(m_mutex);
+  m_stats.syncs += synced ? 1 : 0;
+  m_stats.writeFailures += synced ? 0 : 1;
+  return synced;
+}
+
+bool MetricJournal::StartSegment(int64_t firstMs) {
+  // The old segment is made durable before anything lands in the new one
+  if (m_config.sync != JournalSync::Never) {
+    Sync();
+  }
+  m_file.reset();
+
+  auto sequence = m_nextSequence++;
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s%010llu%s", kSegmentPrefix, static_cast<unsigned long long>(sequence), kSegmentExtension);
+  auto path = m_directory / name;
+
+  auto file = AppendFile::Open(path);
+  auto header = SegmentHeader();
+  if (!file || file->Size() != 0 || !file->Write(header)) {
+    std::lock_guard lock(m_mutex);
+    m_stats.writeFailures += 1;
+    return false;
+  }
+  m_file = std::move(file);
+  m_unsynced = true;
+
+  std::lock_guard lock(m_mutex);
+  m_segments.push_back(Segment{path, sequence, header.size(), firstMs, firstMs});
+  return true;
+}
+
+bool MetricJournal::WriteBlock(HistoryBlock const &block) {
+  auto record = EncodeRecord(block);
+
+  bool rotate = !m_file || m_segments.empty();
+  if (!rotate) {
+    auto const &current = m_segments.back();
+    rotate = (current.bytes > kSegmentHeaderBytes && current.bytes + record.size() > m_config.maxSegmentBytes) ||
+        (current.bytes > kSegmentHeaderBytes && block.lastMs - current.firstMs >= m_config.maxSegmentAgeMs);
+  }
+  if (rotate && !StartSegment(block.firstMs)) {
+    return false;
+  }
+
+  if (!m_file->Write(record)) {
+    // The segment may now end in a partial record, so nothing more goes after it
+    m_file.reset();
+    std::lock_guard lock(m_mutex);
+    m_stats.writeFailures += 1;
+    return false;
+  }
+  m_unsynced = true;
+
+  {
+    std::lock_guard lock(m_mutex);
+    auto &current = m_segments.back();
+    current.bytes = m_file->Size();
+    current.firstMs = std::min(current.firstMs, block.firstMs);
+    current.lastMs = std::max(current.lastMs, block.lastMs);
+    m_stats.blocksWritten += 1;
+  }
+  DropExpiredSegments(block.lastMs);
+  return true;
+}
+
+void MetricJournal::DropExpiredSegments(int64_t newestMs) {
+  std::lock_guard lock(m_mutex);
+  // The segment being written is never dropped; older ones without a record are
+  for (size_t i = 0; i + 1 < m_segments.size();) {
+    auto const &segment = m_segments[i];
+    auto expired = segment.lastMs < segment.firstMs || newestMs - segment.lastMs > m_config.retentionMs;
+    std::error_code error;
+    if (expired && std::filesystem::remove(segment.path, error)) {
+      m_segments.erase(m_segments.begin() + static_cast<ptrdiff_t>(i));
+    } else {
+      ++i;
+    }
+  }
+}
+
+void MetricJournal::ForEachBlock(int64_t fromMs, int64_t toMs, std::function<void(JournalBlock const &)> const &visit) const {
+  std::vector<Segment> segments;
+  {
+    std::lock_guard lock(m_mutex);
+    for (auto const &segment : m_segments) {
+      if (segment.lastMs >= fromMs && segment.firstMs <= toMs) {
+        segments.push_back(segment);
+      }
+    }
+  }
+
+  for (auto const &segment : segments) {
+    // Only the bytes known intact; the writer may be appending past them
+    auto mapped = MappedFile::Open(segment.path, segment.bytes);
+    if (!mapped) {
+      continue;
+    }
+    ScanSegment(mapped->Bytes(), [&](JournalBlock const &block) {
+      if (block.lastMs >= fromMs && block.firstMs <= toMs) {
+        visit(block);
+      }
+    });
+  }
+}
+
+size_t MetricJournal::Restore(MetricHistory &history, int64_t fromMs) const {
+  size_t restored = 0;
+  std::vector<int64_t> times;
+  std::array<std::vector<double>, kMetricCount> columns;
+  ForEachBlock(fromMs, std::numeric_limits<int64_t>::max(), [&](JournalBlock const &block) {
+    times.resize(block.rows);
+    bool intact = block.DecodeTimes(times.data());
+    for (size_t i = 0; i < kMetricCount; ++i) {
+      columns[i].resize(block.rows);
+      intact = intact && block.DecodeValues(static_cast<Metric>(i), columns[i].data());
+    }
+    if (!intact) {
+      return;
+    }
+
+    std::array<double, kMetricCount> row;
+    for (size_t r = 0; r < block.rows; ++r) {
+      if (times[r] < fromMs) {
+        continue;
+      }
+      for (size_t i = 0; i < kMetricCount; ++i) {
+        row[i] = columns[i][r];
+      }
+      history.Append(times[r], row);
+      ++restored;
+    }
+  });
+  return restored;
+}
+
+JournalStats MetricJournal::Stats() const {
+  std::lock_guard lock(m_mutex);
+  auto stats = m_stats;
+  stats.segments = m_segments.size();
+  for (auto const &segment : m_segments) {
+    stats.bytes += segment.bytes;
+  }
+  return stats;
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Clock.h"
+#include "DeviceSnapshot.h"
+#include "JournalFile.h"
+#include "MetricHistory.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+enum class JournalSync {
+  // Left to the OS; a power loss may lose recently written blocks
+  Never,
+  // After every block, so at most the rows still buffered are lost
+  EveryBlock,
+  // At most once per syncIntervalMs
+  Interval,
+};
+
+struct JournalConfig {
+  // Rows buffered in memory and written together as one block
+  size_t blockRows = 60;
+  JournalSync sync = JournalSync::Interval;
+  int64_t syncIntervalMs = 60 * 1000;
+  // A new segment is started once the current one would pass this size or
+  // spans this much sample time
+  uint64_t maxSegmentBytes = 4 * 1024 * 1024;
+  int64_t maxSegmentAgeMs = 24 * 60 * 60 * 1000;
+  // Segments whose newest row is this much older than the newest row written are deleted
+  int64_t retentionMs = 7LL * 24 * 60 * 60 * 1000;
+};
+
+struct JournalStats {
+  size_t segments = 0;
+  uint64_t bytes = 0;
+  uint64_t blocksWritten = 0;
+  uint64_t syncs = 0;
+  uint64_t writeFailures = 0;
+  // Torn or corrupt bytes cut from segment tails when the journal was opened
+  uint64_t truncatedBytes = 0;
+};
+
+// A block read back from a segment. bytes points into a read-only mapping of
+// the segment and is only valid during the callback it was passed to.
+struct JournalBlock {
+  int64_t firstMs = 0;
+  int64_t lastMs = 0;
+  size_t rows = 0;
+  std::span<uint8_t const> bytes;
+  std::array<uint32_t, kMetricCount + 2> offsets{};
+
+  bool DecodeTimes(int64_t *out) const;
+  bool DecodeValues(Metric metric, double *out) const;
+};
+
+// Append-only on-disk metric history, so it survives restarts. Rows are
+// buffered and written blockRows at a time as one record: a header with the
+// row count, time range and column offsets, the columns Gorilla-compressed as
+// in HistoryBlock, and a CRC-32 over both. Records go into numbered segment
+// files in one directory, which rotate by size and sample time and are deleted
+// once past retention.
+//
+// Opening the journal checks every record and truncates each segment after
+// its last intact one, so a write torn by a crash or power loss costs that
+// record and nothing before it. Reads map the segments read-only.
+//
+// One thread appends, flushes and syncs; reads may come from any thread.
+class MetricJournal {
+public:
+  // nullptr when the directory cannot be created or read
+  static std::unique_ptr<MetricJournal> Open(
+      std::filesystem::path directory, JournalConfig const &config = {}, Clock const &clock = SteadyClock::Instance());
+
+  MetricJournal(MetricJournal const &) = delete;
+  MetricJournal &operator=(MetricJournal const &) = delete;
+  // Writes and syncs whatever is buffered
+  ~MetricJournal();
+
+  // Writes a block once blockRows rows are buffered. Times should not go
+  // backwards; Restore() clamps them like MetricHistory does.
+  void Append(int64_t timeMs, std::span<double const, kMetricCount> values);
+
+  // Writes the buffered rows as a block now, syncing per the policy
+  bool Flush();
+  bool Sync();
+
+  // Every written block overlapping [fromMs, toMs], oldest first. Buffered
+  // rows are not included.
+  void ForEachBlock(int64_t fromMs, int64_t toMs, std::function<void(JournalBlock const &)> const &visit) const;
+
+  // Appends every written row from fromMs on to history, returning the count
+  size_t Restore(MetricHistory &history, int64_t fromMs = std::numeric_limits<int64_t>::min()) const;
+
+  JournalStats Stats() const;
+
+private:
+  struct Segment {
+    std::filesystem::path path;
+    uint64_t sequence = 0;
+    // Intact bytes, header included
+    uint64_t bytes = 0;
+    int64_t firstMs = std::numeric_limits<int64_t>::max();
+    int64_t lastMs = std::numeric_limits<int64_t>::min();
+  };
+
+  MetricJournal(std::filesystem::path directory, JournalConfig const &config, Clock const &clock);
+
+  bool WriteBlock(HistoryBlock const &block);
+  bool StartSegment(int64_t firstMs);
+  void DropExpiredSegments(int64_t newestMs);
+
+  std::filesystem::path const m_directory;
+  JournalConfig const m_config;
+  Clock const &m_clock;
+
+  // Writer thread only
+  std::vector<int64_t> m_times;
+  std::array<std::vector<double>, kMetricCount> m_values;
+
+  mutable std::mutex m_mutex;
+  std::vector<Segment> m_segments;
+  std::optional<AppendFile> m_file;
+  uint64_t m_nextSequence = 1;
+  bool m_unsynced = false;
+  int64_t m_lastSyncMs = 0;
+  JournalStats m_stats;
+};
+
+} // namespace ReactNativeDeviceAiCore
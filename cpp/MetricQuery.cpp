@@ -0,0 +1,351 @@
+#include "MetricQuery.h"
+
+#include "QuantileSketch.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+constexpr std::array kAggregations{Aggregation::Avg, Aggregation::Min, Aggregation::Max, Aggregation::Sum, Aggregation::Count,
+    Aggregation::P50, Aggregation::P90, Aggregation::P95, Aggregation::P99, Aggregation::Rate};
+
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+int64_t FloorTo(int64_t timeMs, int64_t stepMs) noexcept {
+  auto start = timeMs / stepMs * stepMs;
+  return start > timeMs ? start - stepMs : start;
+}
+
+std::optional<double> QuantileOf(Aggregation aggregation) noexcept {
+  switch (aggregation) {
+    case Aggregation::P50:
+      return 0.5;
+    case Aggregation::P90:
+      return 0.9;
+    case Aggregation::P95:
+      return 0.95;
+    case Aggregation::P99:
+      return 0.99;
+    default:
+      return std::nullopt;
+  }
+}
+
+struct Summary {
+  double sum = 0.0;
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+  size_t count = 0;
+};
+
+// Sum, count, min and max of the non-NaN values. Four independent lanes
+// without branches on the data, so the loop vectorizes and the adds don't
+// wait on each other.
+Summary Summarize(double const *values, size_t count) noexcept {
+  constexpr size_t kLanes = 4;
+  std::array<double, kLanes> sum{};
+  std::array<double, kLanes> min;
+  std::array<double, kLanes> max;
+  std::array<size_t, kLanes> counted{};
+  min.fill(std::numeric_limits<double>::infinity());
+  max.fill(-std::numeric_limits<double>::infinity());
+
+  auto add = [&](size_t lane, double value) {
+    bool valid = value == value;
+    sum[lane] += valid ? value : 0.0;
+    counted[lane] += valid;
+    // Comparisons with NaN are false
+    min[lane] = value < min[lane] ? value : min[lane];
+    max[lane] = value > max[lane] ? value : max[lane];
+  };
+
+  size_t i = 0;
+  for (; i + kLanes <= count; i += kLanes) {
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      add(lane, values[i + lane]);
+    }
+  }
+  for (; i < count; ++i) {
+    add(0, values[i]);
+  }
+
+  Summary summary;
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    summary.sum += sum[lane];
+    summary.count += counted[lane];
+    summary.min = std::min(summary.min, min[lane]);
+    summary.max = std::max(summary.max, max[lane]);
+  }
+  return summary;
+}
+
+// Exact quantile with linear interpolation between the closest ranks;
+// reorders values
+double ExactQuantile(std::vector<double> &values, double q) {
+  if (values.empty()) {
+    return kNaN;
+  }
+  auto rank = q * static_cast<double>(values.size() - 1);
+  auto lower = static_cast<size_t>(rank);
+  std::nth_element(values.begin(), values.begin() + static_cast<ptrdiff_t>(lower), values.end());
+  auto low = values[lower];
+  if (lower + 1 >= values.size()) {
+    return low;
+  }
+  auto high = *std::min_element(values.begin() + static_cast<ptrdiff_t>(lower) + 1, values.end());
+  return low + (high - low) * (rank - static_cast<double>(lower));
+}
+
+// One metric's samples in the output bucket being filled
+struct Accumulator {
+  Summary summary;
+  // Raw samples for exact percentiles
+  std::vector<double> samples;
+  // Merged tier sketches
+  QuantileSketch sketch;
+  // Rate endpoints. The bucket starts from the last sample of the one before
+  // so that a bucket holding a single sample still has a rate.
+  int64_t firstMs = 0;
+  double first = kNaN;
+  int64_t lastMs = 0;
+  double last = kNaN;
+
+  void Sample(int64_t timeMs, double value) noexcept {
+    if (std::isnan(first)) {
+      firstMs = timeMs;
+      first = value;
+    }
+    lastMs = timeMs;
+    last = value;
+  }
+
+  double Value(Aggregation aggregation, bool raw) {
+    if (aggregation == Aggregation::Count) {
+      return static_cast<double>(summary.count);
+    }
+    if (summary.count == 0) {
+      return kNaN;
+    }
+    switch (aggregation) {
+      case Aggregation::Avg:
+        return summary.sum / static_cast<double>(summary.count);
+      case Aggregation::Min:
+        return summary.min;
+      case Aggregation::Max:
+        return summary.max;
+      case Aggregation::Sum:
+        return summary.sum;
+      case Aggregation::Rate:
+        return lastMs > firstMs ? (last - first) * 1000.0 / static_cast<double>(lastMs - firstMs) : kNaN;
+      default: {
+        auto q = *QuantileOf(aggregation);
+        return raw ? ExactQuantile(samples, q) : std::clamp(sketch.Quantile(q), summary.min, summary.max);
+      }
+    }
+  }
+
+  void Reset() {
+    summary = {};
+    samples.clear();
+    sketch = {};
+    firstMs = lastMs;
+    first = last;
+  }
+};
+
+class BucketFiller {
+public:
+  BucketFiller(MetricQuery const &query, MetricQueryResult &result, int64_t startMs, bool raw)
+      : m_query(query), m_result(result), m_startMs(startMs), m_raw(raw), m_accumulators(query.metrics.size()) {}
+
+  // Output bucket holding timeMs, clamped to the range
+  size_t IndexOf(int64_t timeMs) const noexcept {
+    auto index = timeMs < m_startMs ? 0 : static_cast<size_t>((timeMs - m_startMs) / m_query.stepMs);
+    return std::min(index, m_result.timestampsMs.size() - 1);
+  }
+
+  Accumulator &Enter(size_t index, size_t series) {
+    if (index != m_current) {
+      Flush();
+      m_current = index;
+    }
+    return m_accumulators[series];
+  }
+
+  void Flush() {
+    if (m_current == kNone) {
+      return;
+    }
+    for (size_t s = 0; s < m_accumulators.size(); ++s) {
+      m_result.series[s].values[m_current] = m_accumulators[s].Value(m_query.aggregation, m_raw);
+      m_accumulators[s].Reset();
+    }
+    m_current = kNone;
+  }
+
+private:
+  static constexpr size_t kNone = static_cast<size_t>(-1);
+
+  MetricQuery const &m_query;
+  MetricQueryResult &m_result;
+  int64_t m_startMs;
+  bool m_raw;
+  std::vector<Accumulator> m_accumulators;
+  size_t m_current = kNone;
+};
+
+void FromRows(MetricHistory const &history, MetricQuery const &query, BucketFiller &filler) {
+  bool percentile = QuantileOf(query.aggregation).has_value();
+  bool rate = query.aggregation == Aggregation::Rate;
+
+  history.Scan(query.metrics, query.fromMs, query.toMs, [&](std::span<int64_t const> times, std::span<double const *const> columns) {
+    size_t begin = 0;
+    while (begin < times.size()) {
+      // Rows [begin, end) share an output bucket
+      auto index = filler.IndexOf(times[begin]);
+      auto endMs = FloorTo(times[begin], query.stepMs) + query.stepMs;
+      auto end = static_cast<size_t>(std::lower_bound(times.begin() + static_cast<ptrdiff_t>(begin), times.end(), endMs) - times.begin());
+
+      for (size_t s = 0; s < columns.size(); ++s) {
+        auto &accumulator = filler.Enter(index, s);
+        auto const *values = columns[s] + begin;
+        auto rows = end - begin;
+
+        auto summary = Summarize(values, rows);
+        accumulator.summary.sum += summary.sum;
+        accumulator.summary.count += summary.count;
+        accumulator.summary.min = std::min(accumulator.summary.min, summary.min);
+        accumulator.summary.max = std::max(accumulator.summary.max, summary.max);
+
+        if (percentile && summary.count > 0) {
+          std::copy_if(values, values + rows, std::back_inserter(accumulator.samples), [](double value) { return !std::isnan(value); });
+        }
+        if (rate && summary.count > 0) {
+          auto first = std::find_if(values, values + rows, [](double value) { return !std::isnan(value); }) - values;
+          auto last = rows - 1;
+          while (std::isnan(values[last])) {
+            --last;
+          }
+          accumulator.Sample(times[begin + static_cast<size_t>(first)], values[first]);
+          accumulator.Sample(times[begin + last], values[last]);
+        }
+      }
+      begin = end;
+    }
+  });
+}
+
+void FromTier(MetricHistory const &history, size_t tier, MetricQuery const &query, BucketFiller &filler) {
+  bool percentile = QuantileOf(query.aggregation).has_value();
+  bool rate = query.aggregation == Aggregation::Rate;
+
+  history.ScanRollup(tier, query.fromMs, query.toMs, [&](int64_t startMs, std::span<RollupCell const, kMetricCount> cells) {
+    auto index = filler.IndexOf(startMs);
+    for (size_t s = 0; s < query.metrics.size(); ++s) {
+      auto &accumulator = filler.Enter(index, s);
+      auto const &cell = cells[static_cast<size_t>(query.metrics[s])];
+      if (cell.count == 0) {
+        continue;
+      }
+      accumulator.summary.sum += cell.sum;
+      accumulator.summary.count += cell.count;
+      accumulator.summary.min = std::min(accumulator.summary.min, cell.min);
+      accumulator.summary.max = std::max(accumulator.summary.max, cell.max);
+      if (percentile) {
+        accumulator.sketch.Merge(cell.sketch);
+      }
+      if (rate) {
+        accumulator.Sample(startMs, cell.Mean());
+      }
+    }
+  });
+}
+
+} // namespace
+
+const char *ToString(Aggregation aggregation) noexcept {
+  switch (aggregation) {
+    case Aggregation::Avg:
+      return "avg";
+    case Aggregation::Min:
+      return "min";
+    case Aggregation::Max:
+      return "max";
+    case Aggregation::Sum:
+      return "sum";
+    case Aggregation::Count:
+      return "count";
+    case Aggregation::P50:
+      return "p50";
+    case Aggregation::P90:
+      return "p90";
+    case Aggregation::P95:
+      return "p95";
+    case Aggregation::P99:
+      return "p99";
+    case Aggregation::Rate:
+      return "rate";
+  }
+  return "unknown";
+}
+
+std::optional<Aggregation> ParseAggregation(std::string_view name) noexcept {
+  for (auto aggregation : kAggregations) {
+    if (name == ToString(aggregation)) {
+      return aggregation;
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<MetricQueryResult> RunQuery(MetricHistory const &history, MetricQuery const &query) {
+  if (query.stepMs <= 0) {
+    return std::nullopt;
+  }
+
+  MetricQueryResult result;
+  result.stepMs = query.stepMs;
+  result.series.resize(query.metrics.size());
+  for (size_t s = 0; s < query.metrics.size(); ++s) {
+    result.series[s].metric = query.metrics[s];
+  }
+
+  auto [oldestMs, newestMs] = history.Bounds();
+  auto clamped = query;
+  clamped.fromMs = std::max(query.fromMs, oldestMs);
+  clamped.toMs = std::min(query.toMs, newestMs);
+  if (clamped.fromMs > clamped.toMs) {
+    return result;
+  }
+
+  auto startMs = FloorTo(clamped.fromMs, query.stepMs);
+  auto buckets = static_cast<uint64_t>(FloorTo(clamped.toMs, query.stepMs) - startMs) / static_cast<uint64_t>(query.stepMs) + 1;
+  if (buckets > kMaxQueryBuckets) {
+    return std::nullopt;
+  }
+  result.timestampsMs.resize(buckets);
+  for (size_t i = 0; i < buckets; ++i) {
+    result.timestampsMs[i] = static_cast<double>(startMs + static_cast<int64_t>(i) * query.stepMs);
+  }
+  for (auto &series : result.series) {
+    series.values.assign(buckets, query.aggregation == Aggregation::Count ? 0.0 : kNaN);
+  }
+
+  auto source = history.SourceFor(clamped.fromMs, query.stepMs);
+  result.sourceStepMs = history.SourceStepMs(source);
+  BucketFiller filler(clamped, result, startMs, source == 0);
+  if (source == 0) {
+    FromRows(history, clamped, filler);
+  } else {
+    FromTier(history, source - 1, clamped, filler);
+  }
+  filler.Flush();
+  return result;
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "DeviceSnapshot.h"
+#include "MetricHistory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// Rate is the change per second between the first and last sample of a bucket
+enum class Aggregation { Avg, Min, Max, Sum, Count, P50, P90, P95, P99, Rate };
+
+const char *ToString(Aggregation aggregation) noexcept;
+std::optional<Aggregation> ParseAggregation(std::string_view name) noexcept;
+
+struct MetricQuery {
+  std::vector<Metric> metrics;
+  // Inclusive; open ends are clamped to the history held
+  int64_t fromMs = std::numeric_limits<int64_t>::min();
+  int64_t toMs = std::numeric_limits<int64_t>::max();
+  // Output buckets start at multiples of stepMs
+  int64_t stepMs = 60 * 1000;
+  Aggregation aggregation = Aggregation::Avg;
+};
+
+struct MetricQuerySeries {
+  Metric metric = Metric::MemoryTotal;
+  // One value per bucket; NaN when the bucket has no samples, 0 for Count
+  std::vector<double> values;
+};
+
+struct MetricQueryResult {
+  int64_t stepMs = 0;
+  // Resolution the buckets were computed from; 0 for raw rows
+  int64_t sourceStepMs = 0;
+  // Every bucket start in the range, empty buckets included
+  std::vector<double> timestampsMs;
+  std::vector<MetricQuerySeries> series;
+};
+
+// Upper bound on buckets per query
+inline constexpr size_t kMaxQueryBuckets = 100000;
+
+// Aggregates each metric over fixed-width time buckets. The source is picked
+// as MetricHistory::Rollup() does: raw rows when stepMs is finer than every
+// rollup tier or the tiers don't reach back far enough, otherwise the
+// coarsest tier no coarser than stepMs. From raw rows, percentiles are exact;
+// from a tier they come from the merged quantile sketches and rates from the
+// change in bucket means. nullopt when stepMs is not positive or the range
+// needs more than kMaxQueryBuckets buckets.
+std::optional<MetricQueryResult> RunQuery(MetricHistory const &history, MetricQuery const &query);
+
+} // namespace ReactNativeDeviceAiCore
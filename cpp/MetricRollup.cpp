@@ -0,0 +1,152 @@
+#include "MetricRollup.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+int64_t FloorTo(int64_t timeMs, int64_t stepMs) noexcept {
+  auto start = timeMs / stepMs * stepMs;
+  return start > timeMs ? start - stepMs : start;
+}
+
+} // namespace
+
+void RollupCell::Add(double value) {
+  if (std::isnan(value)) {
+    return;
+  }
+  min = std::min(min, value);
+  max = std::max(max, value);
+  sum += value;
+  ++count;
+  sketch.Add(value);
+}
+
+void RollupCell::Merge(RollupCell const &other) {
+  if (other.count == 0) {
+    return;
+  }
+  min = std::min(min, other.min);
+  max = std::max(max, other.max);
+  sum += other.sum;
+  count += other.count;
+  sketch.Merge(other.sketch);
+}
+
+double RollupCell::Mean() const noexcept {
+  return count == 0 ? std::numeric_limits<double>::quiet_NaN() : sum / count;
+}
+
+double RollupCell::Quantile(double q) const noexcept {
+  return count == 0 ? std::numeric_limits<double>::quiet_NaN() : std::clamp(sketch.Quantile(q), min, max);
+}
+
+MetricRollup::MetricRollup(std::span<RollupTierConfig const> tiers) {
+  for (auto const &config : tiers) {
+    if (config.stepMs > 0) {
+      m_tiers.push_back(Tier{{config.stepMs, std::max<size_t>(config.capacity, 1)}, {}, false});
+    }
+  }
+  std::sort(m_tiers.begin(), m_tiers.end(), [](Tier const &a, Tier const &b) { return a.config.stepMs < b.config.stepMs; });
+}
+
+MetricRollup::Bucket &MetricRollup::Current(size_t tier, int64_t timeMs) {
+  auto &state = m_tiers[tier];
+  auto startMs = FloorTo(timeMs, state.config.stepMs);
+  if (!state.buckets.empty() && state.buckets.back().startMs >= startMs) {
+    return state.buckets.back();
+  }
+
+  // The current bucket closes: hand it to the next tier before moving on
+  if (!state.buckets.empty() && tier + 1 < m_tiers.size()) {
+    auto const &closed = state.buckets.back();
+    auto &coarser = Current(tier + 1, closed.startMs);
+    for (size_t i = 0; i < kMetricCount; ++i) {
+      coarser.cells[i].Merge(closed.cells[i]);
+    }
+  }
+  if (state.buckets.size() >= state.config.capacity) {
+    state.buckets.pop_front();
+    state.dropped = true;
+  }
+  state.buckets.push_back(Bucket{startMs, {}});
+  return state.buckets.back();
+}
+
+void MetricRollup::Add(int64_t timeMs, std::span<double const, kMetricCount> values) {
+  if (m_tiers.empty()) {
+    return;
+  }
+  auto &bucket = Current(0, timeMs);
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    bucket.cells[i].Add(values[i]);
+  }
+}
+
+bool MetricRollup::Covers(size_t tier, int64_t timeMs) const noexcept {
+  auto const &state = m_tiers[tier];
+  return !state.dropped || (!state.buckets.empty() && state.buckets.front().startMs <= timeMs);
+}
+
+std::pair<std::deque<MetricRollup::Bucket>::const_iterator, std::deque<MetricRollup::Bucket>::const_iterator> MetricRollup::Overlapping(
+    size_t tier, int64_t fromMs, int64_t toMs) const {
+  auto const &state = m_tiers[tier];
+  // First bucket ending after fromMs
+  auto first = std::partition_point(
+      state.buckets.begin(), state.buckets.end(), [&](Bucket const &bucket) { return bucket.startMs + state.config.stepMs <= fromMs; });
+  auto last = std::partition_point(first, state.buckets.end(), [&](Bucket const &bucket) { return bucket.startMs <= toMs; });
+  return {first, last};
+}
+
+void MetricRollup::ForEachBucket(size_t tier, int64_t fromMs, int64_t toMs, BucketVisitor const &visit) const {
+  auto [first, last] = Overlapping(tier, fromMs, toMs);
+  for (auto it = first; it != last; ++it) {
+    visit(it->startMs, it->cells);
+  }
+}
+
+RollupWindow MetricRollup::Query(size_t tier, RollupQuery const &query) const {
+  auto const &state = m_tiers[tier];
+  RollupWindow window;
+  window.stepMs = state.config.stepMs;
+  window.series.resize(query.metrics.size());
+
+  auto [first, last] = Overlapping(tier, query.fromMs, query.toMs);
+  auto rows = static_cast<size_t>(last - first);
+
+  window.timestampsMs.reserve(rows);
+  for (auto it = first; it != last; ++it) {
+    window.timestampsMs.push_back(static_cast<double>(it->startMs));
+  }
+  for (size_t s = 0; s < query.metrics.size(); ++s) {
+    auto &series = window.series[s];
+    auto index = static_cast<size_t>(query.metrics[s]);
+    series.metric = query.metrics[s];
+    series.min.reserve(rows);
+    series.max.reserve(rows);
+    series.mean.reserve(rows);
+    series.count.reserve(rows);
+    series.quantiles.assign(query.quantiles.size(), {});
+    for (auto &column : series.quantiles) {
+      column.reserve(rows);
+    }
+
+    for (auto it = first; it != last; ++it) {
+      auto const &cell = it->cells[index];
+      auto empty = cell.count == 0;
+      series.min.push_back(empty ? std::numeric_limits<double>::quiet_NaN() : cell.min);
+      series.max.push_back(empty ? std::numeric_limits<double>::quiet_NaN() : cell.max);
+      series.mean.push_back(cell.Mean());
+      series.count.push_back(cell.count);
+      for (size_t q = 0; q < query.quantiles.size(); ++q) {
+        series.quantiles[q].push_back(cell.Quantile(query.quantiles[q]));
+      }
+    }
+  }
+  return window;
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "DeviceSnapshot.h"
+#include "QuantileSketch.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// Summary of one metric over one time bucket; NaN samples are not counted
+struct RollupCell {
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+  double sum = 0.0;
+  uint32_t count = 0;
+  QuantileSketch sketch;
+
+  void Add(double value);
+  void Merge(RollupCell const &other);
+
+  // NaN when the bucket has no samples
+  double Mean() const noexcept;
+  // Sketch estimate clamped to the exact min and max
+  double Quantile(double q) const noexcept;
+};
+
+struct RollupTierConfig {
+  int64_t stepMs = 0;
+  // Buckets kept, the newest one included
+  size_t capacity = 0;
+};
+
+struct RollupQuery {
+  std::vector<Metric> metrics;
+  // Inclusive; buckets overlapping the range are returned
+  int64_t fromMs = std::numeric_limits<int64_t>::min();
+  int64_t toMs = std::numeric_limits<int64_t>::max();
+  // Picks the resolution: the coarsest tier whose step fits the range into
+  // this many points. 0 asks for the finest data available.
+  size_t maxPoints = 0;
+  std::vector<double> quantiles;
+};
+
+struct RollupSeries {
+  Metric metric = Metric::MemoryTotal;
+  std::vector<double> min;
+  std::vector<double> max;
+  std::vector<double> mean;
+  std::vector<uint32_t> count;
+  // One column per requested quantile
+  std::vector<std::vector<double>> quantiles;
+};
+
+struct RollupWindow {
+  // Bucket width; 0 when the rows are raw samples
+  int64_t stepMs = 0;
+  // Bucket starts, or sample times for raw rows
+  std::vector<double> timestampsMs;
+  std::vector<RollupSeries> series;
+};
+
+// Incremental per-metric aggregates at successively coarser steps. Samples go
+// into the finest tier's current bucket; when a bucket closes it is merged
+// into the next tier's current bucket, so coarser tiers cost one merge per
+// finer bucket rather than one update per sample, and lag their finer tier by
+// at most one of its buckets. Each tier keeps its newest capacity buckets.
+// Not thread-safe; MetricHistory serializes access.
+class MetricRollup {
+public:
+  // A week of minutes, then about three months of hours
+  static constexpr std::array<RollupTierConfig, 2> kDefaultTiers{{{60 * 1000, 7 * 24 * 60}, {60 * 60 * 1000, 90 * 24}}};
+
+  explicit MetricRollup(std::span<RollupTierConfig const> tiers = kDefaultTiers);
+
+  // NaN values are skipped. Times must not go backwards.
+  void Add(int64_t timeMs, std::span<double const, kMetricCount> values);
+
+  size_t Tiers() const noexcept {
+    return m_tiers.size();
+  }
+  int64_t StepMs(size_t tier) const noexcept {
+    return m_tiers[tier].config.stepMs;
+  }
+  size_t Buckets(size_t tier) const noexcept {
+    return m_tiers[tier].buckets.size();
+  }
+
+  // Start of the oldest bucket held; INT64_MAX when empty
+  int64_t OldestMs(size_t tier) const noexcept {
+    auto const &buckets = m_tiers[tier].buckets;
+    return buckets.empty() ? std::numeric_limits<int64_t>::max() : buckets.front().startMs;
+  }
+
+  // True when the tier still holds the bucket containing timeMs, or has never
+  // dropped a bucket
+  bool Covers(size_t tier, int64_t timeMs) const noexcept;
+
+  // Buckets of one tier overlapping the query range
+  RollupWindow Query(size_t tier, RollupQuery const &query) const;
+
+  using BucketVisitor = std::function<void(int64_t startMs, std::span<RollupCell const, kMetricCount> cells)>;
+  void ForEachBucket(size_t tier, int64_t fromMs, int64_t toMs, BucketVisitor const &visit) const;
+
+private:
+  struct Bucket {
+    int64_t startMs = 0;
+    std::array<RollupCell, kMetricCount> cells;
+  };
+
+  struct Tier {
+    RollupTierConfig config;
+    // Oldest first; the back is the bucket still filling
+    std::deque<Bucket> buckets;
+    bool dropped = false;
+  };
+
+  Bucket &Current(size_t tier, int64_t timeMs);
+  std::pair<std::deque<Bucket>::const_iterator, std::deque<Bucket>::const_iterator> Overlapping(
+      size_t tier, int64_t fromMs, int64_t toMs) const;
+
+  std::vector<Tier> m_tiers;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+namespace ReactNativeDeviceAiCore {
+
+// One raw reading and the API it came from. value is nullopt when the read
+// failed; source names the API for getFallbackStats and may be null then.
+template <typename T>
+struct Sourced {
+  std::optional<T> value;
+  const char *source = nullptr;
+};
+
+struct MemoryReading {
+  Sourced<double> total;
+  Sourced<double> available;
+};
+
+struct StorageReading {
+  Sourced<double> total;
+  Sourced<double> available;
+};
+
+struct BatteryReading {
+  Sourced<double> level;
+  Sourced<bool> charging;
+};
+
+struct CpuReading {
+  Sourced<double> usage;
+  Sourced<double> cores;
+};
+
+struct NetworkReading {
+  Sourced<std::string> type;
+  Sourced<bool> connected;
+};
+
+struct CounterReading {
+  Sourced<double> cpuUsage;
+  Sourced<double> memoryUsage;
+  Sourced<double> diskUsage;
+};
+
+struct WmiReading {
+  Sourced<std::string> computerSystem;
+  Sourced<std::string> operatingSystem;
+  Sourced<std::string> processor;
+};
+
+struct IdentityReading {
+  Sourced<std::string> osVersion;
+  Sourced<std::string> buildNumber;
+  Sourced<std::string> processor;
+  Sourced<std::string> architecture;
+};
+
+// Raw platform reads behind each collector. Implementations do no caching or
+// fallback of their own; SnapshotAssembler substitutes last-known values. A
+// read may block for as long as the platform API does and may throw, which
+// counts as every field of that reading failing.
+class PlatformProvider {
+public:
+  virtual ~PlatformProvider() = default;
+
+  // Short identifier such as "win32" or "fake"
+  virtual const char *Name() const noexcept = 0;
+
+  virtual MemoryReading ReadMemory() = 0;
+  virtual StorageReading ReadStorage() = 0;
+  virtual BatteryReading ReadBattery() = 0;
+  virtual CpuReading ReadCpu() = 0;
+  virtual NetworkReading ReadNetwork() = 0;
+  virtual CounterReading ReadPerformanceCounters() = 0;
+  virtual WmiReading ReadWmi() = 0;
+  virtual IdentityReading ReadIdentity() = 0;
+};
+
+} // namespace ReactNativeDeviceAiCore
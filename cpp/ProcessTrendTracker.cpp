@@ -0,0 +1,80 @@
+#include "ProcessTrendTracker.h"
+
+#include <cmath>
+#include <limits>
+
+namespace ReactNativeDeviceAiCore {
+
+const char *ToString(ProcessMetric metric) noexcept {
+  switch (metric) {
+    case ProcessMetric::PrivateBytes:
+      return "privateBytes";
+    case ProcessMetric::WorkingSet:
+      return "workingSet";
+    case ProcessMetric::HandleCount:
+      return "handleCount";
+    case ProcessMetric::ThreadCount:
+      return "threadCount";
+  }
+  return "unknown";
+}
+
+ProcessTrendTracker::ProcessTrendTracker(LeakTrendConfig const &config) noexcept
+    : m_detectors{
+          LeakTrendDetector(config),
+          LeakTrendDetector(config),
+          LeakTrendDetector(config),
+          LeakTrendDetector(config)} {}
+
+std::vector<ProcessTrendChange> ProcessTrendTracker::Track(ProcessCounters const &counters, int64_t nowMs) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (m_hasPrevious && nowMs > m_previousMs) {
+    uint32_t faults = counters.pageFaultCount - m_previousPageFaults;
+    m_pageFaultsPerSec = faults * 1000.0 / (nowMs - m_previousMs);
+  }
+  m_hasPrevious = true;
+  m_previousMs = nowMs;
+  m_previousPageFaults = counters.pageFaultCount;
+
+  std::vector<ProcessTrendChange> changes;
+  for (size_t i = 0; i < kProcessMetricCount; ++i) {
+    auto metric = static_cast<ProcessMetric>(i);
+    auto value = Value(counters, metric);
+    if (std::isnan(value)) {
+      continue;
+    }
+    auto previous = m_detectors[i].Current().verdict;
+    auto current = m_detectors[i].Add(nowMs, value);
+    if (current.verdict != previous) {
+      changes.push_back({metric, previous, current, value});
+    }
+  }
+  return changes;
+}
+
+LeakTrend ProcessTrendTracker::Trend(ProcessMetric metric) const noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_detectors[static_cast<size_t>(metric)].Current();
+}
+
+double ProcessTrendTracker::PageFaultsPerSec() const noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_pageFaultsPerSec;
+}
+
+double ProcessTrendTracker::Value(ProcessCounters const &counters, ProcessMetric metric) noexcept {
+  switch (metric) {
+    case ProcessMetric::PrivateBytes:
+      return static_cast<double>(counters.privateBytes);
+    case ProcessMetric::WorkingSet:
+      return static_cast<double>(counters.workingSet);
+    case ProcessMetric::HandleCount:
+      return static_cast<double>(counters.handleCount);
+    case ProcessMetric::ThreadCount:
+      return counters.threadCount ? static_cast<double>(*counters.threadCount) : std::numeric_limits<double>::quiet_NaN();
+  }
+  return 0.0;
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "LeakTrendDetector.h"
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// Resource usage of the host process. Page faults are cumulative. The thread
+// count may be read less often than the rest; it is nullopt when skipped.
+struct ProcessCounters {
+  uint64_t privateBytes = 0;
+  uint64_t workingSet = 0;
+  uint64_t peakWorkingSet = 0;
+  uint32_t handleCount = 0;
+  std::optional<uint32_t> threadCount;
+  uint32_t pageFaultCount = 0;
+};
+
+enum class ProcessMetric { PrivateBytes, WorkingSet, HandleCount, ThreadCount };
+
+constexpr size_t kProcessMetricCount = 4;
+
+const char *ToString(ProcessMetric metric) noexcept;
+
+struct ProcessTrendChange {
+  ProcessMetric metric;
+  TrendVerdict previous;
+  LeakTrend current;
+  double value;
+};
+
+// Runs a LeakTrendDetector per process counter and reports verdict changes.
+// Thread-safe: the sampler feeds it while JS reads the current verdicts.
+class ProcessTrendTracker {
+public:
+  explicit ProcessTrendTracker(LeakTrendConfig const &config = {}) noexcept;
+
+  std::vector<ProcessTrendChange> Track(ProcessCounters const &counters, int64_t nowMs);
+
+  LeakTrend Trend(ProcessMetric metric) const noexcept;
+  double PageFaultsPerSec() const noexcept;
+
+  // NaN for a counter that wasn't read
+  static double Value(ProcessCounters const &counters, ProcessMetric metric) noexcept;
+
+private:
+  mutable std::mutex m_mutex;
+  std::array<LeakTrendDetector, kProcessMetricCount> m_detectors;
+  bool m_hasPrevious = false;
+  int64_t m_previousMs = 0;
+  uint32_t m_previousPageFaults = 0;
+  double m_pageFaultsPerSec = 0.0;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,454 @@
+#include "ProviderTrace.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <set>
+#include <type_traits>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+constexpr char kMagic[4] = {'D', 'A', 'I', 'T'};
+constexpr uint8_t kVersion = 1;
+
+constexpr uint8_t kHasValue = 0x1;
+constexpr uint8_t kFlagValue = 0x2;
+constexpr uint8_t kHasSource = 0x4;
+
+// Fields of each reading, in the order they are encoded
+template <typename Reading, typename Visitor>
+void VisitFields(Reading &reading, Visitor &&visit) {
+  using Plain = std::remove_const_t<Reading>;
+  if constexpr (std::is_same_v<Plain, MemoryReading> || std::is_same_v<Plain, StorageReading>) {
+    visit(reading.total);
+    visit(reading.available);
+  } else if constexpr (std::is_same_v<Plain, BatteryReading>) {
+    visit(reading.level);
+    visit(reading.charging);
+  } else if constexpr (std::is_same_v<Plain, CpuReading>) {
+    visit(reading.usage);
+    visit(reading.cores);
+  } else if constexpr (std::is_same_v<Plain, NetworkReading>) {
+    visit(reading.type);
+    visit(reading.connected);
+  } else if constexpr (std::is_same_v<Plain, CounterReading>) {
+    visit(reading.cpuUsage);
+    visit(reading.memoryUsage);
+    visit(reading.diskUsage);
+  } else if constexpr (std::is_same_v<Plain, WmiReading>) {
+    visit(reading.computerSystem);
+    visit(reading.operatingSystem);
+    visit(reading.processor);
+  } else {
+    static_assert(std::is_same_v<Plain, IdentityReading>);
+    visit(reading.osVersion);
+    visit(reading.buildNumber);
+    visit(reading.processor);
+    visit(reading.architecture);
+  }
+}
+
+template <typename Reading>
+constexpr uint8_t KindOf() noexcept {
+  if constexpr (std::is_same_v<Reading, MemoryReading>) {
+    return static_cast<uint8_t>(Collector::Memory);
+  } else if constexpr (std::is_same_v<Reading, StorageReading>) {
+    return static_cast<uint8_t>(Collector::Storage);
+  } else if constexpr (std::is_same_v<Reading, BatteryReading>) {
+    return static_cast<uint8_t>(Collector::Battery);
+  } else if constexpr (std::is_same_v<Reading, CpuReading>) {
+    return static_cast<uint8_t>(Collector::Cpu);
+  } else if constexpr (std::is_same_v<Reading, NetworkReading>) {
+    return static_cast<uint8_t>(Collector::Network);
+  } else if constexpr (std::is_same_v<Reading, CounterReading>) {
+    return static_cast<uint8_t>(Collector::PerformanceCounters);
+  } else if constexpr (std::is_same_v<Reading, WmiReading>) {
+    return static_cast<uint8_t>(Collector::Wmi);
+  } else {
+    return kIdentityKind;
+  }
+}
+
+// Recorded source names outlive any one trace so that readings copied out of
+// it keep valid pointers. There are only a handful of distinct names.
+const char *InternSource(std::string_view name) {
+  static std::mutex mutex;
+  static std::set<std::string, std::less<>> names;
+  std::lock_guard lock(mutex);
+  auto found = names.find(name);
+  if (found == names.end()) {
+    found = names.emplace(name).first;
+  }
+  return found->c_str();
+}
+
+void PutVarint(std::string &out, uint64_t value) {
+  while (value >= 0x80) {
+    out += static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  out += static_cast<char>(value);
+}
+
+void PutString(std::string &out, std::string_view text) {
+  PutVarint(out, text.size());
+  out.append(text);
+}
+
+uint64_t ZigZag(int64_t value) noexcept {
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(uint64_t value) noexcept {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+class Reader {
+public:
+  explicit Reader(std::span<uint8_t const> bytes) : m_bytes(bytes) {}
+
+  bool AtEnd() const noexcept {
+    return m_offset == m_bytes.size();
+  }
+
+  std::optional<uint8_t> Byte() noexcept {
+    if (m_offset >= m_bytes.size()) {
+      return std::nullopt;
+    }
+    return m_bytes[m_offset++];
+  }
+
+  std::optional<uint64_t> Varint() noexcept {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      auto byte = Byte();
+      if (!byte) {
+        return std::nullopt;
+      }
+      value |= static_cast<uint64_t>(*byte & 0x7F) << shift;
+      if (!(*byte & 0x80)) {
+        return value;
+      }
+    }
+    return std::nullopt;
+  }
+
+  std::optional<std::string_view> String() noexcept {
+    auto length = Varint();
+    if (!length || *length > m_bytes.size() - m_offset) {
+      return std::nullopt;
+    }
+    std::string_view text(reinterpret_cast<char const *>(m_bytes.data() + m_offset), *length);
+    m_offset += *length;
+    return text;
+  }
+
+  std::optional<double> Double() noexcept {
+    if (m_bytes.size() - m_offset < sizeof(uint64_t)) {
+      return std::nullopt;
+    }
+    uint64_t bits = 0;
+    for (size_t i = 0; i < sizeof(bits); ++i) {
+      bits |= static_cast<uint64_t>(m_bytes[m_offset + i]) << (8 * i);
+    }
+    m_offset += sizeof(bits);
+    return std::bit_cast<double>(bits);
+  }
+
+private:
+  std::span<uint8_t const> m_bytes;
+  size_t m_offset = 0;
+};
+
+// Decodes one reading's fields; false when the input ends or is malformed
+class FieldDecoder {
+public:
+  FieldDecoder(Reader &reader, std::vector<const char *> &sources) : m_reader(reader), m_sources(sources) {}
+
+  template <typename T>
+  void operator()(Sourced<T> &field) {
+    if (!m_ok) {
+      return;
+    }
+    auto tag = m_reader.Byte();
+    if (!tag) {
+      m_ok = false;
+      return;
+    }
+    if (*tag & kHasSource) {
+      auto id = m_reader.Varint();
+      if (!id || *id > m_sources.size()) {
+        m_ok = false;
+        return;
+      }
+      if (*id == m_sources.size()) {
+        auto name = m_reader.String();
+        if (!name) {
+          m_ok = false;
+          return;
+        }
+        m_sources.push_back(InternSource(*name));
+      }
+      field.source = m_sources[*id];
+    }
+    if (!(*tag & kHasValue)) {
+      return;
+    }
+    if constexpr (std::is_same_v<T, bool>) {
+      field.value = (*tag & kFlagValue) != 0;
+    } else if constexpr (std::is_same_v<T, double>) {
+      field.value = m_reader.Double();
+      m_ok = field.value.has_value();
+    } else {
+      auto text = m_reader.String();
+      m_ok = text.has_value();
+      if (text) {
+        field.value = std::string(*text);
+      }
+    }
+  }
+
+  bool Ok() const noexcept {
+    return m_ok;
+  }
+
+private:
+  Reader &m_reader;
+  std::vector<const char *> &m_sources;
+  bool m_ok = true;
+};
+
+template <typename Reading>
+bool DecodeInto(Reader &reader, std::vector<const char *> &sources, int64_t atUs, int64_t durationUs,
+    std::vector<TracedRead<Reading>> &reads) {
+  TracedRead<Reading> read{atUs, durationUs, {}};
+  FieldDecoder decoder(reader, sources);
+  VisitFields(read.reading, decoder);
+  if (!decoder.Ok()) {
+    return false;
+  }
+  reads.push_back(std::move(read));
+  return true;
+}
+
+template <typename Reads>
+void Extend(Reads const &reads, int64_t &first, int64_t &last) noexcept {
+  for (auto const &read : reads) {
+    first = std::min(first, read.atUs);
+    last = std::max(last, read.atUs + read.durationUs);
+  }
+}
+
+} // namespace
+
+size_t ProviderTrace::Size() const noexcept {
+  return memory.size() + storage.size() + battery.size() + cpu.size() + network.size() + performanceCounters.size() +
+      wmi.size() + identity.size();
+}
+
+int64_t ProviderTrace::DurationUs() const noexcept {
+  auto first = std::numeric_limits<int64_t>::max();
+  auto last = std::numeric_limits<int64_t>::min();
+  Extend(memory, first, last);
+  Extend(storage, first, last);
+  Extend(battery, first, last);
+  Extend(cpu, first, last);
+  Extend(network, first, last);
+  Extend(performanceCounters, first, last);
+  Extend(wmi, first, last);
+  Extend(identity, first, last);
+  return last > first ? last - first : 0;
+}
+
+std::optional<ProviderTrace> ProviderTrace::Decode(std::span<uint8_t const> bytes) {
+  if (bytes.size() < sizeof(kMagic) + 1 || std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) != 0 ||
+      bytes[sizeof(kMagic)] != kVersion) {
+    return std::nullopt;
+  }
+  Reader reader(bytes.subspan(sizeof(kMagic) + 1));
+  auto provider = reader.String();
+  auto startUnixMs = reader.Varint();
+  if (!provider || !startUnixMs) {
+    return std::nullopt;
+  }
+
+  ProviderTrace trace;
+  trace.provider = std::string(*provider);
+  trace.startUnixMs = static_cast<int64_t>(*startUnixMs);
+
+  std::vector<const char *> sources;
+  int64_t atUs = 0;
+  while (!reader.AtEnd()) {
+    auto kind = reader.Byte();
+    auto delta = reader.Varint();
+    auto durationUs = reader.Varint();
+    if (!kind || !delta || !durationUs) {
+      trace.truncated = true;
+      break;
+    }
+    atUs += UnZigZag(*delta);
+    auto duration = static_cast<int64_t>(*durationUs);
+
+    bool ok = false;
+    switch (*kind) {
+      case static_cast<uint8_t>(Collector::Memory):
+        ok = DecodeInto(reader, sources, atUs, duration, trace.memory);
+        break;
+      case static_cast<uint8_t>(Collector::Storage):
+        ok = DecodeInto(reader, sources, atUs, duration, trace.storage);
+        break;
+      case static_cast<uint8_t>(Collector::Battery):
+        ok = DecodeInto(reader, sources, atUs, duration, trace.battery);
+        break;
+      case static_cast<uint8_t>(Collector::Cpu):
+        ok = DecodeInto(reader, sources, atUs, duration, trace.cpu);
+        break;
+      case static_cast<uint8_t>(Collector::Network):
+        ok = DecodeInto(reader, sources, atUs, duration, trace.network);
+        break;
+      case static_cast<uint8_t>(Collector::PerformanceCounters):
+        ok = DecodeInto(reader, sources, atUs, duration, trace.performanceCounters);
+        break;
+      case static_cast<uint8_t>(Collector::Wmi):
+        ok = DecodeInto(reader, sources, atUs, duration, trace.wmi);
+        break;
+      case kIdentityKind:
+        ok = DecodeInto(reader, sources, atUs, duration, trace.identity);
+        break;
+      default:
+        break;
+    }
+    if (!ok) {
+      // A record that does not parse ends the usable part of the trace
+      trace.truncated = true;
+      break;
+    }
+  }
+  return trace;
+}
+
+std::optional<ProviderTrace> ProviderTrace::Load(std::string const &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return std::nullopt;
+  }
+  std::vector<uint8_t> bytes{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  return Decode(bytes);
+}
+
+ProviderTraceWriter::ProviderTraceWriter(std::ostream &out, std::string_view provider)
+    : m_out(out), m_start(std::chrono::steady_clock::now()) {
+  std::string header(kMagic, sizeof(kMagic));
+  header += static_cast<char>(kVersion);
+  PutString(header, provider);
+  PutVarint(header, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                                              .count()));
+  m_out.write(header.data(), static_cast<std::streamsize>(header.size()));
+  m_bytes = header.size();
+}
+
+int64_t ProviderTraceWriter::NowUs() const noexcept {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+}
+
+template <typename Reading>
+void ProviderTraceWriter::Append(int64_t atUs, int64_t durationUs, Reading const &reading) {
+  std::lock_guard lock(m_mutex);
+  std::string record;
+  record += static_cast<char>(KindOf<Reading>());
+  PutVarint(record, ZigZag(atUs - m_lastAtUs));
+  PutVarint(record, static_cast<uint64_t>(std::max<int64_t>(durationUs, 0)));
+  m_lastAtUs = atUs;
+
+  VisitFields(reading, [&](auto const &field) {
+    using T = typename std::remove_cvref_t<decltype(field.value)>::value_type;
+    uint8_t tag = 0;
+    if (field.value) {
+      tag |= kHasValue;
+      if constexpr (std::is_same_v<T, bool>) {
+        tag |= *field.value ? kFlagValue : 0;
+      }
+    }
+    if (field.source) {
+      tag |= kHasSource;
+    }
+    record += static_cast<char>(tag);
+
+    if (field.source) {
+      size_t id = 0;
+      while (id < m_sources.size() && m_sources[id] != field.source) {
+        ++id;
+      }
+      PutVarint(record, id);
+      if (id == m_sources.size()) {
+        m_sources.emplace_back(field.source);
+        PutString(record, field.source);
+      }
+    }
+
+    if (field.value) {
+      if constexpr (std::is_same_v<T, double>) {
+        auto bits = std::bit_cast<uint64_t>(*field.value);
+        for (size_t i = 0; i < sizeof(bits); ++i) {
+          record += static_cast<char>(bits >> (8 * i));
+        }
+      } else if constexpr (std::is_same_v<T, std::string>) {
+        PutString(record, *field.value);
+      }
+    }
+  });
+
+  m_out.write(record.data(), static_cast<std::streamsize>(record.size()));
+  ++m_records;
+  m_bytes += record.size();
+}
+
+void ProviderTraceWriter::Write(int64_t atUs, int64_t durationUs, MemoryReading const &reading) {
+  Append(atUs, durationUs, reading);
+}
+
+void ProviderTraceWriter::Write(int64_t atUs, int64_t durationUs, StorageReading const &reading) {
+  Append(atUs, durationUs, reading);
+}
+
+void ProviderTraceWriter::Write(int64_t atUs, int64_t durationUs, BatteryReading const &reading) {
+  Append(atUs, durationUs, reading);
+}
+
+void ProviderTraceWriter::Write(int64_t atUs, int64_t durationUs, CpuReading const &reading) {
+  Append(atUs, durationUs, reading);
+}
+
+void ProviderTraceWriter::Write(int64_t atUs, int64_t durationUs, NetworkReading const &reading) {
+  Append(atUs, durationUs, reading);
+}
+
+void ProviderTraceWriter::Write(int64_t atUs, int64_t durationUs, CounterReading const &reading) {
+  Append(atUs, durationUs, reading);
+}
+
+void ProviderTraceWriter::Write(int64_t atUs, int64_t durationUs, WmiReading const &reading) {
+  Append(atUs, durationUs, reading);
+}
+
+void ProviderTraceWriter::Write(int64_t atUs, int64_t durationUs, IdentityReading const &reading) {
+  Append(atUs, durationUs, reading);
+}
+
+uint64_t ProviderTraceWriter::Records() const {
+  std::lock_guard lock(m_mutex);
+  return m_records;
+}
+
+uint64_t ProviderTraceWriter::BytesWritten() const {
+  std::lock_guard lock(m_mutex);
+  return m_bytes;
+}
+
+} // namespace ReactNativeDeviceAiCore
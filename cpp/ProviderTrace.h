@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CollectorDeadline.h"
+#include "PlatformProvider.h"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// Binary trace of raw provider reads, so that collection can be replayed
+// deterministically away from the machine it was recorded on.
+//
+// Layout, little-endian, integers as LEB128 varints:
+//   header  "DAIT", version byte, provider name (length + bytes),
+//           recording start in Unix ms
+//   record  kind byte (Collector value, or kIdentityKind), start time as a
+//           zigzag delta from the previous record in µs, read duration in µs,
+//           then the reading's fields in declaration order
+//   field   tag byte (bit 0 value present, bit 1 boolean value, bit 2 source
+//           present), source id, value (doubles as 8 raw bytes, strings as
+//           length + bytes)
+// Source names are interned: an id equal to the number of sources seen so far
+// introduces a new one and is followed by its length and bytes.
+constexpr uint8_t kIdentityKind = static_cast<uint8_t>(kCollectorCount);
+
+template <typename Reading>
+struct TracedRead {
+  // Start of the read relative to the start of the recording
+  int64_t atUs = 0;
+  int64_t durationUs = 0;
+  Reading reading;
+};
+
+// A decoded trace, one list of reads per collector in recorded order. Sources
+// point at interned strings that live for the rest of the process.
+struct ProviderTrace {
+  std::string provider;
+  int64_t startUnixMs = 0;
+  std::vector<TracedRead<MemoryReading>> memory;
+  std::vector<TracedRead<StorageReading>> storage;
+  std::vector<TracedRead<BatteryReading>> battery;
+  std::vector<TracedRead<CpuReading>> cpu;
+  std::vector<TracedRead<NetworkReading>> network;
+  std::vector<TracedRead<CounterReading>> performanceCounters;
+  std::vector<TracedRead<WmiReading>> wmi;
+  std::vector<TracedRead<IdentityReading>> identity;
+  // Set when the last record was cut short, e.g. the recorder was killed
+  // mid-write; the complete records before it are kept
+  bool truncated = false;
+
+  // Reads of every kind
+  size_t Size() const noexcept;
+  // From the first read's start to the last read's end
+  int64_t DurationUs() const noexcept;
+
+  // nullopt when the header is missing or the version is unknown
+  static std::optional<ProviderTrace> Decode(std::span<uint8_t const> bytes);
+  static std::optional<ProviderTrace> Load(std::string const &path);
+};
+
+// Appends reads to a stream as they happen. Safe to call from several
+// collector threads at once; records are written in completion order.
+class ProviderTraceWriter {
+public:
+  ProviderTraceWriter(std::ostream &out, std::string_view provider);
+  ProviderTraceWriter(ProviderTraceWriter const &) = delete;
+  ProviderTraceWriter &operator=(ProviderTraceWriter const &) = delete;
+
+  // Microseconds since the writer was created, for timing a read
+  int64_t NowUs() const noexcept;
+
+  void Write(int64_t atUs, int64_t durationUs, MemoryReading const &reading);
+  void Write(int64_t atUs, int64_t durationUs, StorageReading const &reading);
+  void Write(int64_t atUs, int64_t durationUs, BatteryReading const &reading);
+  void Write(int64_t atUs, int64_t durationUs, CpuReading const &reading);
+  void Write(int64_t atUs, int64_t durationUs, NetworkReading const &reading);
+  void Write(int64_t atUs, int64_t durationUs, CounterReading const &reading);
+  void Write(int64_t atUs, int64_t durationUs, WmiReading const &reading);
+  void Write(int64_t atUs, int64_t durationUs, IdentityReading const &reading);
+
+  uint64_t Records() const;
+  uint64_t BytesWritten() const;
+
+private:
+  template <typename Reading>
+  void Append(int64_t atUs, int64_t durationUs, Reading const &reading);
+
+  std::ostream &m_out;
+  std::chrono::steady_clock::time_point const m_start;
+  mutable std::mutex m_mutex;
+  std::vector<std::string> m_sources;
+  int64_t m_lastAtUs = 0;
+  uint64_t m_records = 0;
+  uint64_t m_bytes = 0;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,319 @@
+#include "QuantileSketch.h"
+
+#include "Crc32.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+constexpr double kGamma = (1.0 + QuantileSketch::kRelativeAccuracy) / (1.0 - QuantileSketch::kRelativeAccuracy);
+double const kLogGamma = std::log(kGamma);
+
+// Bucket i holds magnitudes in (gamma^(i-1), gamma^i]
+int32_t IndexOf(double magnitude) noexcept {
+  return static_cast<int32_t>(std::ceil(std::log(magnitude) / kLogGamma));
+}
+
+// The point of bucket i within relative error a of both its bounds
+double ValueOf(int32_t index) noexcept {
+  return 2.0 * std::exp(index * kLogGamma) / (kGamma + 1.0);
+}
+
+constexpr uint8_t kSketchVersion = 1;
+constexpr uint8_t kSetVersion = 1;
+constexpr char kSetMagic[] = {'D', 'A', 'I', 'Q'};
+
+void PutVarint(std::vector<uint8_t> &out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+uint64_t ZigZag(int64_t value) noexcept {
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(uint64_t value) noexcept {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+class Reader {
+public:
+  explicit Reader(std::span<uint8_t const> bytes) : m_bytes(bytes) {}
+
+  bool AtEnd() const noexcept {
+    return m_offset == m_bytes.size();
+  }
+
+  std::optional<uint8_t> Byte() noexcept {
+    if (m_offset >= m_bytes.size()) {
+      return std::nullopt;
+    }
+    return m_bytes[m_offset++];
+  }
+
+  std::optional<uint64_t> Varint() noexcept {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      auto byte = Byte();
+      if (!byte) {
+        return std::nullopt;
+      }
+      value |= static_cast<uint64_t>(*byte & 0x7F) << shift;
+      if (!(*byte & 0x80)) {
+        return value;
+      }
+    }
+    return std::nullopt;
+  }
+
+  std::optional<std::span<uint8_t const>> Bytes() noexcept {
+    auto length = Varint();
+    if (!length || *length > m_bytes.size() - m_offset) {
+      return std::nullopt;
+    }
+    auto bytes = m_bytes.subspan(m_offset, *length);
+    m_offset += *length;
+    return bytes;
+  }
+
+private:
+  std::span<uint8_t const> m_bytes;
+  size_t m_offset = 0;
+};
+
+} // namespace
+
+void QuantileSketch::AddTo(std::vector<Bucket> &buckets, int32_t index, uint32_t count) {
+  // Branchless lower bound: random values would mispredict most branches of
+  // a classic binary search
+  Bucket const *base = buckets.data();
+  for (auto length = buckets.size(); length > 1;) {
+    auto half = length / 2;
+    base += static_cast<size_t>(base[half - 1].index < index) * half;
+    length -= half;
+  }
+  auto it = buckets.begin() + (base - buckets.data());
+  if (it != buckets.end() && it->index < index) {
+    ++it;
+  }
+  if (it != buckets.end() && it->index == index) {
+    it->count += count;
+  } else {
+    buckets.insert(it, Bucket{index, count});
+  }
+}
+
+void QuantileSketch::MergeInto(std::vector<Bucket> &buckets, std::vector<Bucket> const &other) {
+  if (other.empty()) {
+    return;
+  }
+  std::vector<Bucket> merged;
+  merged.reserve(buckets.size() + other.size());
+  auto a = buckets.begin();
+  auto b = other.begin();
+  while (a != buckets.end() || b != other.end()) {
+    if (b == other.end() || (a != buckets.end() && a->index < b->index)) {
+      merged.push_back(*a++);
+    } else if (a == buckets.end() || b->index < a->index) {
+      merged.push_back(*b++);
+    } else {
+      merged.push_back(Bucket{a->index, a->count + b->count});
+      ++a;
+      ++b;
+    }
+  }
+  buckets = std::move(merged);
+}
+
+void QuantileSketch::Add(double value, uint32_t count) {
+  if (std::isnan(value) || count == 0) {
+    return;
+  }
+  auto magnitude = std::min(std::abs(value), std::numeric_limits<double>::max());
+  if (magnitude < kMinValue) {
+    m_zeroCount += count;
+  } else {
+    AddTo(value > 0 ? m_positive : m_negative, IndexOf(magnitude), count);
+    Collapse();
+  }
+  m_count += count;
+}
+
+void QuantileSketch::Merge(QuantileSketch const &other) {
+  MergeInto(m_positive, other.m_positive);
+  MergeInto(m_negative, other.m_negative);
+  m_zeroCount += other.m_zeroCount;
+  m_count += other.m_count;
+  Collapse();
+}
+
+void QuantileSketch::Collapse() {
+  auto total = m_positive.size() + m_negative.size();
+  if (total <= kMaxBuckets) {
+    return;
+  }
+  // The smallest magnitudes go first, from the side that has more buckets;
+  // bucket counts saturate rather than wrap
+  auto &buckets = m_positive.size() >= m_negative.size() ? m_positive : m_negative;
+  auto excess = std::min(total - kMaxBuckets, buckets.size() - 1);
+  uint64_t folded = buckets[excess].count;
+  for (size_t i = 0; i < excess; ++i) {
+    folded += buckets[i].count;
+  }
+  buckets[excess].count = static_cast<uint32_t>(std::min<uint64_t>(folded, UINT32_MAX));
+  buckets.erase(buckets.begin(), buckets.begin() + static_cast<ptrdiff_t>(excess));
+}
+
+void QuantileSketch::Encode(std::vector<uint8_t> &out) const {
+  out.push_back(kSketchVersion);
+  PutVarint(out, m_zeroCount);
+  for (auto const *buckets : {&m_positive, &m_negative}) {
+    PutVarint(out, buckets->size());
+    int64_t previous = 0;
+    for (auto const &bucket : *buckets) {
+      PutVarint(out, ZigZag(bucket.index - previous));
+      PutVarint(out, bucket.count);
+      previous = bucket.index;
+    }
+  }
+}
+
+std::optional<QuantileSketch> QuantileSketch::Decode(std::span<uint8_t const> bytes) {
+  Reader reader(bytes);
+  QuantileSketch sketch;
+  auto version = reader.Byte();
+  auto zeroCount = reader.Varint();
+  if (version != kSketchVersion || !zeroCount) {
+    return std::nullopt;
+  }
+  sketch.m_zeroCount = *zeroCount;
+  sketch.m_count = *zeroCount;
+
+  for (auto *buckets : {&sketch.m_positive, &sketch.m_negative}) {
+    auto size = reader.Varint();
+    // Every bucket takes at least two bytes
+    if (!size || *size > bytes.size() / 2) {
+      return std::nullopt;
+    }
+    buckets->reserve(static_cast<size_t>(*size));
+    int64_t index = 0;
+    for (uint64_t i = 0; i < *size; ++i) {
+      auto delta = reader.Varint();
+      auto count = reader.Varint();
+      if (!delta || !count || *count == 0 || *count > UINT32_MAX) {
+        return std::nullopt;
+      }
+      // Bounded so that the running index cannot overflow before the check
+      auto step = UnZigZag(*delta);
+      if (step < -(int64_t{1} << 33) || step > (int64_t{1} << 33)) {
+        return std::nullopt;
+      }
+      index += step;
+      // Indices must be strictly increasing and fit the bucket type
+      if ((i > 0 && index <= buckets->back().index) || index < INT32_MIN || index > INT32_MAX) {
+        return std::nullopt;
+      }
+      buckets->push_back(Bucket{static_cast<int32_t>(index), static_cast<uint32_t>(*count)});
+      sketch.m_count += *count;
+    }
+  }
+  if (!reader.AtEnd()) {
+    return std::nullopt;
+  }
+  sketch.Collapse();
+  return sketch;
+}
+
+double QuantileSketch::Quantile(double q) const noexcept {
+  if (m_count == 0) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  // Zero-based rank of the wanted value, from the smallest up
+  auto rank = static_cast<uint64_t>(std::clamp(q, 0.0, 1.0) * static_cast<double>(m_count - 1));
+
+  uint64_t seen = 0;
+  // Most negative first, which is the largest magnitude
+  for (auto it = m_negative.rbegin(); it != m_negative.rend(); ++it) {
+    seen += it->count;
+    if (seen > rank) {
+      return -ValueOf(it->index);
+    }
+  }
+  seen += m_zeroCount;
+  if (seen > rank) {
+    return 0.0;
+  }
+  for (auto const &bucket : m_positive) {
+    seen += bucket.count;
+    if (seen > rank) {
+      return ValueOf(bucket.index);
+    }
+  }
+  return m_positive.empty() ? 0.0 : ValueOf(m_positive.back().index);
+}
+
+std::vector<uint8_t> EncodeSketchSet(std::span<NamedSketch const> sketches) {
+  std::vector<uint8_t> out(std::begin(kSetMagic), std::end(kSetMagic));
+  out.push_back(kSetVersion);
+  PutVarint(out, sketches.size());
+  std::vector<uint8_t> encoded;
+  for (auto const &entry : sketches) {
+    PutVarint(out, entry.name.size());
+    out.insert(out.end(), entry.name.begin(), entry.name.end());
+    encoded.clear();
+    entry.sketch.Encode(encoded);
+    PutVarint(out, encoded.size());
+    out.insert(out.end(), encoded.begin(), encoded.end());
+  }
+  auto crc = Crc32(out);
+  for (int shift = 0; shift < 32; shift += 8) {
+    out.push_back(static_cast<uint8_t>(crc >> shift));
+  }
+  return out;
+}
+
+std::optional<std::vector<NamedSketch>> DecodeSketchSet(std::span<uint8_t const> bytes) {
+  constexpr size_t kCrcBytes = 4;
+  if (bytes.size() < sizeof(kSetMagic) + 1 + kCrcBytes || !std::equal(std::begin(kSetMagic), std::end(kSetMagic), bytes.begin())) {
+    return std::nullopt;
+  }
+  auto body = bytes.first(bytes.size() - kCrcBytes);
+  uint32_t crc = 0;
+  for (size_t i = 0; i < kCrcBytes; ++i) {
+    crc |= static_cast<uint32_t>(bytes[body.size() + i]) << (8 * i);
+  }
+  if (Crc32(body) != crc) {
+    return std::nullopt;
+  }
+
+  Reader reader(body.subspan(sizeof(kSetMagic)));
+  auto version = reader.Byte();
+  auto entries = reader.Varint();
+  if (version != kSetVersion || !entries || *entries > body.size()) {
+    return std::nullopt;
+  }
+  std::vector<NamedSketch> sketches;
+  sketches.reserve(static_cast<size_t>(*entries));
+  for (uint64_t i = 0; i < *entries; ++i) {
+    auto name = reader.Bytes();
+    auto encoded = name ? reader.Bytes() : std::nullopt;
+    auto sketch = encoded ? QuantileSketch::Decode(*encoded) : std::nullopt;
+    if (!sketch) {
+      return std::nullopt;
+    }
+    sketches.push_back(NamedSketch{std::string(name->begin(), name->end()), std::move(*sketch)});
+  }
+  if (!reader.AtEnd()) {
+    return std::nullopt;
+  }
+  return sketches;
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// DDSketch (Masson et al., VLDB 2019): values are counted in logarithmic
+// buckets of ratio gamma = (1 + a) / (1 - a), so any quantile comes back
+// within relative error a of a value of that rank. Two sketches merge by adding
+// bucket counts, losslessly and in any order, which is what lets per-minute
+// summaries roll up into per-hour ones. Buckets are stored sparsely, so a
+// sketch of a steady metric is a handful of entries. Values closer to zero
+// than kMinValue count as zero; NaN is ignored.
+//
+// At most kMaxBuckets buckets are kept, enough for values spanning about 17
+// orders of magnitude. Past that the buckets nearest zero are folded into
+// their neighbour, so the low quantiles lose accuracy first and the tail the
+// sketch is usually kept for stays exact.
+class QuantileSketch {
+public:
+  static constexpr double kRelativeAccuracy = 0.01;
+  static constexpr double kMinValue = 1e-9;
+  static constexpr size_t kMaxBuckets = 2048;
+
+  void Add(double value, uint32_t count = 1);
+  void Merge(QuantileSketch const &other);
+
+  // Compact binary form appended to out, for merging sketches taken in other
+  // sessions or on other devices. Layout, integers as LEB128 varints: version
+  // byte, zero count, then positive and negative buckets, each as a bucket
+  // count followed by (zigzag index delta, count) pairs.
+  void Encode(std::vector<uint8_t> &out) const;
+  // nullopt unless bytes hold exactly one well-formed sketch
+  static std::optional<QuantileSketch> Decode(std::span<uint8_t const> bytes);
+
+  // Value at quantile q in [0, 1]; NaN when empty
+  double Quantile(double q) const noexcept;
+
+  uint64_t Count() const noexcept {
+    return m_count;
+  }
+
+  bool Empty() const noexcept {
+    return m_count == 0;
+  }
+
+  // Occupied buckets, for sizing
+  size_t Buckets() const noexcept {
+    return m_positive.size() + m_negative.size() + (m_zeroCount > 0 ? 1 : 0);
+  }
+
+private:
+  struct Bucket {
+    int32_t index;
+    uint32_t count;
+  };
+
+  static void AddTo(std::vector<Bucket> &buckets, int32_t index, uint32_t count);
+  static void MergeInto(std::vector<Bucket> &buckets, std::vector<Bucket> const &other);
+  void Collapse();
+
+  // Sorted by index; negative values are bucketed by magnitude
+  std::vector<Bucket> m_positive;
+  std::vector<Bucket> m_negative;
+  uint64_t m_zeroCount = 0;
+  uint64_t m_count = 0;
+};
+
+struct NamedSketch {
+  std::string name;
+  QuantileSketch sketch;
+};
+
+// A file of named sketches, e.g. one per collector, so that files from many
+// sessions can be merged by name: "DAIQ", version byte, varint entry count,
+// each entry as varint name length, name, varint sketch length and
+// QuantileSketch::Encode bytes, then a little-endian CRC-32 of everything
+// before it.
+std::vector<uint8_t> EncodeSketchSet(std::span<NamedSketch const> sketches);
+// nullopt when the data is truncated, corrupt or of another version
+std::optional<std::vector<NamedSketch>> DecodeSketchSet(std::span<uint8_t const> bytes);
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "PlatformProvider.h"
+#include "ProviderTrace.h"
+
+#include <type_traits>
+
+namespace ReactNativeDeviceAiCore {
+
+// Passes every read through to another provider and appends what it returned,
+// with when it started and how long it took, to a trace. A read that throws
+// is recorded as failing every field and the exception is rethrown.
+class RecordingProvider final : public PlatformProvider {
+public:
+  RecordingProvider(PlatformProvider &inner, ProviderTraceWriter &writer) : m_inner(inner), m_writer(writer) {}
+
+  const char *Name() const noexcept override {
+    return m_inner.Name();
+  }
+
+  MemoryReading ReadMemory() override {
+    return Record([this] { return m_inner.ReadMemory(); });
+  }
+
+  StorageReading ReadStorage() override {
+    return Record([this] { return m_inner.ReadStorage(); });
+  }
+
+  BatteryReading ReadBattery() override {
+    return Record([this] { return m_inner.ReadBattery(); });
+  }
+
+  CpuReading ReadCpu() override {
+    return Record([this] { return m_inner.ReadCpu(); });
+  }
+
+  NetworkReading ReadNetwork() override {
+    return Record([this] { return m_inner.ReadNetwork(); });
+  }
+
+  CounterReading ReadPerformanceCounters() override {
+    return Record([this] { return m_inner.ReadPerformanceCounters(); });
+  }
+
+  WmiReading ReadWmi() override {
+    return Record([this] { return m_inner.ReadWmi(); });
+  }
+
+  IdentityReading ReadIdentity() override {
+    return Record([this] { return m_inner.ReadIdentity(); });
+  }
+
+private:
+  template <typename Read>
+  std::invoke_result_t<Read> Record(Read read) {
+    auto atUs = m_writer.NowUs();
+    try {
+      auto reading = read();
+      m_writer.Write(atUs, m_writer.NowUs() - atUs, reading);
+      return reading;
+    } catch (...) {
+      m_writer.Write(atUs, m_writer.NowUs() - atUs, std::invoke_result_t<Read>{});
+      throw;
+    }
+  }
+
+  PlatformProvider &m_inner;
+  ProviderTraceWriter &m_writer;
+};
+
+} // namespace ReactNativeDeviceAiCore
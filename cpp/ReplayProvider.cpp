@@ -0,0 +1,126 @@
+#include "ReplayProvider.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+template <typename Reads>
+void Earliest(Reads const &reads, int64_t &origin) noexcept {
+  if (!reads.empty()) {
+    origin = std::min(origin, reads.front().atUs);
+  }
+}
+
+int64_t OriginOf(ProviderTrace const &trace) noexcept {
+  auto origin = std::numeric_limits<int64_t>::max();
+  Earliest(trace.memory, origin);
+  Earliest(trace.storage, origin);
+  Earliest(trace.battery, origin);
+  Earliest(trace.cpu, origin);
+  Earliest(trace.network, origin);
+  Earliest(trace.performanceCounters, origin);
+  Earliest(trace.wmi, origin);
+  Earliest(trace.identity, origin);
+  return origin == std::numeric_limits<int64_t>::max() ? 0 : origin;
+}
+
+} // namespace
+
+ReplayProvider::ReplayProvider(ProviderTrace trace, ReplayOptions options)
+    : m_trace(std::move(trace)), m_options(options), m_originUs(OriginOf(m_trace)), m_durationUs(m_trace.DurationUs()) {
+  m_sizes[static_cast<size_t>(Collector::Memory)] = m_trace.memory.size();
+  m_sizes[static_cast<size_t>(Collector::Storage)] = m_trace.storage.size();
+  m_sizes[static_cast<size_t>(Collector::Battery)] = m_trace.battery.size();
+  m_sizes[static_cast<size_t>(Collector::Cpu)] = m_trace.cpu.size();
+  m_sizes[static_cast<size_t>(Collector::Network)] = m_trace.network.size();
+  m_sizes[static_cast<size_t>(Collector::PerformanceCounters)] = m_trace.performanceCounters.size();
+  m_sizes[static_cast<size_t>(Collector::Wmi)] = m_trace.wmi.size();
+  m_sizes[kIdentityKind] = m_trace.identity.size();
+}
+
+bool ReplayProvider::Finished() const {
+  if (m_options.loop) {
+    return false;
+  }
+  std::lock_guard lock(m_mutex);
+  for (size_t kind = 0; kind < kKinds; ++kind) {
+    if (m_cursors[kind] < m_sizes[kind]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ReplayProvider::WaitUntil(int64_t traceUs) const {
+  std::chrono::steady_clock::time_point startedAt;
+  {
+    std::lock_guard lock(m_mutex);
+    startedAt = *m_startedAt;
+  }
+  auto offset = std::chrono::duration<double, std::micro>(static_cast<double>(traceUs - m_originUs) / m_options.speed);
+  std::this_thread::sleep_until(startedAt + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset));
+}
+
+template <typename Reading>
+Reading ReplayProvider::Next(uint8_t kind, std::vector<TracedRead<Reading>> const &reads) {
+  size_t index = 0;
+  {
+    std::lock_guard lock(m_mutex);
+    if (!m_startedAt) {
+      m_startedAt = std::chrono::steady_clock::now();
+    }
+    index = m_cursors[kind]++;
+  }
+  if (reads.empty() || (!m_options.loop && index >= reads.size())) {
+    // Out of recorded reads: the collector fails from here on
+    return Reading{};
+  }
+
+  auto const &read = reads[index % reads.size()];
+  auto pass = static_cast<int64_t>(index / reads.size());
+  if (m_options.speed > 0.0) {
+    WaitUntil(read.atUs + pass * m_durationUs);
+    if (m_options.replayLatency) {
+      std::this_thread::sleep_for(std::chrono::duration<double, std::micro>(static_cast<double>(read.durationUs) / m_options.speed));
+    }
+  }
+  return read.reading;
+}
+
+MemoryReading ReplayProvider::ReadMemory() {
+  return Next(static_cast<uint8_t>(Collector::Memory), m_trace.memory);
+}
+
+StorageReading ReplayProvider::ReadStorage() {
+  return Next(static_cast<uint8_t>(Collector::Storage), m_trace.storage);
+}
+
+BatteryReading ReplayProvider::ReadBattery() {
+  return Next(static_cast<uint8_t>(Collector::Battery), m_trace.battery);
+}
+
+CpuReading ReplayProvider::ReadCpu() {
+  return Next(static_cast<uint8_t>(Collector::Cpu), m_trace.cpu);
+}
+
+NetworkReading ReplayProvider::ReadNetwork() {
+  return Next(static_cast<uint8_t>(Collector::Network), m_trace.network);
+}
+
+CounterReading ReplayProvider::ReadPerformanceCounters() {
+  return Next(static_cast<uint8_t>(Collector::PerformanceCounters), m_trace.performanceCounters);
+}
+
+WmiReading ReplayProvider::ReadWmi() {
+  return Next(static_cast<uint8_t>(Collector::Wmi), m_trace.wmi);
+}
+
+IdentityReading ReplayProvider::ReadIdentity() {
+  return Next(kIdentityKind, m_trace.identity);
+}
+
+} // namespace ReactNativeDeviceAiCore
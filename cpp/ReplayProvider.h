@@ -0,0 +1,74 @@
+#pragma once
+
+#include "PlatformProvider.h"
+#include "ProviderTrace.h"
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <optional>
+
+namespace ReactNativeDeviceAiCore {
+
+struct ReplayOptions {
+  // 1 replays at recorded speed, 10 ten times faster; 0 answers every read
+  // immediately, which is what benchmarks and tests want
+  double speed = 0.0;
+  // Start over once a collector runs out of recorded reads instead of failing
+  bool loop = false;
+  // Also spend each read's recorded duration (scaled by speed)
+  bool replayLatency = false;
+};
+
+// Answers each read with the next recorded reading for that collector, in
+// recorded order, so collection on any machine sees exactly what the
+// recording machine saw. When paced, a read waits until its recorded start
+// time (relative to the first replayed read) has come around; the wait is
+// part of the read, so it shows up in that collector's span.
+class ReplayProvider final : public PlatformProvider {
+public:
+  explicit ReplayProvider(ProviderTrace trace, ReplayOptions options = {});
+
+  const char *Name() const noexcept override {
+    return "replay";
+  }
+
+  // Provider the trace was recorded from
+  std::string const &RecordedProvider() const noexcept {
+    return m_trace.provider;
+  }
+
+  // True once every collector that has recorded reads has used them all;
+  // never when looping
+  bool Finished() const;
+
+  MemoryReading ReadMemory() override;
+  StorageReading ReadStorage() override;
+  BatteryReading ReadBattery() override;
+  CpuReading ReadCpu() override;
+  NetworkReading ReadNetwork() override;
+  CounterReading ReadPerformanceCounters() override;
+  WmiReading ReadWmi() override;
+  IdentityReading ReadIdentity() override;
+
+private:
+  static constexpr size_t kKinds = kCollectorCount + 1;
+
+  template <typename Reading>
+  Reading Next(uint8_t kind, std::vector<TracedRead<Reading>> const &reads);
+  void WaitUntil(int64_t traceUs) const;
+
+  ProviderTrace const m_trace;
+  ReplayOptions const m_options;
+  // Earliest recorded start, which replay time zero maps to
+  int64_t const m_originUs;
+  // One pass of the trace, added to each looped read's start time
+  int64_t const m_durationUs;
+
+  mutable std::mutex m_mutex;
+  std::optional<std::chrono::steady_clock::time_point> m_startedAt;
+  std::array<size_t, kKinds> m_cursors{};
+  std::array<size_t, kKinds> m_sizes{};
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace ReactNativeDeviceAiCore {
+
+// Sequence lock over a trivially copyable value with a single writer. The
+// version is odd while a Store() is in progress; readers copy without locking
+// and retry when the version moved under them, so they never see a mix of two
+// stores and never hold up the writer. The value lives in relaxed atomic
+// words, which keeps the racing copies well defined.
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+  explicit SeqLock(T const &initial = T{}) noexcept {
+    Write(initial);
+  }
+
+  SeqLock(SeqLock const &) = delete;
+  SeqLock &operator=(SeqLock const &) = delete;
+
+  // Must not be called from two threads at once
+  void Store(T const &value) noexcept {
+    auto version = m_version.load(std::memory_order_relaxed);
+    m_version.store(version + 1, std::memory_order_relaxed);
+    // Orders the odd version before the word stores
+    std::atomic_thread_fence(std::memory_order_release);
+    Write(value);
+    m_version.store(version + 2, std::memory_order_release);
+  }
+
+  T Load() const noexcept {
+    T value;
+    LoadBytes(0, sizeof(T), &value);
+    return value;
+  }
+
+  // size bytes at offset, from a single store; lets callers copy one member
+  // without copying the whole value
+  void LoadBytes(size_t offset, size_t size, void *out) const noexcept {
+    auto *target = static_cast<unsigned char *>(out);
+    auto first = offset / kWordSize;
+    auto last = (offset + size + kWordSize - 1) / kWordSize;
+
+    while (true) {
+      auto version = m_version.load(std::memory_order_acquire);
+      if (version & 1) {
+        // A store takes well under a microsecond unless the writer was preempted
+        std::this_thread::yield();
+        continue;
+      }
+
+      for (auto i = first; i < last; ++i) {
+        auto word = m_words[i].load(std::memory_order_relaxed);
+        auto wordStart = i * kWordSize;
+        auto begin = std::max(wordStart, offset);
+        auto end = std::min(wordStart + kWordSize, offset + size);
+        std::memcpy(target + (begin - offset), reinterpret_cast<unsigned char const *>(&word) + (begin - wordStart), end - begin);
+      }
+
+      // Orders the word loads before the version check
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (m_version.load(std::memory_order_relaxed) == version) {
+        return;
+      }
+    }
+  }
+
+  // Completed stores, not counting the initial value
+  uint64_t Stores() const noexcept {
+    return m_version.load(std::memory_order_relaxed) / 2;
+  }
+
+private:
+  static constexpr size_t kWordSize = sizeof(uint64_t);
+  static constexpr size_t kWordCount = (sizeof(T) + kWordSize - 1) / kWordSize;
+
+  void Write(T const &value) noexcept {
+    auto const *bytes = reinterpret_cast<unsigned char const *>(&value);
+    for (size_t i = 0; i < kWordCount; ++i) {
+      uint64_t word = 0;
+      std::memcpy(&word, bytes + i * kWordSize, std::min(kWordSize, sizeof(T) - i * kWordSize));
+      m_words[i].store(word, std::memory_order_relaxed);
+    }
+  }
+
+  alignas(64) std::atomic<uint64_t> m_version{0};
+  alignas(64) std::array<std::atomic<uint64_t>, kWordCount> m_words;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Clock.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+struct SingleFlightStats {
+  uint64_t requests = 0;
+  uint64_t collections = 0;
+  uint64_t coalesced = 0;
+  uint64_t cacheHits = 0;
+  uint64_t failures = 0;
+};
+
+// Coalesces concurrent requests for the same expensive value. The first caller
+// becomes the leader and must run the collection and hand the result to
+// Complete(); callers arriving while it is in flight attach to it, and callers
+// within freshnessMs of a successful collection are answered from that result.
+// Waiters run on the thread that calls Complete(), or inline on a cache hit.
+template <typename T>
+class SingleFlight {
+public:
+  using Waiter = std::function<void(std::optional<T> const &)>;
+
+  explicit SingleFlight(int64_t freshnessMs = 1000, Clock const &clock = SteadyClock::Instance()) noexcept
+      : m_clock(clock), m_freshnessMs(freshnessMs) {}
+
+  SingleFlight(SingleFlight const &) = delete;
+  SingleFlight &operator=(SingleFlight const &) = delete;
+
+  ~SingleFlight() {
+    WaitIdle();
+  }
+
+  // Returns true when the caller is the leader and must collect and Complete().
+  bool Join(Waiter waiter) {
+    std::unique_lock lock(m_mutex);
+    ++m_stats.requests;
+
+    if (m_cached && m_clock.NowMs() - m_cachedAtMs <= m_freshnessMs) {
+      ++m_stats.cacheHits;
+      auto cached = m_cached;
+      lock.unlock();
+      waiter(cached);
+      return false;
+    }
+
+    m_waiters.push_back(std::move(waiter));
+    if (m_inFlight) {
+      ++m_stats.coalesced;
+      return false;
+    }
+
+    m_inFlight = true;
+    ++m_stats.collections;
+    return true;
+  }
+
+  // Publishes the leader's result to every attached waiter. nullopt marks a
+  // failed collection, which is reported to the waiters but never cached.
+  // Waiters may Join() again; that starts a new flight.
+  void Complete(std::optional<T> value) {
+    std::vector<Waiter> waiters;
+    {
+      std::lock_guard lock(m_mutex);
+      waiters.swap(m_waiters);
+      m_inFlight = false;
+      ++m_completing;
+      if (value) {
+        m_cached = value;
+        m_cachedAtMs = m_clock.NowMs();
+      } else {
+        ++m_stats.failures;
+      }
+    }
+
+    for (auto &waiter : waiters) {
+      waiter(value);
+    }
+
+    // Notify under the lock so a WaitIdle() owner cannot destroy us mid-notify
+    std::lock_guard lock(m_mutex);
+    --m_completing;
+    m_idle.notify_all();
+  }
+
+  void SetFreshnessMs(int64_t freshnessMs) noexcept {
+    std::lock_guard lock(m_mutex);
+    m_freshnessMs = freshnessMs;
+  }
+
+  void Invalidate() noexcept {
+    std::lock_guard lock(m_mutex);
+    m_cached.reset();
+  }
+
+  // Blocks until no collection is in flight so owners can tear down safely.
+  void WaitIdle() {
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock, [this] { return !m_inFlight && m_completing == 0; });
+  }
+
+  SingleFlightStats Stats() const {
+    std::lock_guard lock(m_mutex);
+    return m_stats;
+  }
+
+private:
+  Clock const &m_clock;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_idle;
+  int64_t m_freshnessMs;
+  bool m_inFlight = false;
+  int m_completing = 0;
+  std::vector<Waiter> m_waiters;
+  std::optional<T> m_cached;
+  int64_t m_cachedAtMs = 0;
+  SingleFlightStats m_stats;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,161 @@
+#include "SnapshotAssembler.h"
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+// A read that throws reports every field of its reading as failed
+template <typename Reading, typename Read>
+Reading ReadOrEmpty(Read read) noexcept {
+  try {
+    return read();
+  } catch (...) {
+    return Reading{};
+  }
+}
+
+} // namespace
+
+Span SpanOf(Collector collector) noexcept {
+  switch (collector) {
+    case Collector::Memory:
+      return Span::Memory;
+    case Collector::Storage:
+      return Span::Storage;
+    case Collector::Battery:
+      return Span::Battery;
+    case Collector::Cpu:
+      return Span::Cpu;
+    case Collector::Network:
+      return Span::Network;
+    case Collector::PerformanceCounters:
+      return Span::PerformanceCounters;
+    case Collector::Wmi:
+      return Span::Wmi;
+  }
+  return Span::Memory;
+}
+
+SnapshotAssembler::SnapshotAssembler(PlatformProvider &provider, SpanRecorder &spans) : m_provider(provider), m_spans(spans) {
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    m_metrics[i] = std::make_unique<LastKnownValue<double>>(m_values, ToString(static_cast<Metric>(i)));
+  }
+  for (size_t i = 0; i < kTextFieldCount; ++i) {
+    m_texts[i] = std::make_unique<LastKnownValue<std::string>>(m_values, ToString(static_cast<TextField>(i)));
+  }
+}
+
+void SnapshotAssembler::Resolve(
+    Metric metric, Sourced<double> const &reading, DeviceSnapshot &snapshot, SectionState &state, int64_t nowMs) {
+  auto resolved = m_metrics[static_cast<size_t>(metric)]->Resolve(reading.value, reading.source, nowMs);
+  auto &value = snapshot[metric];
+  value.state = resolved.state;
+  value.ageMs = resolved.ageMs;
+  value.value = state.Add(std::move(resolved)).value_or(0.0);
+}
+
+void SnapshotAssembler::Resolve(
+    Metric metric, Sourced<bool> const &reading, DeviceSnapshot &snapshot, SectionState &state, int64_t nowMs) {
+  Sourced<double> numeric{reading.value ? std::optional<double>(*reading.value ? 1.0 : 0.0) : std::nullopt, reading.source};
+  Resolve(metric, numeric, snapshot, state, nowMs);
+}
+
+void SnapshotAssembler::Resolve(
+    TextField field, Sourced<std::string> reading, DeviceSnapshot &snapshot, SectionState &state, int64_t nowMs) {
+  // An empty string is as good as no answer
+  if (reading.value && reading.value->empty()) {
+    reading.value.reset();
+  }
+  auto resolved = m_texts[static_cast<size_t>(field)]->Resolve(std::move(reading.value), reading.source, nowMs);
+  auto &text = snapshot[field];
+  text.state = resolved.state;
+  text.ageMs = resolved.ageMs;
+  text.Assign(state.Add(std::move(resolved)).value_or(std::string()));
+}
+
+bool SnapshotAssembler::Collect(Collector collector, DeviceSnapshot &snapshot, int64_t nowMs) {
+  ScopedSpan span(m_spans, SpanOf(collector));
+  SectionState state;
+
+  switch (collector) {
+    case Collector::Memory: {
+      auto reading = ReadOrEmpty<MemoryReading>([this] { return m_provider.ReadMemory(); });
+      Resolve(Metric::MemoryTotal, reading.total, snapshot, state, nowMs);
+      Resolve(Metric::MemoryAvailable, reading.available, snapshot, state, nowMs);
+      break;
+    }
+    case Collector::Storage: {
+      auto reading = ReadOrEmpty<StorageReading>([this] { return m_provider.ReadStorage(); });
+      Resolve(Metric::StorageTotal, reading.total, snapshot, state, nowMs);
+      Resolve(Metric::StorageAvailable, reading.available, snapshot, state, nowMs);
+      break;
+    }
+    case Collector::Battery: {
+      auto reading = ReadOrEmpty<BatteryReading>([this] { return m_provider.ReadBattery(); });
+      Resolve(Metric::BatteryLevel, reading.level, snapshot, state, nowMs);
+      Resolve(Metric::BatteryCharging, reading.charging, snapshot, state, nowMs);
+      break;
+    }
+    case Collector::Cpu: {
+      auto reading = ReadOrEmpty<CpuReading>([this] { return m_provider.ReadCpu(); });
+      Resolve(Metric::CpuUsage, reading.usage, snapshot, state, nowMs);
+      Resolve(Metric::CpuCores, reading.cores, snapshot, state, nowMs);
+      break;
+    }
+    case Collector::Network: {
+      auto reading = ReadOrEmpty<NetworkReading>([this] { return m_provider.ReadNetwork(); });
+      Resolve(TextField::NetworkType, std::move(reading.type), snapshot, state, nowMs);
+      Resolve(Metric::NetworkConnected, reading.connected, snapshot, state, nowMs);
+      break;
+    }
+    case Collector::PerformanceCounters: {
+      auto reading = ReadOrEmpty<CounterReading>([this] { return m_provider.ReadPerformanceCounters(); });
+      Resolve(Metric::CounterCpuUsage, reading.cpuUsage, snapshot, state, nowMs);
+      Resolve(Metric::CounterMemoryUsage, reading.memoryUsage, snapshot, state, nowMs);
+      Resolve(Metric::CounterDiskUsage, reading.diskUsage, snapshot, state, nowMs);
+      break;
+    }
+    case Collector::Wmi: {
+      auto reading = ReadOrEmpty<WmiReading>([this] { return m_provider.ReadWmi(); });
+      Resolve(TextField::WmiComputerSystem, std::move(reading.computerSystem), snapshot, state, nowMs);
+      Resolve(TextField::WmiOperatingSystem, std::move(reading.operatingSystem), snapshot, state, nowMs);
+      Resolve(TextField::WmiProcessor, std::move(reading.processor), snapshot, state, nowMs);
+      break;
+    }
+  }
+
+  auto &section = snapshot.Section(collector);
+  section.state = state.State();
+  section.ageMs = state.AgeMs().value_or(0);
+  if (state.State() != ValueState::Live) {
+    span.Fallback();
+  }
+  if (!state.AnyLive()) {
+    span.Fail();
+    return false;
+  }
+  return true;
+}
+
+void SnapshotAssembler::CollectIdentity(DeviceSnapshot &snapshot, int64_t nowMs) {
+  auto reading = ReadOrEmpty<IdentityReading>([this] { return m_provider.ReadIdentity(); });
+  // Identity strings are reported individually, so their combined state is unused
+  SectionState state;
+  Resolve(TextField::OsVersion, std::move(reading.osVersion), snapshot, state, nowMs);
+  Resolve(TextField::BuildNumber, std::move(reading.buildNumber), snapshot, state, nowMs);
+  Resolve(TextField::Processor, std::move(reading.processor), snapshot, state, nowMs);
+  Resolve(TextField::Architecture, std::move(reading.architecture), snapshot, state, nowMs);
+}
+
+DeviceSnapshot SnapshotAssembler::Assemble(int64_t nowMs) {
+  DeviceSnapshot snapshot;
+  snapshot.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+  snapshot.timestampMs = nowMs;
+  for (size_t i = 0; i < kCollectorCount; ++i) {
+    Collect(static_cast<Collector>(i), snapshot, nowMs);
+  }
+  CollectIdentity(snapshot, nowMs);
+  return snapshot;
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "DeviceSnapshot.h"
+#include "LastKnownValue.h"
+#include "PlatformProvider.h"
+#include "SpanRecorder.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ReactNativeDeviceAiCore {
+
+// Span that times a collector's whole read
+Span SpanOf(Collector collector) noexcept;
+
+// Turns raw provider reads into a DeviceSnapshot: every field goes through its
+// LastKnownValue, each collector's section gets its worst state and oldest
+// age, and each read is timed as a span. Collect() may run concurrently for
+// different collectors as long as each call fills its own snapshot.
+class SnapshotAssembler {
+public:
+  SnapshotAssembler(PlatformProvider &provider, SpanRecorder &spans);
+  SnapshotAssembler(SnapshotAssembler const &) = delete;
+  SnapshotAssembler &operator=(SnapshotAssembler const &) = delete;
+
+  // Fills one collector's fields and section. Returns false when no field was
+  // read live, which is what counts as a collector failure.
+  bool Collect(Collector collector, DeviceSnapshot &snapshot, int64_t nowMs);
+
+  // Fills the identity strings, which belong to no collector section
+  void CollectIdentity(DeviceSnapshot &snapshot, int64_t nowMs);
+
+  // Every collector and the identity strings, one after another, stamped with
+  // the next sequence number
+  DeviceSnapshot Assemble(int64_t nowMs);
+
+  std::vector<FieldStats> FallbackStats(int64_t nowMs) const {
+    return m_values.Stats(nowMs);
+  }
+
+  PlatformProvider &Provider() const noexcept {
+    return m_provider;
+  }
+
+private:
+  void Resolve(Metric metric, Sourced<double> const &reading, DeviceSnapshot &snapshot, SectionState &state, int64_t nowMs);
+  void Resolve(Metric metric, Sourced<bool> const &reading, DeviceSnapshot &snapshot, SectionState &state, int64_t nowMs);
+  void Resolve(TextField field, Sourced<std::string> reading, DeviceSnapshot &snapshot, SectionState &state, int64_t nowMs);
+
+  PlatformProvider &m_provider;
+  SpanRecorder &m_spans;
+  ValueStore m_values;
+  std::array<std::unique_ptr<LastKnownValue<double>>, kMetricCount> m_metrics;
+  std::array<std::unique_ptr<LastKnownValue<std::string>>, kTextFieldCount> m_texts;
+  std::atomic<uint64_t> m_sequence{0};
+};
+
+} // namespace ReactNativeDeviceAiCore
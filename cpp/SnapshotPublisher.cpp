@@ -0,0 +1,38 @@
+#include "SnapshotPublisher.h"
+
+#include <type_traits>
+
+namespace ReactNativeDeviceAiCore {
+
+// Field offsets below rely on it
+static_assert(std::is_standard_layout_v<DeviceSnapshot>);
+
+void SnapshotPublisher::Publish(DeviceSnapshot const &snapshot) noexcept {
+  m_latest.Store(snapshot);
+}
+
+DeviceSnapshot SnapshotPublisher::Latest() const noexcept {
+  return m_latest.Load();
+}
+
+MetricValue SnapshotPublisher::Read(Metric metric) const noexcept {
+  return ReadField<MetricValue>(offsetof(DeviceSnapshot, metrics) + static_cast<size_t>(metric) * sizeof(MetricValue));
+}
+
+TextValue SnapshotPublisher::Read(TextField field) const noexcept {
+  return ReadField<TextValue>(offsetof(DeviceSnapshot, texts) + static_cast<size_t>(field) * sizeof(TextValue));
+}
+
+SectionSummary SnapshotPublisher::Read(Collector collector) const noexcept {
+  return ReadField<SectionSummary>(offsetof(DeviceSnapshot, sections) + static_cast<size_t>(collector) * sizeof(SectionSummary));
+}
+
+uint64_t SnapshotPublisher::Sequence() const noexcept {
+  return ReadField<uint64_t>(offsetof(DeviceSnapshot, sequence));
+}
+
+int64_t SnapshotPublisher::TimestampMs() const noexcept {
+  return ReadField<int64_t>(offsetof(DeviceSnapshot, timestampMs));
+}
+
+} // namespace ReactNativeDeviceAiCore
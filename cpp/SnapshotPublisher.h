@@ -0,0 +1,49 @@
+#pragma once
+
+#include "DeviceSnapshot.h"
+#include "SeqLock.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ReactNativeDeviceAiCore {
+
+// Latest DeviceSnapshot, published by a single writer thread through a
+// SeqLock. Readers on any thread get either a whole snapshot or fields of one,
+// never a mix of two publishes, and never block the writer.
+class SnapshotPublisher {
+public:
+  SnapshotPublisher() noexcept = default;
+  SnapshotPublisher(SnapshotPublisher const &) = delete;
+  SnapshotPublisher &operator=(SnapshotPublisher const &) = delete;
+
+  // Must not be called from two threads at once
+  void Publish(DeviceSnapshot const &snapshot) noexcept;
+
+  // Copy of the latest snapshot; sequence 0 and every field unknown until the
+  // first publish
+  DeviceSnapshot Latest() const noexcept;
+
+  // Single fields, copying only the bytes they cover
+  MetricValue Read(Metric metric) const noexcept;
+  TextValue Read(TextField field) const noexcept;
+  SectionSummary Read(Collector collector) const noexcept;
+  uint64_t Sequence() const noexcept;
+  int64_t TimestampMs() const noexcept;
+
+  uint64_t Publishes() const noexcept {
+    return m_latest.Stores();
+  }
+
+private:
+  template <typename Field>
+  Field ReadField(size_t offset) const noexcept {
+    Field field;
+    m_latest.LoadBytes(offset, sizeof(Field), &field);
+    return field;
+  }
+
+  SeqLock<DeviceSnapshot> m_latest;
+};
+
+} // namespace ReactNativeDeviceAiCore
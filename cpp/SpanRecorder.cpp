@@ -0,0 +1,87 @@
+#include "SpanRecorder.h"
+
+#include <algorithm>
+
+namespace ReactNativeDeviceAiCore {
+
+const char *ToString(Span span) noexcept {
+  switch (span) {
+    case Span::Memory:
+      return "memory";
+    case Span::Storage:
+      return "storage";
+    case Span::Battery:
+      return "battery";
+    case Span::Cpu:
+      return "cpu";
+    case Span::Network:
+      return "network";
+    case Span::PerformanceCounters:
+      return "performanceCounters";
+    case Span::Wmi:
+      return "wmi";
+    case Span::PdhQuery:
+      return "pdh.query";
+    case Span::WmiConnect:
+      return "wmi.connect";
+    case Span::WmiComputerSystem:
+      return "wmi.computerSystem";
+    case Span::WmiOperatingSystem:
+      return "wmi.operatingSystem";
+    case Span::WmiProcessor:
+      return "wmi.processor";
+    case Span::RegistryRead:
+      return "registry.read";
+  }
+  return "unknown";
+}
+
+void SpanRecorder::Record(Span span, uint64_t durationNs, bool succeeded) noexcept {
+  auto &counters = m_spans[static_cast<size_t>(span)];
+  counters.latency.Record(durationNs);
+  if (!succeeded) {
+    counters.failures.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void SpanRecorder::RecordFallback(Span span) noexcept {
+  m_spans[static_cast<size_t>(span)].fallbacks.fetch_add(1, std::memory_order_relaxed);
+}
+
+SpanStats SpanRecorder::Snapshot(Span span) const noexcept {
+  auto const &counters = m_spans[static_cast<size_t>(span)];
+  SpanStats stats;
+  stats.latency = counters.latency.Snapshot();
+  stats.calls = stats.latency.count;
+  stats.failures = counters.failures.load(std::memory_order_relaxed);
+  stats.fallbacks = counters.fallbacks.load(std::memory_order_relaxed);
+  return stats;
+}
+
+QuantileSketch SpanRecorder::LatencySketch(Span span) const {
+  constexpr double kNsPerMs = 1e6;
+  auto const &latency = m_spans[static_cast<size_t>(span)].latency;
+  QuantileSketch sketch;
+  uint64_t lowerNs = 0;
+  for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+    auto upperNs = LatencyHistogram::BucketUpperBound(i);
+    // Counts past a sketch bucket's capacity go in more than one add
+    for (auto count = latency.BucketCount(i); count > 0;) {
+      auto added = static_cast<uint32_t>(std::min<uint64_t>(count, UINT32_MAX));
+      sketch.Add((static_cast<double>(lowerNs) + static_cast<double>(upperNs)) / 2.0 / kNsPerMs, added);
+      count -= added;
+    }
+    lowerNs = upperNs + 1;
+  }
+  return sketch;
+}
+
+void ScopedSpan::Trace([[maybe_unused]] int64_t durationNs) const noexcept {
+#if DEVICEAI_TRACING
+  auto status = !m_succeeded ? TraceStatus::Failed : m_fellBack ? TraceStatus::Fallback : TraceStatus::Ok;
+  auto startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(m_start.time_since_epoch()).count();
+  TraceRecorder::Instance().Complete(ToString(m_span), startNs, durationNs, status);
+#endif
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "LatencyHistogram.h"
+#include "QuantileSketch.h"
+#include "TraceRecorder.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace ReactNativeDeviceAiCore {
+
+// Timed regions of native collection: the seven collectors plus the PDH, WMI
+// and registry calls inside them.
+enum class Span {
+  Memory,
+  Storage,
+  Battery,
+  Cpu,
+  Network,
+  PerformanceCounters,
+  Wmi,
+  PdhQuery,
+  WmiConnect,
+  WmiComputerSystem,
+  WmiOperatingSystem,
+  WmiProcessor,
+  RegistryRead,
+};
+
+constexpr size_t kSpanCount = 13;
+
+const char *ToString(Span span) noexcept;
+
+struct SpanStats {
+  uint64_t calls = 0;
+  uint64_t failures = 0;
+  uint64_t fallbacks = 0;
+  HistogramSnapshot latency;
+};
+
+// Per-span latency histograms and call, failure and fallback counters. Every
+// update is a relaxed atomic, so spans can be recorded from any thread.
+class SpanRecorder {
+public:
+  void Record(Span span, uint64_t durationNs, bool succeeded) noexcept;
+  void RecordFallback(Span span) noexcept;
+  SpanStats Snapshot(Span span) const noexcept;
+
+  // The span's latencies in milliseconds as a mergeable sketch, each
+  // histogram bucket counted at its midpoint, for combining with sketches from
+  // other sessions or devices
+  QuantileSketch LatencySketch(Span span) const;
+
+private:
+  struct Counters {
+    LatencyHistogram latency;
+    std::atomic<uint64_t> failures{0};
+    std::atomic<uint64_t> fallbacks{0};
+  };
+
+  std::array<Counters, kSpanCount> m_spans;
+};
+
+// Times the enclosing scope into a span on the steady clock, and into the
+// process trace while tracing is enabled.
+class ScopedSpan {
+public:
+  ScopedSpan(SpanRecorder &recorder, Span span) noexcept
+      : m_recorder(recorder), m_span(span), m_start(std::chrono::steady_clock::now()) {}
+
+  ScopedSpan(ScopedSpan const &) = delete;
+  ScopedSpan &operator=(ScopedSpan const &) = delete;
+
+  ~ScopedSpan() {
+    auto durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+    m_recorder.Record(m_span, static_cast<uint64_t>(durationNs), m_succeeded);
+#if DEVICEAI_TRACING
+    if (TraceRecorder::Instance().Enabled()) [[unlikely]] {
+      Trace(durationNs);
+    }
+#endif
+  }
+
+  void Fail() noexcept {
+    m_succeeded = false;
+  }
+
+  // The span answered at least partly from last-known or unknown values
+  void Fallback() noexcept {
+    m_fellBack = true;
+    m_recorder.RecordFallback(m_span);
+  }
+
+private:
+  void Trace(int64_t durationNs) const noexcept;
+
+  SpanRecorder &m_recorder;
+  Span const m_span;
+  std::chrono::steady_clock::time_point const m_start;
+  bool m_succeeded = true;
+  bool m_fellBack = false;
+};
+
+} // namespace ReactNativeDeviceAiCore
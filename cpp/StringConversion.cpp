@@ -0,0 +1,76 @@
+#include "StringConversion.h"
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+constexpr char32_t kReplacement = 0xFFFD;
+
+void AppendUtf8(std::string &out, char32_t codePoint) {
+  if (codePoint < 0x80) {
+    out += static_cast<char>(codePoint);
+  } else if (codePoint < 0x800) {
+    out += static_cast<char>(0xC0 | (codePoint >> 6));
+    out += static_cast<char>(0x80 | (codePoint & 0x3F));
+  } else if (codePoint < 0x10000) {
+    out += static_cast<char>(0xE0 | (codePoint >> 12));
+    out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (codePoint & 0x3F));
+  } else {
+    out += static_cast<char>(0xF0 | (codePoint >> 18));
+    out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+    out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (codePoint & 0x3F));
+  }
+}
+
+bool IsHighSurrogate(char32_t unit) noexcept {
+  return unit >= 0xD800 && unit <= 0xDBFF;
+}
+
+bool IsLowSurrogate(char32_t unit) noexcept {
+  return unit >= 0xDC00 && unit <= 0xDFFF;
+}
+
+template <typename Char>
+std::string FromUtf16(std::basic_string_view<Char> text) {
+  std::string out;
+  out.reserve(text.size());
+  for (size_t i = 0; i < text.size(); ++i) {
+    char32_t unit = static_cast<char16_t>(text[i]);
+    if (unit < 0x80) {
+      out += static_cast<char>(unit);
+    } else if (IsHighSurrogate(unit) && i + 1 < text.size() && IsLowSurrogate(static_cast<char16_t>(text[i + 1]))) {
+      char32_t low = static_cast<char16_t>(text[++i]);
+      AppendUtf8(out, 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00));
+    } else if (IsHighSurrogate(unit) || IsLowSurrogate(unit)) {
+      AppendUtf8(out, kReplacement);
+    } else {
+      AppendUtf8(out, unit);
+    }
+  }
+  return out;
+}
+
+} // namespace
+
+std::string Utf16ToUtf8(std::u16string_view text) {
+  return FromUtf16(text);
+}
+
+std::string WideToUtf8(std::wstring_view text) {
+  if constexpr (sizeof(wchar_t) == sizeof(char16_t)) {
+    return FromUtf16(text);
+  } else {
+    std::string out;
+    out.reserve(text.size());
+    for (auto unit : text) {
+      auto codePoint = static_cast<char32_t>(unit);
+      bool valid = codePoint < 0x110000 && !IsHighSurrogate(codePoint) && !IsLowSurrogate(codePoint);
+      AppendUtf8(out, valid ? codePoint : kReplacement);
+    }
+    return out;
+  }
+}
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace ReactNativeDeviceAiCore {
+
+// UTF-16 (Windows wide strings, BSTRs, registry values) to UTF-8. Unpaired
+// surrogates become U+FFFD rather than failing the whole string.
+std::string Utf16ToUtf8(std::u16string_view text);
+
+// wchar_t is UTF-16 on Windows and UTF-32 elsewhere; both are handled
+std::string WideToUtf8(std::wstring_view text);
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+namespace ReactNativeDeviceAiCore {
+
+// Where a coroutine resumes after co_await ScheduleOn(executor). The Windows
+// module posts to the thread pool; tests use plain threads.
+struct Executor {
+  virtual ~Executor() = default;
+  virtual void Post(std::coroutine_handle<> handle) noexcept = 0;
+};
+
+inline auto ScheduleOn(Executor &executor) noexcept {
+  struct Awaiter {
+    Executor &executor;
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const noexcept {
+      executor.Post(handle);
+    }
+
+    void await_resume() const noexcept {}
+  };
+  return Awaiter{executor};
+}
+
+// Eager coroutine nobody awaits, the portable counterpart of winrt::fire_and_forget.
+// The body must not throw; callers report failures through their own channel.
+struct FireAndForget {
+  struct promise_type {
+    FireAndForget get_return_object() const noexcept {
+      return {};
+    }
+
+    std::suspend_never initial_suspend() const noexcept {
+      return {};
+    }
+
+    std::suspend_never final_suspend() const noexcept {
+      return {};
+    }
+
+    void return_void() const noexcept {}
+
+    void unhandled_exception() const noexcept {
+      std::terminate();
+    }
+  };
+};
+
+// Counts detached coroutines so their owner can wait for them before tearing
+// down the state they use. A coroutine holds a Token for its whole lifetime.
+class AsyncScope {
+public:
+  class Token {
+  public:
+    Token(Token &&other) noexcept : m_scope(std::exchange(other.m_scope, nullptr)) {}
+    Token(Token const &) = delete;
+    Token &operator=(Token const &) = delete;
+    Token &operator=(Token &&) = delete;
+
+    ~Token() {
+      if (m_scope) {
+        m_scope->Leave();
+      }
+    }
+
+  private:
+    friend class AsyncScope;
+    explicit Token(AsyncScope *scope) noexcept : m_scope(scope) {}
+    AsyncScope *m_scope;
+  };
+
+  AsyncScope() = default;
+  AsyncScope(AsyncScope const &) = delete;
+  AsyncScope &operator=(AsyncScope const &) = delete;
+
+  ~AsyncScope() {
+    WaitIdle();
+  }
+
+  Token Enter() noexcept {
+    std::lock_guard lock(m_mutex);
+    ++m_pending;
+    return Token(this);
+  }
+
+  void WaitIdle() {
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock, [this] { return m_pending == 0; });
+  }
+
+private:
+  void Leave() noexcept {
+    // Notify under the lock so a waiting owner cannot destroy us mid-notify
+    std::lock_guard lock(m_mutex);
+    --m_pending;
+    m_idle.notify_all();
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_idle;
+  size_t m_pending = 0;
+};
+
+} // namespace ReactNativeDeviceAiCore
@@ -0,0 +1,168 @@
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace ReactNativeDeviceAiCore {
+
+namespace {
+
+std::atomic<uint64_t> g_nextRecorderId{1};
+
+// Each thread remembers its buffer in the last recorder it wrote to
+struct LocalCache {
+  uint64_t recorderId = 0;
+  void *buffer = nullptr;
+};
+thread_local LocalCache t_cache;
+
+void AppendEscaped(std::string &out, const char *text) {
+  for (; *text; ++text) {
+    switch (*text) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(*text) >= 0x20) {
+          out += *text;
+        }
+    }
+  }
+}
+
+} // namespace
+
+const char *ToString(TraceStatus status) noexcept {
+  switch (status) {
+    case TraceStatus::Ok:
+      return "ok";
+    case TraceStatus::Failed:
+      return "failed";
+    case TraceStatus::Fallback:
+      return "fallback";
+  }
+  return "ok";
+}
+
+TraceRecorder::TraceRecorder() : m_id(g_nextRecorderId.fetch_add(1, std::memory_order_relaxed)) {}
+
+TraceRecorder::~TraceRecorder() = default;
+
+TraceRecorder TraceRecorder::s_instance;
+
+void TraceRecorder::SetEnabled([[maybe_unused]] bool enabled) noexcept {
+#if DEVICEAI_TRACING
+  m_enabled.store(enabled, std::memory_order_relaxed);
+#endif
+}
+
+TraceRecorder::ThreadBuffer *TraceRecorder::LocalBuffer() {
+  if (t_cache.recorderId == m_id) {
+    return static_cast<ThreadBuffer *>(t_cache.buffer);
+  }
+
+  // A thread that alternates recorders gets a fresh buffer each time; only tests do that
+  auto buffer = std::make_unique<ThreadBuffer>();
+  std::lock_guard lock(m_mutex);
+  buffer->threadId = static_cast<uint32_t>(m_buffers.size() + 1);
+  m_buffers.push_back(std::move(buffer));
+  t_cache = {m_id, m_buffers.back().get()};
+  return m_buffers.back().get();
+}
+
+void TraceRecorder::Complete(const char *name, int64_t startNs, int64_t durationNs, TraceStatus status) noexcept {
+  if (!Enabled()) {
+    return;
+  }
+
+  ThreadBuffer *buffer;
+  try {
+    buffer = LocalBuffer();
+  } catch (...) {
+    return;
+  }
+
+  auto head = buffer->head.load(std::memory_order_relaxed);
+  auto &slot = buffer->slots[head % kEventsPerThread];
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.startNs.store(startNs, std::memory_order_relaxed);
+  slot.durationNs.store(durationNs, std::memory_order_relaxed);
+  slot.status.store(static_cast<uint8_t>(status), std::memory_order_relaxed);
+  buffer->head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<TraceEvent> TraceRecorder::Events() const {
+  std::vector<TraceEvent> events;
+  std::lock_guard lock(m_mutex);
+  for (auto const &buffer : m_buffers) {
+    auto head = buffer->head.load(std::memory_order_acquire);
+    auto first = std::max(buffer->tail.load(std::memory_order_relaxed), head > kEventsPerThread ? head - kEventsPerThread : 0);
+    auto copiedFrom = events.size();
+    for (auto index = first; index < head; ++index) {
+      auto const &slot = buffer->slots[index % kEventsPerThread];
+      TraceEvent event;
+      event.name = slot.name.load(std::memory_order_relaxed);
+      event.threadId = buffer->threadId;
+      event.startNs = slot.startNs.load(std::memory_order_relaxed);
+      event.durationNs = slot.durationNs.load(std::memory_order_relaxed);
+      event.status = static_cast<TraceStatus>(slot.status.load(std::memory_order_relaxed));
+      events.push_back(event);
+    }
+
+    // Drop the slots the writer lapped while they were copied
+    std::atomic_thread_fence(std::memory_order_acquire);
+    auto newHead = buffer->head.load(std::memory_order_relaxed);
+    // The writer may also be mid-way through the slot at newHead
+    if (newHead + 1 > first + kEventsPerThread) {
+      auto overwritten = std::min<uint64_t>(newHead + 1 - kEventsPerThread - first, head - first);
+      events.erase(events.begin() + static_cast<ptrdiff_t>(copiedFrom),
+          events.begin() + static_cast<ptrdiff_t>(copiedFrom + overwritten));
+    }
+  }
+  return events;
+}
+
+std::string TraceRecorder::ToChromeJson() const {
+  std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  char buffer[160];
+  for (auto const &event : Events()) {
+    if (!first) {
+      json += ',';
+    }
+    first = false;
+
+    // Complete ("X") events; trace_event timestamps are in microseconds
+    json += "{\"name\":\"";
+    AppendEscaped(json, event.name ? event.name : "");
+    std::snprintf(buffer, sizeof(buffer),
+        "\",\"cat\":\"deviceai\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"status\":\"%s\"}}",
+        event.threadId, static_cast<double>(event.startNs) / 1000.0, static_cast<double>(event.durationNs) / 1000.0,
+        ToString(event.status));
+    json += buffer;
+  }
+  json += "]}";
+  return json;
+}
+
+bool TraceRecorder::WriteChromeJson(std::string const &path) const {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+  file << ToChromeJson();
+  return static_cast<bool>(file);
+}
+
+void TraceRecorder::Clear() noexcept {
+  std::lock_guard lock(m_mutex);
+  for (auto &buffer : m_buffers) {
+    buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+  }
+}
+
+} // namespace ReactNativeDeviceAiCore
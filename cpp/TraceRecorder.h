@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Builds with DEVICEAI_TRACING=0 compile every trace hook out. Otherwise
+// tracing is off until SetEnabled(true) and a disabled hook costs one relaxed
+// load.
+#ifndef DEVICEAI_TRACING
+#define DEVICEAI_TRACING 1
+#endif
+
+namespace ReactNativeDeviceAiCore {
+
+enum class TraceStatus : uint8_t { Ok, Failed, Fallback };
+
+const char *ToString(TraceStatus status) noexcept;
+
+struct TraceEvent {
+  const char *name = nullptr;
+  uint32_t threadId = 0;
+  int64_t startNs = 0;
+  int64_t durationNs = 0;
+  TraceStatus status = TraceStatus::Ok;
+};
+
+// Records completed spans into one ring buffer per thread and exports them in
+// the Chrome trace_event format (chrome://tracing, Perfetto). Writers only
+// touch their own buffer and never lock; a thread takes the registry lock once,
+// on its first event. A full buffer overwrites its oldest events, and readers
+// see at most kEventsPerThread - 1 of them. Names must be
+// string literals or otherwise outlive the recorder.
+class TraceRecorder {
+public:
+  static constexpr size_t kEventsPerThread = 4096;
+
+  TraceRecorder();
+  ~TraceRecorder();
+  TraceRecorder(TraceRecorder const &) = delete;
+  TraceRecorder &operator=(TraceRecorder const &) = delete;
+
+  // Process-wide recorder the collectors write to. A plain static rather than a
+  // function-local one, so disabled hooks skip the initialization guard.
+  static TraceRecorder &Instance() noexcept {
+    return s_instance;
+  }
+
+  bool Enabled() const noexcept {
+#if DEVICEAI_TRACING
+    return m_enabled.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif
+  }
+
+  void SetEnabled(bool enabled) noexcept;
+
+  // startNs and durationNs are on the steady clock
+  void Complete(const char *name, int64_t startNs, int64_t durationNs, TraceStatus status) noexcept;
+
+  // Events from every thread, oldest first per thread
+  std::vector<TraceEvent> Events() const;
+  std::string ToChromeJson() const;
+  bool WriteChromeJson(std::string const &path) const;
+  void Clear() noexcept;
+
+private:
+  struct Slot {
+    std::atomic<const char *> name{nullptr};
+    std::atomic<int64_t> startNs{0};
+    std::atomic<int64_t> durationNs{0};
+    std::atomic<uint8_t> status{0};
+  };
+
+  // Single-producer ring; readers copy a window and drop slots overwritten meanwhile
+  struct ThreadBuffer {
+    uint32_t threadId = 0;
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> tail{0};
+    std::array<Slot, kEventsPerThread> slots;
+  };
+
+  ThreadBuffer *LocalBuffer();
+
+  static TraceRecorder s_instance;
+
+  uint64_t const m_id;
+  std::atomic<bool> m_enabled{false};
+  mutable std::mutex m_mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+};
+
+} // namespace ReactNativeDeviceAiCore
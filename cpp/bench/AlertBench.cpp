@@ -0,0 +1,59 @@
+#include "AlertEngine.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+// One sampler tick against range(0) rules spread over value, percentage and
+// rate signals, with CPU swinging across their thresholds
+void BM_AlertEvaluate(benchmark::State &state) {
+  std::vector<std::pair<std::string, std::string>> rules;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    auto level = std::to_string(50 + i % 50);
+    std::string text;
+    switch (i % 4) {
+      case 0:
+        text = "cpu.usage > " + level + " for 30s clear " + std::to_string(40 + i % 50);
+        break;
+      case 1:
+        text = "storage.available < " + std::to_string(1 + i % 20) + "%";
+        break;
+      case 2:
+        text = "battery.drainRate > " + std::to_string(5 + i % 30) + "%/h cooldown 10m";
+        break;
+      default:
+        text = "memory.available < " + std::to_string(256 + i % 1024) + "MB";
+        break;
+    }
+    rules.emplace_back("rule" + std::to_string(i), std::move(text));
+  }
+  AlertEngine engine;
+  engine.SetRules(rules);
+
+  std::array<double, kMetricCount> row{};
+  row[static_cast<size_t>(Metric::MemoryTotal)] = 16.0 * 1024 * 1024 * 1024;
+  row[static_cast<size_t>(Metric::MemoryAvailable)] = 4.0 * 1024 * 1024 * 1024;
+  row[static_cast<size_t>(Metric::StorageTotal)] = 512.0 * 1024 * 1024 * 1024;
+  row[static_cast<size_t>(Metric::StorageAvailable)] = 64.0 * 1024 * 1024 * 1024;
+  row[static_cast<size_t>(Metric::BatteryLevel)] = 80;
+
+  int64_t timeMs = 0;
+  size_t transitions = 0;
+  for (auto _ : state) {
+    row[static_cast<size_t>(Metric::CpuUsage)] = static_cast<double>(timeMs / 1000 % 100);
+    transitions += engine.Evaluate(timeMs, row).size();
+    timeMs += 1000;
+  }
+  state.counters["transitions_per_tick"] = static_cast<double>(transitions) / static_cast<double>(state.iterations());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AlertEvaluate)->Arg(100)->Arg(1000)->Arg(10000);
+
+} // namespace
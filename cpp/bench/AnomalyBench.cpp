@@ -0,0 +1,41 @@
+#include "AnomalyDetector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+// One sample for each of range(1) series per round, as the sampler feeds
+// per-process series, under each method
+void BM_AnomalyMonitor(benchmark::State &state) {
+  AnomalyConfig config;
+  config.method = static_cast<AnomalyMethod>(state.range(0));
+  auto series = static_cast<uint64_t>(state.range(1));
+  AnomalyMonitor monitor(config, series);
+
+  std::mt19937_64 random(42);
+  std::normal_distribution<double> noise(100.0, 10.0);
+  std::vector<double> values(4096);
+  for (auto &value : values) {
+    value = noise(random);
+  }
+
+  int64_t timeMs = 0;
+  size_t next = 0;
+  for (auto _ : state) {
+    for (uint64_t s = 0; s < series; ++s) {
+      benchmark::DoNotOptimize(monitor.Observe(s, timeMs, values[next++ % values.size()]));
+    }
+    timeMs += 1000;
+  }
+  state.counters["events"] = static_cast<double>(monitor.Events().size());
+  state.SetLabel(ToString(config.method));
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_AnomalyMonitor)->ArgsProduct({{0, 1, 2}, {16, 4096}});
+
+} // namespace
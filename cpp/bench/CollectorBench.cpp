@@ -0,0 +1,149 @@
+#include "CollectorDeadline.h"
+#include "FakePlatformProvider.h"
+#include "SnapshotAssembler.h"
+#include "Task.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+// Fixed worker pool standing in for the Windows thread pool
+class PoolExecutor final : public Executor {
+public:
+  explicit PoolExecutor(size_t threads) {
+    for (size_t i = 0; i < threads; ++i) {
+      m_threads.emplace_back([this] { Work(); });
+    }
+  }
+
+  ~PoolExecutor() override {
+    {
+      std::lock_guard lock(m_mutex);
+      m_stopping = true;
+    }
+    m_ready.notify_all();
+    for (auto &thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  void Post(std::coroutine_handle<> handle) noexcept override {
+    {
+      std::lock_guard lock(m_mutex);
+      m_queue.push_back(handle);
+    }
+    m_ready.notify_one();
+  }
+
+private:
+  void Work() {
+    for (;;) {
+      std::coroutine_handle<> handle;
+      {
+        std::unique_lock lock(m_mutex);
+        m_ready.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+        if (m_queue.empty()) {
+          return;
+        }
+        handle = m_queue.front();
+        m_queue.pop_front();
+      }
+      handle.resume();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_ready;
+  std::deque<std::coroutine_handle<>> m_queue;
+  bool m_stopping = false;
+  std::vector<std::thread> m_threads;
+};
+
+// One collector read through the assembler. Args: collector, provider latency in µs.
+void BM_Collect(benchmark::State &state) {
+  auto collector = static_cast<Collector>(state.range(0));
+  FakePlatformProvider provider;
+  provider.SetLatency(collector, std::chrono::microseconds(state.range(1)));
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  DeviceSnapshot snapshot;
+  int64_t nowMs = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(assembler.Collect(collector, snapshot, ++nowMs));
+  }
+  state.SetLabel(ToString(collector));
+}
+BENCHMARK(BM_Collect)->ArgNames({"collector", "latencyUs"})->ArgsProduct({benchmark::CreateDenseRange(0, kCollectorCount - 1, 1), {0, 100}});
+
+// A failing collector answering from its last-known values
+void BM_CollectLastKnown(benchmark::State &state) {
+  auto collector = static_cast<Collector>(state.range(0));
+  FakePlatformProvider provider;
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  DeviceSnapshot snapshot;
+  assembler.Collect(collector, snapshot, 0);
+  provider.SetFailing(collector, true);
+  int64_t nowMs = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(assembler.Collect(collector, snapshot, ++nowMs));
+  }
+  state.SetLabel(ToString(collector));
+}
+BENCHMARK(BM_CollectLastKnown)->ArgName("collector")->DenseRange(0, kCollectorCount - 1, 1);
+
+// Every collector started at once under its deadline, as getDeviceInfo and
+// getWindowsSystemInfo do. Each provider read takes the given latency in µs,
+// so the wall time should track one latency, not the sum of seven.
+void BM_DeadlineFanOut(benchmark::State &state) {
+  auto latency = std::chrono::microseconds(state.range(0));
+  FakePlatformProvider provider;
+  for (size_t i = 0; i < kCollectorCount; ++i) {
+    provider.SetLatency(static_cast<Collector>(i), latency);
+  }
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  CollectorStats stats;
+  PoolExecutor executor(kCollectorCount);
+  AsyncScope scope;
+
+  std::array<std::unique_ptr<DeadlineCollector<DeviceSnapshot>>, kCollectorCount> collectors;
+  for (size_t i = 0; i < kCollectorCount; ++i) {
+    collectors[i] = std::make_unique<DeadlineCollector<DeviceSnapshot>>(static_cast<Collector>(i), 1000, stats);
+  }
+
+  auto const &clock = SteadyClock::Instance();
+  for (auto _ : state) {
+    auto startMs = clock.NowMs();
+    std::array<uint64_t, kCollectorCount> tickets{};
+    for (size_t i = 0; i < kCollectorCount; ++i) {
+      auto id = static_cast<Collector>(i);
+      tickets[i] = collectors[i]->Start(executor, [&assembler, id, &clock]() -> std::optional<DeviceSnapshot> {
+        DeviceSnapshot snapshot;
+        if (!assembler.Collect(id, snapshot, clock.NowMs())) {
+          return std::nullopt;
+        }
+        return snapshot;
+      }, scope.Enter());
+    }
+    for (size_t i = 0; i < kCollectorCount; ++i) {
+      benchmark::DoNotOptimize(collectors[i]->Await(tickets[i], startMs, 2000));
+    }
+  }
+  scope.WaitIdle();
+}
+BENCHMARK(BM_DeadlineFanOut)->ArgName("latencyUs")->Arg(0)->Arg(1000)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,226 @@
+#include "MetricHistory.h"
+#include "MetricJournal.h"
+#include "MetricQuery.h"
+#include "ProviderTrace.h"
+#include "ReplayProvider.h"
+#include "SnapshotAssembler.h"
+#include "SpanRecorder.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+// The dashboard case: 10 metrics sampled at 1 Hz for 24 hours
+constexpr int64_t kDayRows = 24 * 60 * 60;
+
+DeviceSnapshot Sample(int64_t row) {
+  DeviceSnapshot snapshot;
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    auto value = 50.0 + 40.0 * std::sin(static_cast<double>(row) / (300.0 + 50.0 * static_cast<double>(i)));
+    snapshot.metrics[i] = {value, ValueState::Live, 0};
+  }
+  return snapshot;
+}
+
+MetricHistory const &FullDay() {
+  static auto *history = [] {
+    auto *filled = new MetricHistory(kDayRows);
+    for (int64_t row = 0; row < kDayRows; ++row) {
+      filled->Append(row * 1000, Sample(row));
+    }
+    return filled;
+  }();
+  return *history;
+}
+
+HistoryQuery DashboardQuery(size_t maxPoints, DownsampleMode mode) {
+  HistoryQuery query;
+  for (size_t i = 0; i < 10; ++i) {
+    query.metrics.push_back(static_cast<Metric>(i));
+  }
+  query.maxPoints = maxPoints;
+  query.mode = mode;
+  return query;
+}
+
+void BM_HistoryAppend(benchmark::State &state) {
+  MetricHistory history(kDayRows);
+  auto snapshot = Sample(0);
+  int64_t timeMs = 0;
+  for (auto _ : state) {
+    history.Append(timeMs += 1000, snapshot);
+  }
+}
+BENCHMARK(BM_HistoryAppend);
+
+// Raw export of the whole day, before any conversion to typed arrays
+void BM_HistoryQueryDay(benchmark::State &state) {
+  auto const &history = FullDay();
+  auto query = DashboardQuery(0, DownsampleMode::None);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(history.Query(query));
+  }
+  state.SetItemsProcessed(state.iterations() * kDayRows * 10);
+}
+BENCHMARK(BM_HistoryQueryDay)->Unit(benchmark::kMillisecond);
+
+void BM_HistoryQueryDayM4(benchmark::State &state) {
+  auto const &history = FullDay();
+  auto query = DashboardQuery(static_cast<size_t>(state.range(0)), DownsampleMode::M4);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(history.Query(query));
+  }
+  state.SetItemsProcessed(state.iterations() * kDayRows * 10);
+}
+BENCHMARK(BM_HistoryQueryDayM4)->Arg(1000)->Arg(4000)->Unit(benchmark::kMillisecond);
+
+void BM_HistoryQueryDayLttb(benchmark::State &state) {
+  auto const &history = FullDay();
+  auto query = DashboardQuery(static_cast<size_t>(state.range(0)), DownsampleMode::Lttb);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(history.Query(query));
+  }
+  state.SetItemsProcessed(state.iterations() * kDayRows * 10);
+}
+BENCHMARK(BM_HistoryQueryDayLttb)->Arg(1000)->Arg(4000)->Unit(benchmark::kMillisecond);
+
+// Aggregating a raw day into 10 s buckets, finer than any rollup tier, with
+// the summary kernels (avg) or exact percentiles (p95)
+void BM_HistoryAggregateDay(benchmark::State &state) {
+  auto const &history = FullDay();
+  MetricQuery query;
+  query.metrics = DashboardQuery(0, DownsampleMode::None).metrics;
+  query.stepMs = 10 * 1000;
+  query.aggregation = static_cast<Aggregation>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(RunQuery(history, query));
+  }
+  state.SetLabel(ToString(query.aggregation));
+  state.SetItemsProcessed(state.iterations() * kDayRows * 10);
+}
+BENCHMARK(BM_HistoryAggregateDay)
+    ->Arg(static_cast<int64_t>(Aggregation::Avg))
+    ->Arg(static_cast<int64_t>(Aggregation::P95))
+    ->Unit(benchmark::kMillisecond);
+
+// A week-long dashboard: answered from the per-minute rollups with two
+// quantiles per bucket, never touching raw rows
+void BM_HistoryRollupWeek(benchmark::State &state) {
+  static auto *history = [] {
+    auto *filled = new MetricHistory();
+    for (int64_t row = 0; row < 7 * kDayRows; ++row) {
+      filled->Append(row * 1000, Sample(row));
+    }
+    return filled;
+  }();
+
+  RollupQuery query;
+  query.metrics = DashboardQuery(0, DownsampleMode::None).metrics;
+  query.maxPoints = static_cast<size_t>(state.range(0));
+  query.quantiles = {0.5, 0.95};
+  size_t rows = 0;
+  for (auto _ : state) {
+    auto window = history->Rollup(query);
+    rows = window.timestampsMs.size();
+    benchmark::DoNotOptimize(window);
+  }
+  state.counters["rows"] = static_cast<double>(rows);
+}
+BENCHMARK(BM_HistoryRollupWeek)->Arg(100)->Arg(2000)->Unit(benchmark::kMillisecond);
+
+// Decoding every column of a sealed day, as a query over the full range does
+void BM_HistoryDecodeDay(benchmark::State &state) {
+  auto const &history = FullDay();
+  std::vector<int64_t> times(MetricHistory::kDefaultBlockRows);
+  std::vector<double> values(MetricHistory::kDefaultBlockRows);
+  size_t decoded = 0;
+  for (auto _ : state) {
+    for (size_t b = 0; b < history.Blocks(); ++b) {
+      auto block = history.Block(b);
+      block->DecodeTimes(times.data());
+      for (size_t i = 0; i < kMetricCount; ++i) {
+        block->DecodeValues(static_cast<Metric>(i), values.data());
+      }
+      benchmark::DoNotOptimize(values.data());
+      decoded += block->rows * kMetricCount;
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(decoded));
+  state.counters["bytes_per_value"] = history.Stats().BytesPerValue();
+}
+BENCHMARK(BM_HistoryDecodeDay)->Unit(benchmark::kMillisecond);
+
+// Startup after a restart: opening a day of journal, checking every record's
+// CRC over read-only mappings, and replaying it into a fresh history
+void BM_JournalRestoreDay(benchmark::State &state) {
+  auto directory = std::filesystem::temp_directory_path() / "deviceai-bench-journal";
+  std::filesystem::remove_all(directory);
+  {
+    JournalConfig config;
+    config.sync = JournalSync::Never;
+    auto journal = MetricJournal::Open(directory, config);
+    for (int64_t row = 0; row < kDayRows; ++row) {
+      journal->Append(row * 1000, LiveValues(Sample(row)));
+    }
+  }
+
+  JournalStats stats;
+  for (auto _ : state) {
+    auto journal = MetricJournal::Open(directory);
+    MetricHistory history(kDayRows);
+    benchmark::DoNotOptimize(journal->Restore(history));
+    stats = journal->Stats();
+  }
+  state.SetItemsProcessed(state.iterations() * kDayRows);
+  state.counters["disk_mib"] = static_cast<double>(stats.bytes) / (1024.0 * 1024.0);
+  std::filesystem::remove_all(directory);
+}
+BENCHMARK(BM_JournalRestoreDay)->Unit(benchmark::kMillisecond);
+
+// Compression of real readings: the trace in DEVICEAI_BENCH_TRACE (recorded
+// with DeviceAiCli --record) replayed in a loop into a day of 1 Hz rows.
+// Skipped without a trace; the synthetic sines above carry full-precision
+// noise in every sample and so compress worse than any real counter.
+void BM_HistoryCompressTrace(benchmark::State &state) {
+  auto const *path = std::getenv("DEVICEAI_BENCH_TRACE");
+  auto trace = path ? ProviderTrace::Load(path) : std::nullopt;
+  if (!trace) {
+    state.SkipWithError("set DEVICEAI_BENCH_TRACE to a recorded provider trace");
+    return;
+  }
+
+  // One pass of the trace, repeated for the rest of the day
+  auto passRows = std::clamp<size_t>(trace->memory.size(), 1, kDayRows);
+  ReplayOptions options;
+  options.loop = true;
+  ReplayProvider provider(std::move(*trace), options);
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  std::vector<DeviceSnapshot> snapshots;
+  for (size_t row = 0; row < passRows; ++row) {
+    snapshots.push_back(assembler.Assemble(static_cast<int64_t>(row) * 1000));
+  }
+
+  HistoryStats stats;
+  for (auto _ : state) {
+    MetricHistory history(kDayRows);
+    for (int64_t row = 0; row < kDayRows; ++row) {
+      history.Append(row * 1000, snapshots[static_cast<size_t>(row) % passRows]);
+    }
+    stats = history.Stats();
+  }
+  state.SetItemsProcessed(state.iterations() * kDayRows);
+  state.counters["bytes_per_value"] = stats.BytesPerValue();
+  state.counters["sealed_mib"] = static_cast<double>(stats.sealedBytes) / (1024.0 * 1024.0);
+}
+BENCHMARK(BM_HistoryCompressTrace)->Unit(benchmark::kMillisecond)->Iterations(3);
+
+} // namespace
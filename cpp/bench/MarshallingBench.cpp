@@ -0,0 +1,37 @@
+#include "DeviceSnapshot.h"
+#include "FakePlatformProvider.h"
+#include "SnapshotAssembler.h"
+
+#include <SnapshotMarshalling.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace ReactNativeDeviceAiCore;
+using namespace winrt::ReactNativeDeviceAiSpecs;
+
+namespace {
+
+DeviceSnapshot FullSnapshot() {
+  FakePlatformProvider provider;
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  return assembler.Assemble(0);
+}
+
+void BM_MarshalDeviceInfo(benchmark::State &state) {
+  auto snapshot = FullSnapshot();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ToDeviceInfo(snapshot));
+  }
+}
+BENCHMARK(BM_MarshalDeviceInfo);
+
+void BM_MarshalWindowsSystemInfo(benchmark::State &state) {
+  auto snapshot = FullSnapshot();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ToWindowsSystemInfo(snapshot));
+  }
+}
+BENCHMARK(BM_MarshalWindowsSystemInfo);
+
+} // namespace
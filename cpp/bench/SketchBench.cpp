@@ -0,0 +1,121 @@
+#include "QuantileSketch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+constexpr double kQuantiles[] = {0.5, 0.95, 0.99};
+
+// 0: collector latency in ms, log-normal with a long tail
+// 1: utilization in percent, a busy/idle mix clamped to [0, 100]
+std::vector<double> Values(int64_t distribution, size_t count) {
+  std::mt19937_64 random(42);
+  std::lognormal_distribution<double> latency(1.0, 1.2);
+  std::normal_distribution<double> idle(8.0, 4.0);
+  std::normal_distribution<double> busy(85.0, 10.0);
+  std::bernoulli_distribution isBusy(0.2);
+  std::vector<double> values(count);
+  for (auto &value : values) {
+    value = distribution == 0 ? latency(random) : std::clamp(isBusy(random) ? busy(random) : idle(random), 0.0, 100.0);
+  }
+  return values;
+}
+
+double Exact(std::vector<double> values, double q) {
+  auto rank = static_cast<size_t>(q * static_cast<double>(values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + static_cast<ptrdiff_t>(rank), values.end());
+  return values[rank];
+}
+
+char const *Label(int64_t distribution) {
+  return distribution == 0 ? "latency" : "utilization";
+}
+
+// Adding a window of samples and reading three quantiles, with each
+// quantile's relative error against the exact value as counters
+void BM_SketchQuantiles(benchmark::State &state) {
+  auto values = Values(state.range(0), static_cast<size_t>(state.range(1)));
+  QuantileSketch sketch;
+  for (auto _ : state) {
+    sketch = {};
+    for (auto value : values) {
+      sketch.Add(value);
+    }
+    for (auto q : kQuantiles) {
+      benchmark::DoNotOptimize(sketch.Quantile(q));
+    }
+  }
+  for (auto q : kQuantiles) {
+    auto exact = Exact(values, q);
+    state.counters["err_p" + std::to_string(static_cast<int>(q * 100))] = std::abs(sketch.Quantile(q) - exact) / exact;
+  }
+  state.counters["buckets"] = static_cast<double>(sketch.Buckets());
+  state.SetLabel(Label(state.range(0)));
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_SketchQuantiles)->ArgsProduct({{0, 1}, {1 << 16}});
+
+// The same with every sample kept and selected exactly
+void BM_ExactQuantiles(benchmark::State &state) {
+  auto values = Values(state.range(0), static_cast<size_t>(state.range(1)));
+  std::vector<double> window;
+  for (auto _ : state) {
+    window.clear();
+    window.insert(window.end(), values.begin(), values.end());
+    for (auto q : kQuantiles) {
+      auto rank = static_cast<size_t>(q * static_cast<double>(window.size() - 1));
+      std::nth_element(window.begin(), window.begin() + static_cast<ptrdiff_t>(rank), window.end());
+      benchmark::DoNotOptimize(window[rank]);
+    }
+  }
+  state.counters["bytes"] = static_cast<double>(values.size() * sizeof(double));
+  state.SetLabel(Label(state.range(0)));
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_ExactQuantiles)->ArgsProduct({{0, 1}, {1 << 16}});
+
+// A day of per-minute sketches merged into one
+void BM_SketchMergeDay(benchmark::State &state) {
+  constexpr size_t kMinutes = 24 * 60;
+  auto values = Values(state.range(0), kMinutes * 60);
+  std::vector<QuantileSketch> minutes(kMinutes);
+  for (size_t i = 0; i < values.size(); ++i) {
+    minutes[i / 60].Add(values[i]);
+  }
+  for (auto _ : state) {
+    QuantileSketch day;
+    for (auto const &minute : minutes) {
+      day.Merge(minute);
+    }
+    benchmark::DoNotOptimize(day.Quantile(0.99));
+  }
+  state.SetLabel(Label(state.range(0)));
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kMinutes));
+}
+BENCHMARK(BM_SketchMergeDay)->Arg(0)->Arg(1);
+
+void BM_SketchEncodeDecode(benchmark::State &state) {
+  QuantileSketch sketch;
+  for (auto value : Values(state.range(0), 1 << 16)) {
+    sketch.Add(value);
+  }
+  std::vector<uint8_t> bytes;
+  for (auto _ : state) {
+    bytes.clear();
+    sketch.Encode(bytes);
+    benchmark::DoNotOptimize(QuantileSketch::Decode(bytes));
+  }
+  state.counters["bytes"] = static_cast<double>(bytes.size());
+  state.SetLabel(Label(state.range(0)));
+}
+BENCHMARK(BM_SketchEncodeDecode)->Arg(0)->Arg(1);
+
+} // namespace
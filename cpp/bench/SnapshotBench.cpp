@@ -0,0 +1,105 @@
+#include "FakePlatformProvider.h"
+#include "ProviderTrace.h"
+#include "RecordingProvider.h"
+#include "ReplayProvider.h"
+#include "SnapshotAssembler.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <sstream>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+// Every collector and the identity strings with no provider latency, i.e. the
+// assembler's own cost per snapshot
+void BM_AssembleSnapshot(benchmark::State &state) {
+  FakePlatformProvider provider;
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  int64_t nowMs = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(assembler.Assemble(++nowMs));
+  }
+}
+BENCHMARK(BM_AssembleSnapshot);
+
+// Same, but every collector fails and answers from last-known values
+void BM_AssembleSnapshotFromLastKnown(benchmark::State &state) {
+  FakePlatformProvider provider;
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  assembler.Assemble(0);
+  for (size_t i = 0; i < kCollectorCount; ++i) {
+    provider.SetFailing(static_cast<Collector>(i), true);
+  }
+  int64_t nowMs = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(assembler.Assemble(++nowMs));
+  }
+}
+BENCHMARK(BM_AssembleSnapshotFromLastKnown);
+
+// Assembly with every raw read also appended to a trace
+void BM_AssembleSnapshotRecording(benchmark::State &state) {
+  FakePlatformProvider fake;
+  std::ostringstream out;
+  ProviderTraceWriter writer(out, fake.Name());
+  RecordingProvider provider(fake, writer);
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  int64_t nowMs = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(assembler.Assemble(++nowMs));
+    if (out.tellp() > (64 << 20)) {
+      out.str({});
+    }
+  }
+  state.counters["bytes/snapshot"] = static_cast<double>(writer.BytesWritten()) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_AssembleSnapshotRecording);
+
+// Assembly fed from a looping, unpaced replay of a recorded trace
+void BM_AssembleSnapshotReplayed(benchmark::State &state) {
+  std::ostringstream out;
+  {
+    FakePlatformProvider fake;
+    ProviderTraceWriter writer(out, fake.Name());
+    RecordingProvider recording(fake, writer);
+    SpanRecorder spans;
+    SnapshotAssembler assembler(recording, spans);
+    for (int64_t i = 0; i < 1000; ++i) {
+      assembler.Assemble(i);
+    }
+  }
+  auto bytes = out.str();
+  auto trace = ProviderTrace::Decode({reinterpret_cast<uint8_t const *>(bytes.data()), bytes.size()});
+
+  ReplayOptions options;
+  options.loop = true;
+  ReplayProvider provider(std::move(*trace), options);
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  int64_t nowMs = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(assembler.Assemble(++nowMs));
+  }
+}
+BENCHMARK(BM_AssembleSnapshotReplayed);
+
+// Publishing a snapshot to readers is a flat copy
+void BM_CopySnapshot(benchmark::State &state) {
+  DeviceSnapshot source;
+  DeviceSnapshot target;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&source);
+    std::memcpy(&target, &source, sizeof(DeviceSnapshot));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * sizeof(DeviceSnapshot)));
+}
+BENCHMARK(BM_CopySnapshot);
+
+} // namespace
@@ -0,0 +1,39 @@
+#include "StringConversion.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+// Typical registry and WMI values: a processor name and a localized OS caption
+void BM_Utf16ToUtf8Ascii(benchmark::State &state) {
+  std::u16string text = u"Intel(R) Core(TM) i7-1185G7 @ 3.00GHz";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Utf16ToUtf8(text));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size() * sizeof(char16_t)));
+}
+BENCHMARK(BM_Utf16ToUtf8Ascii);
+
+void BM_Utf16ToUtf8NonAscii(benchmark::State &state) {
+  std::u16string text = u"Microsoft Windows 11 Professionnel — édition française";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Utf16ToUtf8(text));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size() * sizeof(char16_t)));
+}
+BENCHMARK(BM_Utf16ToUtf8NonAscii);
+
+void BM_WideToUtf8(benchmark::State &state) {
+  std::wstring text = L"Intel(R) Core(TM) i7-1185G7 @ 3.00GHz";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(WideToUtf8(text));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size() * sizeof(wchar_t)));
+}
+BENCHMARK(BM_WideToUtf8);
+
+} // namespace
@@ -0,0 +1,82 @@
+#!/usr/bin/env node
+/**
+ * Compares a Google Benchmark JSON result with a stored baseline and exits
+ * non-zero when any benchmark got slower than the allowed ratio.
+ *
+ *   node cpp/bench/compare-baseline.js <baseline.json> <current.json> [--threshold 0.10]
+ *
+ * Aggregate runs (--benchmark_repetitions) are compared on their median;
+ * benchmarks missing from either side are listed but do not fail the check.
+ */
+const fs = require('fs');
+
+function usage() {
+  console.error('usage: compare-baseline.js <baseline.json> <current.json> [--threshold 0.10]');
+  process.exit(2);
+}
+
+function parseArgs(argv) {
+  const files = [];
+  let threshold = 0.1;
+  for (let i = 0; i < argv.length; i++) {
+    if (argv[i] === '--threshold') {
+      threshold = Number(argv[++i]);
+      if (!Number.isFinite(threshold) || threshold < 0) {
+        usage();
+      }
+    } else {
+      files.push(argv[i]);
+    }
+  }
+  if (files.length !== 2) {
+    usage();
+  }
+  return { baselinePath: files[0], currentPath: files[1], threshold };
+}
+
+// Real time per iteration in ns, keyed by benchmark name; medians win over single runs
+function loadTimes(path) {
+  const toNs = { ns: 1, us: 1e3, ms: 1e6, s: 1e9 };
+  const { benchmarks = [] } = JSON.parse(fs.readFileSync(path, 'utf8'));
+  const times = new Map();
+  for (const run of benchmarks) {
+    const isMedian = run.run_type === 'aggregate' && run.aggregate_name === 'median';
+    if (run.run_type === 'aggregate' && !isMedian) {
+      continue;
+    }
+    const name = run.run_name || run.name;
+    if (isMedian || !times.has(name)) {
+      times.set(name, run.real_time * (toNs[run.time_unit] || 1));
+    }
+  }
+  return times;
+}
+
+const { baselinePath, currentPath, threshold } = parseArgs(process.argv.slice(2));
+const baseline = loadTimes(baselinePath);
+const current = loadTimes(currentPath);
+
+const regressions = [];
+for (const [name, currentNs] of current) {
+  const baselineNs = baseline.get(name);
+  if (baselineNs === undefined) {
+    console.log(`new       ${name}: ${currentNs.toFixed(1)} ns`);
+    continue;
+  }
+  const change = currentNs / baselineNs - 1;
+  const verdict = change > threshold ? 'SLOWER' : change < -threshold ? 'faster' : 'same';
+  console.log(`${verdict.padEnd(9)} ${name}: ${baselineNs.toFixed(1)} -> ${currentNs.toFixed(1)} ns (${(change * 100).toFixed(1)}%)`);
+  if (change > threshold) {
+    regressions.push(name);
+  }
+}
+for (const name of baseline.keys()) {
+  if (!current.has(name)) {
+    console.log(`missing   ${name}`);
+  }
+}
+
+if (regressions.length > 0) {
+  console.error(`\n${regressions.length} benchmark(s) regressed by more than ${(threshold * 100).toFixed(0)}%`);
+  process.exit(1);
+}
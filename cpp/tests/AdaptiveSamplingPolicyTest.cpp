@@ -0,0 +1,121 @@
+#include "AdaptiveSamplingPolicy.h"
+
+#include <gtest/gtest.h>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+SamplingPolicyConfig TestConfig() {
+  SamplingPolicyConfig config;
+  config.baseIntervalMs = 1000;
+  config.minIntervalMs = 100;
+  config.maxIntervalMs = 600000;
+  config.warmupSamples = 0;
+  return config;
+}
+
+// Feeds samples at the interval the policy asks for, as the platform timer would.
+SamplingDecision Drive(VirtualClock &clock, AdaptiveSamplingPolicy &policy, int count, double (*next)(int)) {
+  auto decision = policy.Current();
+  for (int i = 0; i < count; ++i) {
+    clock.Advance(decision.intervalMs);
+    decision = policy.OnSample(next(i));
+  }
+  return decision;
+}
+
+} // namespace
+
+TEST(AdaptiveSamplingPolicyTest, BaselineFollowsPowerAndAppState) {
+  VirtualClock clock;
+  AdaptiveSamplingPolicy policy(clock, TestConfig());
+
+  EXPECT_EQ(policy.Current().policy, SamplingPolicyKind::Performance);
+  EXPECT_EQ(policy.Current().intervalMs, 1000);
+
+  EXPECT_TRUE(policy.SetInputs({PowerSource::Battery, false, true}));
+  EXPECT_EQ(policy.Current().policy, SamplingPolicyKind::Balanced);
+  EXPECT_EQ(policy.Current().intervalMs, 2000);
+
+  EXPECT_TRUE(policy.SetInputs({PowerSource::Battery, true, true}));
+  EXPECT_EQ(policy.Current().policy, SamplingPolicyKind::EnergySaver);
+  EXPECT_EQ(policy.Current().intervalMs, 8000);
+
+  EXPECT_TRUE(policy.SetInputs({PowerSource::Ac, false, false}));
+  EXPECT_EQ(policy.Current().policy, SamplingPolicyKind::Background);
+  EXPECT_EQ(policy.Current().intervalMs, 10000);
+
+  EXPECT_FALSE(policy.SetInputs({PowerSource::Ac, false, false}));
+}
+
+TEST(AdaptiveSamplingPolicyTest, KindChangeAtSameBaselineRearmsTimer) {
+  VirtualClock clock;
+  auto config = TestConfig();
+  config.energySaverFactor = 1.0;
+  AdaptiveSamplingPolicy policy(clock, config);
+
+  EXPECT_EQ(policy.Current().tolerableDelayMs, 100);
+
+  EXPECT_TRUE(policy.SetInputs({PowerSource::Ac, true, true}));
+  EXPECT_EQ(policy.Current().policy, SamplingPolicyKind::EnergySaver);
+  EXPECT_EQ(policy.Current().intervalMs, 1000);
+  EXPECT_EQ(policy.Current().tolerableDelayMs, 500);
+}
+
+TEST(AdaptiveSamplingPolicyTest, StableMetricBacksOffToCeiling) {
+  VirtualClock clock;
+  AdaptiveSamplingPolicy policy(clock, TestConfig());
+
+  auto decision = Drive(clock, policy, 50, [](int) { return 12.0; });
+
+  EXPECT_EQ(decision.intervalMs, 8000);
+}
+
+TEST(AdaptiveSamplingPolicyTest, VolatileMetricSpeedsUpToFloor) {
+  VirtualClock clock;
+  AdaptiveSamplingPolicy policy(clock, TestConfig());
+
+  auto decision = Drive(clock, policy, 20, [](int i) { return i % 2 == 0 ? 5.0 : 95.0; });
+
+  EXPECT_EQ(decision.intervalMs, 250);
+}
+
+TEST(AdaptiveSamplingPolicyTest, TolerableDelayWidensWhenSavingPower) {
+  VirtualClock clock;
+  AdaptiveSamplingPolicy policy(clock, TestConfig());
+
+  EXPECT_EQ(policy.Current().tolerableDelayMs, 100);
+
+  policy.SetInputs({PowerSource::Battery, false, true});
+  EXPECT_EQ(policy.Current().tolerableDelayMs, 1000);
+}
+
+TEST(AdaptiveSamplingPolicyTest, ContextChangeResetsAdaptedInterval) {
+  VirtualClock clock;
+  AdaptiveSamplingPolicy policy(clock, TestConfig());
+
+  Drive(clock, policy, 50, [](int) { return 3.0; });
+  ASSERT_GT(policy.Current().intervalMs, 1000);
+
+  policy.SetInputs({PowerSource::Battery, false, true});
+  EXPECT_EQ(policy.Current().intervalMs, 2000);
+}
+
+TEST(AdaptiveSamplingPolicyTest, ReportsWakeupsInTrailingMinute) {
+  VirtualClock clock;
+  AdaptiveSamplingPolicy policy(clock, TestConfig());
+
+  for (int i = 0; i < 30; ++i) {
+    clock.Advance(1000);
+    policy.OnSample(50.0 + (i % 2) * 40.0);
+  }
+  EXPECT_DOUBLE_EQ(policy.Diagnostics().wakeupsPerMinute, 30.0);
+  EXPECT_EQ(policy.Diagnostics().totalWakeups, 30u);
+
+  clock.Advance(45 * 1000);
+  EXPECT_DOUBLE_EQ(policy.Diagnostics().wakeupsPerMinute, 15.0);
+
+  clock.Advance(60 * 1000);
+  EXPECT_DOUBLE_EQ(policy.Diagnostics().wakeupsPerMinute, 0.0);
+}
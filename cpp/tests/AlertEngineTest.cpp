@@ -0,0 +1,154 @@
+#include "AlertEngine.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <limits>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+constexpr int64_t kMinute = 60 * 1000;
+constexpr double kGiB = 1024.0 * 1024.0 * 1024.0;
+
+std::array<double, kMetricCount> Row(double cpu, double storageAvailable = 100 * kGiB, double battery = 80) {
+  std::array<double, kMetricCount> row;
+  row.fill(std::numeric_limits<double>::quiet_NaN());
+  row[static_cast<size_t>(Metric::CpuUsage)] = cpu;
+  row[static_cast<size_t>(Metric::StorageTotal)] = 500 * kGiB;
+  row[static_cast<size_t>(Metric::StorageAvailable)] = storageAvailable;
+  row[static_cast<size_t>(Metric::BatteryLevel)] = battery;
+  return row;
+}
+
+std::string Error(std::string_view text) {
+  std::string error;
+  EXPECT_FALSE(ParseAlertRule(text, &error).has_value()) << text;
+  return error;
+}
+
+} // namespace
+
+TEST(AlertEngineTest, ParsesRules) {
+  auto cpu = ParseAlertRule("cpu.usage > 90 for 30s clear 80 cooldown 5m");
+  ASSERT_TRUE(cpu.has_value());
+  EXPECT_EQ(cpu->metric, Metric::CpuUsage);
+  EXPECT_EQ(cpu->comparison, AlertComparison::Above);
+  EXPECT_EQ(cpu->threshold, 90);
+  EXPECT_EQ(cpu->clearThreshold, 80);
+  EXPECT_EQ(cpu->forMs, 30000);
+  EXPECT_EQ(cpu->cooldownMs, 5 * kMinute);
+
+  auto storage = ParseAlertRule("storage.available<5%");
+  ASSERT_TRUE(storage.has_value());
+  EXPECT_TRUE(storage->percentOfTotal);
+  EXPECT_EQ(storage->comparison, AlertComparison::Below);
+
+  auto memory = ParseAlertRule("memory.available <= 512MB clear 1GB");
+  ASSERT_TRUE(memory.has_value());
+  EXPECT_EQ(memory->threshold, 512.0 * 1024 * 1024);
+  EXPECT_EQ(memory->clearThreshold, kGiB);
+
+  auto drain = ParseAlertRule("battery.drainRate > 20%/h");
+  ASSERT_TRUE(drain.has_value());
+  EXPECT_EQ(drain->signal, AlertSignal::Rate);
+  EXPECT_TRUE(drain->negate);
+  EXPECT_DOUBLE_EQ(drain->threshold, 20.0 / 3600);
+
+  EXPECT_EQ(Error("cpu.temperature > 90"), "unknown metric 'cpu.temperature'");
+  EXPECT_EQ(Error("cpu.usage = 90"), "expected one of > >= < <= after the metric");
+  EXPECT_EQ(Error("cpu.usage > 90 for 30"), "expected a duration like 30s after 'for'");
+  EXPECT_EQ(Error("cpu.usage > 90 clear 95"), "the clear threshold must be on the other side of the threshold");
+  EXPECT_EQ(Error("cpu.usage > 90/h"), "'/h' needs a rate, e.g. cpu.usage.rate");
+  EXPECT_EQ(Error("cpu.cores > 50%"), "'%' needs a percentage or an availability metric, not cpu.cores");
+  EXPECT_EQ(Error("cpu.usage > 90 until 5s"), "unexpected 'until'");
+}
+
+TEST(AlertEngineTest, DebouncesAndResolvesWithHysteresis) {
+  AlertEngine engine;
+  ASSERT_FALSE(engine.SetRules({{"hot", "cpu.usage > 90 for 30s clear 80"}}).has_value());
+
+  // A short burst doesn't fire
+  EXPECT_TRUE(engine.Evaluate(0, Row(95)).empty());
+  EXPECT_TRUE(engine.Evaluate(10000, Row(95)).empty());
+  EXPECT_TRUE(engine.Evaluate(20000, Row(50)).empty());
+
+  EXPECT_TRUE(engine.Evaluate(30000, Row(95)).empty());
+  EXPECT_TRUE(engine.Evaluate(50000, Row(92)).empty());
+  auto fired = engine.Evaluate(60000, Row(97));
+  ASSERT_EQ(fired.size(), 1u);
+  EXPECT_EQ(fired[0].id, "hot");
+  EXPECT_EQ(fired[0].state, AlertState::Firing);
+  EXPECT_EQ(fired[0].sinceMs, 30000);
+  EXPECT_EQ(fired[0].value, 97);
+  EXPECT_EQ(engine.Firing().size(), 1u);
+
+  // Between the thresholds it keeps firing, without repeating
+  EXPECT_TRUE(engine.Evaluate(70000, Row(85)).empty());
+  EXPECT_TRUE(engine.Evaluate(80000, Row(95)).empty());
+  auto resolved = engine.Evaluate(90000, Row(80));
+  ASSERT_EQ(resolved.size(), 1u);
+  EXPECT_EQ(resolved[0].state, AlertState::Ok);
+  EXPECT_TRUE(engine.Firing().empty());
+
+  // Unknown samples change nothing
+  EXPECT_TRUE(engine.Evaluate(100000, Row(std::numeric_limits<double>::quiet_NaN())).empty());
+}
+
+TEST(AlertEngineTest, CooldownDelaysRefiring) {
+  AlertEngine engine;
+  ASSERT_FALSE(engine.SetRules({{"full", "storage.available < 5% cooldown 10m"}}).has_value());
+
+  auto low = 20 * kGiB;
+  auto ok = 100 * kGiB;
+  EXPECT_EQ(engine.Evaluate(0, Row(0, low)).size(), 1u);
+  EXPECT_EQ(engine.Evaluate(kMinute, Row(0, ok)).size(), 1u);
+  // Breached again within the cooldown: held back until it ends
+  EXPECT_TRUE(engine.Evaluate(2 * kMinute, Row(0, low)).empty());
+  auto again = engine.Evaluate(10 * kMinute, Row(0, low));
+  ASSERT_EQ(again.size(), 1u);
+  EXPECT_EQ(again[0].sinceMs, 2 * kMinute);
+  EXPECT_DOUBLE_EQ(again[0].value, 4.0);
+  EXPECT_DOUBLE_EQ(again[0].threshold, 5.0);
+}
+
+TEST(AlertEngineTest, RatesAreMeasuredOverMinutes) {
+  AlertEngine engine;
+  ASSERT_FALSE(engine.SetRules({{"drain", "battery.drainRate > 20%/h clear 10"}}).has_value());
+
+  // 1% every 2 minutes is 30%/h, sampled every 10 s
+  std::vector<AlertEvent> events;
+  for (int64_t t = 0; t <= 20 * kMinute; t += 10000) {
+    auto fired = engine.Evaluate(t, Row(0, 100 * kGiB, 100.0 - static_cast<double>(t / (2 * kMinute))));
+    events.insert(events.end(), fired.begin(), fired.end());
+  }
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_NEAR(events[0].value, 30.0, 10.0);
+  EXPECT_DOUBLE_EQ(events[0].threshold, 20.0);
+
+  // Charging resolves it
+  for (int64_t t = 20 * kMinute; t <= 30 * kMinute; t += 10000) {
+    auto resolved = engine.Evaluate(t, Row(0, 100 * kGiB, 90.0 + static_cast<double>(t / kMinute - 20)));
+    events.insert(events.end(), resolved.begin(), resolved.end());
+  }
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[1].state, AlertState::Ok);
+}
+
+TEST(AlertEngineTest, ReplacingRulesKeepsUnchangedState) {
+  AlertEngine engine;
+  ASSERT_FALSE(engine.SetRules({{"hot", "cpu.usage > 90"}, {"busy", "cpu.usage > 50"}}).has_value());
+  EXPECT_EQ(engine.Evaluate(0, Row(95)).size(), 2u);
+
+  // 'hot' is unchanged and stays firing; 'busy' changed and starts over
+  ASSERT_FALSE(engine.SetRules({{"hot", "cpu.usage > 90"}, {"busy", "cpu.usage > 60"}}).has_value());
+  auto events = engine.Evaluate(1000, Row(95));
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].id, "busy");
+
+  auto error = engine.SetRules({{"a", "cpu.usage > 1"}, {"b", "cpu.usage >"}});
+  EXPECT_EQ(error, "rule 'b': expected a number");
+  EXPECT_EQ(engine.SetRules({{"a", "cpu.usage > 1"}, {"a", "cpu.usage > 2"}}), "duplicate rule id 'a'");
+  EXPECT_EQ(engine.Rules(), 2u);
+}
@@ -0,0 +1,178 @@
+#include "AnomalyDetector.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+constexpr int64_t kHour = 60 * 60 * 1000;
+constexpr int64_t kDay = 24 * kHour;
+
+AnomalyConfig Config(AnomalyMethod method) {
+  AnomalyConfig config;
+  config.method = method;
+  return config;
+}
+
+} // namespace
+
+TEST(AnomalyDetectorTest, ParsesMethodNames) {
+  EXPECT_EQ(ParseAnomalyMethod("robust"), AnomalyMethod::Robust);
+  EXPECT_FALSE(ParseAnomalyMethod("zscore").has_value());
+  EXPECT_STREQ(ToString(AnomalyMethod::Seasonal), "seasonal");
+  EXPECT_STREQ(ToString(AnomalySeverity::Critical), "critical");
+}
+
+TEST(AnomalyDetectorTest, SpikeStartsEscalatesAndEnds) {
+  auto config = Config(AnomalyMethod::Ewma);
+  AnomalyDetector detector;
+  std::mt19937_64 random(7);
+  std::normal_distribution<double> noise(50.0, 2.0);
+
+  for (int i = 0; i < 200; ++i) {
+    EXPECT_FALSE(detector.Add(config, i * 1000, noise(random)).has_value()) << i;
+  }
+
+  // About 5 and then 15 deviations out, then back to normal
+  auto start = detector.Add(config, 200000, 60.0);
+  ASSERT_TRUE(start.has_value());
+  EXPECT_EQ(start->phase, AnomalyPhase::Start);
+  EXPECT_EQ(start->severity, AnomalySeverity::Warning);
+  EXPECT_NEAR(start->expected, 50.0, 1.0);
+  EXPECT_GT(start->score, config.warningScore);
+  ASSERT_TRUE(detector.Open().has_value());
+
+  auto escalate = detector.Add(config, 201000, 80.0);
+  ASSERT_TRUE(escalate.has_value());
+  EXPECT_EQ(escalate->phase, AnomalyPhase::Escalate);
+  EXPECT_EQ(escalate->severity, AnomalySeverity::Critical);
+
+  auto end = detector.Add(config, 202000, 50.0);
+  ASSERT_TRUE(end.has_value());
+  EXPECT_EQ(end->phase, AnomalyPhase::End);
+  EXPECT_EQ(end->startMs, 200000);
+  EXPECT_EQ(end->timeMs, 202000);
+  EXPECT_EQ(end->severity, AnomalySeverity::Critical);
+  EXPECT_GT(end->peakScore, config.criticalScore);
+  EXPECT_FALSE(detector.Open().has_value());
+
+  // The spike didn't widen the spread enough to hide the next one
+  EXPECT_TRUE(detector.Add(config, 203000, 62.0).has_value());
+}
+
+TEST(AnomalyDetectorTest, SkipsMissingSamplesAndWarmsUp) {
+  auto config = Config(AnomalyMethod::Ewma);
+  AnomalyDetector detector;
+
+  for (uint32_t i = 0; i + 1 < config.warmupSamples; ++i) {
+    detector.Add(config, i, 10.0);
+  }
+  EXPECT_FALSE(detector.Add(config, 100, std::numeric_limits<double>::quiet_NaN()).has_value());
+  // Still warming up, however far out
+  EXPECT_FALSE(detector.Add(config, 101, 1000.0).has_value());
+  EXPECT_EQ(detector.Samples(), config.warmupSamples);
+}
+
+TEST(AnomalyDetectorTest, RobustBaselineIgnoresOutlierBursts) {
+  auto config = Config(AnomalyMethod::Robust);
+  AnomalyDetector detector;
+  std::mt19937_64 random(11);
+  std::normal_distribution<double> noise(100.0, 5.0);
+
+  int64_t time = 0;
+  for (int i = 0; i < 300; ++i) {
+    detector.Add(config, time++, noise(random));
+  }
+  // One sample in ten is wild
+  int flagged = 0;
+  for (int i = 0; i < 300; ++i) {
+    auto event = detector.Add(config, time++, i % 10 == 0 ? 1000.0 : noise(random));
+    flagged += event && event->phase == AnomalyPhase::Start;
+  }
+  EXPECT_EQ(flagged, 30);
+
+  detector.Add(config, time++, 100.0);
+  auto event = detector.Add(config, time++, 1000.0);
+  ASSERT_TRUE(event.has_value());
+  EXPECT_NEAR(event->expected, 100.0, 3.0);
+}
+
+TEST(AnomalyDetectorTest, SeasonalBaselineExpectsTheDailyPattern) {
+  auto config = Config(AnomalyMethod::Seasonal);
+  AnomalyDetector detector;
+  std::mt19937_64 random(3);
+  std::uniform_real_distribution<double> noise(-1.0, 1.0);
+
+  // Idle at 10 except a nightly job at 90 from 02:00 to 04:00, one sample a
+  // minute, with bounded noise
+  auto load = [](int64_t timeMs) {
+    auto hour = timeMs % kDay / kHour;
+    return hour >= 2 && hour < 4 ? 90.0 : 10.0;
+  };
+  constexpr int64_t kStep = 60 * 1000;
+
+  int64_t time = 0;
+  for (; time < 3 * kDay; time += kStep) {
+    detector.Add(config, time, load(time) + noise(random));
+  }
+  int flagged = 0;
+  for (; time < 5 * kDay; time += kStep) {
+    flagged += detector.Add(config, time, load(time) + noise(random)).has_value();
+  }
+  EXPECT_EQ(flagged, 0);
+
+  // The job's load at noon is not expected
+  time += 10 * kHour;
+  auto event = detector.Add(config, time, 90.0);
+  ASSERT_TRUE(event.has_value());
+  EXPECT_EQ(event->severity, AnomalySeverity::Critical);
+  EXPECT_NEAR(event->expected, 10.0, 1.0);
+
+  // A plain Ewma flags the job every night
+  AnomalyDetector ewma;
+  auto plain = Config(AnomalyMethod::Ewma);
+  flagged = 0;
+  for (time = 0; time < 5 * kDay; time += kStep) {
+    flagged += ewma.Add(plain, time, load(time) + noise(random)).has_value();
+  }
+  EXPECT_GE(flagged, 5);
+}
+
+TEST(AnomalyDetectorTest, MonitorKeepsBoundedSeriesAndLogsEvents) {
+  AnomalyMonitor monitor({}, 8);
+
+  for (uint64_t series = 0; series < 20; ++series) {
+    monitor.Observe(series, 0, 5.0);
+  }
+  EXPECT_EQ(monitor.Series(), 8u);
+  // Only the last eight fed are kept
+  for (int i = 1; i < 100; ++i) {
+    for (uint64_t series = 12; series < 20; ++series) {
+      monitor.Observe(series, i * 1000, 5.0 + (i % 2));
+    }
+  }
+
+  auto event = monitor.Observe(19, 100000, 50.0);
+  ASSERT_TRUE(event.has_value());
+  EXPECT_EQ(event->series, 19u);
+  // Series 0 was evicted and starts over, evicting series 12 in turn
+  EXPECT_FALSE(monitor.Observe(0, 100000, 50.0).has_value());
+  EXPECT_FALSE(monitor.Observe(12, 100000, 50.0).has_value());
+
+  auto open = monitor.Open();
+  ASSERT_EQ(open.size(), 1u);
+  EXPECT_EQ(open[0].series, 19u);
+
+  ASSERT_EQ(monitor.Events().size(), 1u);
+  EXPECT_TRUE(monitor.Events(100001).empty());
+
+  std::array<double, kMetricCount> row;
+  row.fill(5.0);
+  EXPECT_TRUE(monitor.ObserveRow(101000, row).empty());
+  EXPECT_EQ(monitor.Series(), 8u);
+}
@@ -0,0 +1,80 @@
+#include "CircuitBreaker.h"
+
+#include <gtest/gtest.h>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+BreakerOptions TestOptions() {
+  BreakerOptions options;
+  options.failureThreshold = 3;
+  options.baseBackoffMs = 1000;
+  options.maxBackoffMs = 3000;
+  return options;
+}
+
+void Fail(CircuitBreaker &breaker, int times) {
+  for (int i = 0; i < times; ++i) {
+    ASSERT_TRUE(breaker.Allow());
+    breaker.RecordFailure();
+  }
+}
+
+} // namespace
+
+TEST(CircuitBreakerTest, OpensAfterConsecutiveFailures) {
+  VirtualClock clock;
+  CircuitBreaker breaker(TestOptions(), clock);
+
+  Fail(breaker, 2);
+  breaker.RecordSuccess();
+  Fail(breaker, 2);
+  EXPECT_EQ(breaker.Snapshot().state, BreakerState::Closed);
+
+  Fail(breaker, 1);
+  auto snapshot = breaker.Snapshot();
+  EXPECT_EQ(snapshot.state, BreakerState::Open);
+  EXPECT_EQ(snapshot.opens, 1u);
+  EXPECT_EQ(*snapshot.retryInMs, 1000);
+  EXPECT_FALSE(breaker.Allow());
+}
+
+TEST(CircuitBreakerTest, HalfOpenAdmitsOneProbe) {
+  VirtualClock clock;
+  CircuitBreaker breaker(TestOptions(), clock);
+  Fail(breaker, 3);
+
+  clock.Advance(999);
+  EXPECT_FALSE(breaker.Allow());
+  clock.Advance(1);
+  EXPECT_TRUE(breaker.Allow());
+  EXPECT_EQ(breaker.Snapshot().state, BreakerState::HalfOpen);
+  EXPECT_FALSE(breaker.Allow());
+
+  breaker.RecordSuccess();
+  EXPECT_EQ(breaker.Snapshot().state, BreakerState::Closed);
+  EXPECT_EQ(breaker.Snapshot().consecutiveFailures, 0u);
+  EXPECT_TRUE(breaker.Allow());
+}
+
+TEST(CircuitBreakerTest, FailedProbesDoubleBackoffUpToCap) {
+  VirtualClock clock;
+  CircuitBreaker breaker(TestOptions(), clock);
+  Fail(breaker, 3);
+
+  for (int64_t expected : {2000, 3000, 3000}) {
+    clock.Advance(*breaker.Snapshot().retryInMs);
+    ASSERT_TRUE(breaker.Allow());
+    breaker.RecordFailure();
+    EXPECT_EQ(*breaker.Snapshot().retryInMs, expected);
+  }
+  EXPECT_EQ(breaker.Snapshot().opens, 4u);
+
+  // Recovery resets the back-off for the next outage
+  clock.Advance(3000);
+  ASSERT_TRUE(breaker.Allow());
+  breaker.RecordSuccess();
+  Fail(breaker, 3);
+  EXPECT_EQ(*breaker.Snapshot().retryInMs, 1000);
+}
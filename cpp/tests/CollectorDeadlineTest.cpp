@@ -0,0 +1,159 @@
+#include "CollectorDeadline.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+struct InlineExecutor final : Executor {
+  void Post(std::coroutine_handle<> handle) noexcept override {
+    handle.resume();
+  }
+};
+
+// Runs each posted coroutine on its own detached-until-joined thread
+struct ThreadExecutor final : Executor {
+  ~ThreadExecutor() override {
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  void Post(std::coroutine_handle<> handle) noexcept override {
+    std::lock_guard lock(mutex);
+    threads.emplace_back([handle] { handle.resume(); });
+  }
+
+  std::mutex mutex;
+  std::vector<std::thread> threads;
+};
+
+} // namespace
+
+TEST(CollectorDeadlineTest, FreshValueWithinDeadline) {
+  InlineExecutor executor;
+  AsyncScope scope;
+  CollectorStats stats;
+  DeadlineCollector<int> collector(Collector::Memory, 100, stats);
+
+  auto start = SteadyClock::Instance().NowMs();
+  auto ticket = collector.Start(executor, [] { return std::optional<int>(7); }, scope.Enter());
+  auto result = collector.Await(ticket, start, 1000);
+
+  ASSERT_TRUE(result.value);
+  EXPECT_EQ(*result.value, 7);
+  EXPECT_FALSE(result.stale);
+  EXPECT_EQ(stats.Snapshot(Collector::Memory).runs, 1u);
+  EXPECT_EQ(stats.Snapshot(Collector::Memory).timeouts, 0u);
+}
+
+TEST(CollectorDeadlineTest, TimeoutReturnsLastGoodMarkedStale) {
+  ThreadExecutor executor;
+  AsyncScope scope;
+  CollectorStats stats;
+  DeadlineCollector<int> collector(Collector::Wmi, 20, stats);
+
+  auto first = collector.Start(executor, [] { return std::optional<int>(1); }, scope.Enter());
+  ASSERT_EQ(*collector.Await(first, SteadyClock::Instance().NowMs(), 1000).value, 1);
+
+  std::mutex gate;
+  std::unique_lock stall(gate);
+  auto start = SteadyClock::Instance().NowMs();
+  auto second = collector.Start(executor, [&] {
+    std::lock_guard wait(gate);
+    return std::optional<int>(2);
+  }, scope.Enter());
+  auto result = collector.Await(second, start, 1000);
+
+  ASSERT_TRUE(result.value);
+  EXPECT_EQ(*result.value, 1);
+  EXPECT_TRUE(result.stale);
+  EXPECT_GE(result.ageMs, 0);
+  EXPECT_EQ(stats.Snapshot(Collector::Wmi).timeouts, 1u);
+
+  // A caller arriving while the stalled run is outstanding attaches to it
+  EXPECT_EQ(collector.Start(executor, [] { return std::optional<int>(3); }, scope.Enter()), second);
+
+  stall.unlock();
+  auto refreshed = collector.Await(second, SteadyClock::Instance().NowMs(), 1000);
+  EXPECT_EQ(*refreshed.value, 2);
+  EXPECT_FALSE(refreshed.stale);
+  scope.WaitIdle();
+}
+
+TEST(CollectorDeadlineTest, BudgetCapsOwnDeadline) {
+  ThreadExecutor executor;
+  AsyncScope scope;
+  CollectorStats stats;
+  DeadlineCollector<int> collector(Collector::Cpu, 10000, stats);
+
+  std::mutex gate;
+  std::unique_lock stall(gate);
+  auto start = SteadyClock::Instance().NowMs();
+  auto ticket = collector.Start(executor, [&] {
+    std::lock_guard wait(gate);
+    return std::optional<int>(1);
+  }, scope.Enter());
+  auto result = collector.Await(ticket, start, 10);
+
+  EXPECT_LT(SteadyClock::Instance().NowMs() - start, 5000);
+  EXPECT_FALSE(result.value);
+  EXPECT_TRUE(result.stale);
+
+  stall.unlock();
+  scope.WaitIdle();
+}
+
+TEST(CollectorDeadlineTest, FailureKeepsPreviousValue) {
+  InlineExecutor executor;
+  AsyncScope scope;
+  CollectorStats stats;
+  DeadlineCollector<int> collector(Collector::Battery, 100, stats);
+
+  auto start = SteadyClock::Instance().NowMs();
+  collector.Await(collector.Start(executor, [] { return std::optional<int>(5); }, scope.Enter()), start, 100);
+  auto result = collector.Await(collector.Start(executor, [] { return std::optional<int>(); }, scope.Enter()), start, 100);
+
+  EXPECT_EQ(*result.value, 5);
+  EXPECT_TRUE(result.stale);
+  EXPECT_EQ(stats.Snapshot(Collector::Battery).failures, 1u);
+}
+
+TEST(CollectorDeadlineTest, OpenBreakerSkipsRunsUntilProbe) {
+  InlineExecutor executor;
+  AsyncScope scope;
+  CollectorStats stats;
+  VirtualClock clock;
+  BreakerOptions breaker;
+  breaker.failureThreshold = 2;
+  breaker.baseBackoffMs = 1000;
+  DeadlineCollector<int> collector(Collector::Wmi, 100, stats, breaker, clock);
+
+  int calls = 0;
+  auto failing = [&] {
+    ++calls;
+    return std::optional<int>();
+  };
+  collector.Await(collector.Start(executor, [] { return std::optional<int>(9); }, scope.Enter()), 0, 100);
+  collector.Await(collector.Start(executor, failing, scope.Enter()), 0, 100);
+  collector.Await(collector.Start(executor, failing, scope.Enter()), 0, 100);
+  ASSERT_EQ(collector.Breaker().state, BreakerState::Open);
+
+  auto ticket = collector.Start(executor, failing, scope.Enter());
+  EXPECT_EQ(ticket, DeadlineCollector<int>::kSkipped);
+  auto result = collector.Await(ticket, 0, 100);
+  EXPECT_EQ(*result.value, 9);
+  EXPECT_TRUE(result.stale);
+  EXPECT_EQ(calls, 2);
+  EXPECT_EQ(stats.Snapshot(Collector::Wmi).skipped, 1u);
+  EXPECT_EQ(stats.Snapshot(Collector::Wmi).timeouts, 0u);
+
+  clock.Advance(1000);
+  auto probe = collector.Start(executor, [] { return std::optional<int>(10); }, scope.Enter());
+  EXPECT_NE(probe, DeadlineCollector<int>::kSkipped);
+  EXPECT_EQ(*collector.Await(probe, 1000, 100).value, 10);
+  EXPECT_EQ(collector.Breaker().state, BreakerState::Closed);
+}
@@ -0,0 +1,80 @@
+#include "Downsample.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+struct Series {
+  std::vector<double> x;
+  std::vector<double> y;
+};
+
+// Slow sine with one spike, which a decimator must not lose
+Series Spiky(size_t count, size_t spikeAt) {
+  Series series;
+  for (size_t i = 0; i < count; ++i) {
+    series.x.push_back(static_cast<double>(i) * 1000.0);
+    series.y.push_back(i == spikeAt ? 100.0 : std::sin(static_cast<double>(i) / 50.0));
+  }
+  return series;
+}
+
+bool Contains(std::vector<uint32_t> const &indices, uint32_t index) {
+  return std::find(indices.begin(), indices.end(), index) != indices.end();
+}
+
+} // namespace
+
+TEST(DownsampleTest, ParsesModeNames) {
+  EXPECT_EQ(ParseDownsampleMode("lttb"), DownsampleMode::Lttb);
+  EXPECT_EQ(ParseDownsampleMode("m4"), DownsampleMode::M4);
+  EXPECT_EQ(ParseDownsampleMode("none"), DownsampleMode::None);
+  EXPECT_FALSE(ParseDownsampleMode("median"));
+}
+
+TEST(DownsampleTest, LttbKeepsEndpointsAndSpikes) {
+  auto series = Spiky(10000, 4321);
+
+  auto indices = LttbIndices(series.x, series.y, 200);
+
+  ASSERT_EQ(indices.size(), 200u);
+  EXPECT_EQ(indices.front(), 0u);
+  EXPECT_EQ(indices.back(), 9999u);
+  EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+  EXPECT_TRUE(Contains(indices, 4321));
+}
+
+TEST(DownsampleTest, M4KeepsEveryBucketsExtremes) {
+  auto series = Spiky(10000, 4321);
+
+  auto indices = M4Indices(series.x, series.y, 400);
+
+  EXPECT_LE(indices.size(), 400u);
+  EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+  EXPECT_EQ(std::adjacent_find(indices.begin(), indices.end()), indices.end());
+  EXPECT_EQ(indices.front(), 0u);
+  EXPECT_EQ(indices.back(), 9999u);
+  EXPECT_TRUE(Contains(indices, 4321));
+
+  // The global minimum of the sine survives too
+  auto minimum = std::min_element(series.y.begin(), series.y.end()) - series.y.begin();
+  EXPECT_TRUE(Contains(indices, static_cast<uint32_t>(minimum)));
+}
+
+TEST(DownsampleTest, ShortSeriesAndNaNs) {
+  auto nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> x = {0, 1, 2, 3, 4};
+  std::vector<double> y = {1, nan, 3, nan, 5};
+
+  EXPECT_EQ(LttbIndices(x, y, 10), (std::vector<uint32_t>{0, 2, 4}));
+  EXPECT_EQ(M4Indices(x, y, 10), (std::vector<uint32_t>{0, 2, 4}));
+  EXPECT_EQ(LttbIndices(x, y, 2), (std::vector<uint32_t>{0, 4}));
+  EXPECT_TRUE(M4Indices(x, std::vector<double>(5, nan), 4).empty());
+}
@@ -0,0 +1,121 @@
+#include "GorillaCodec.h"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+std::vector<int64_t> RoundTrip(std::vector<int64_t> const &timestamps, size_t *encodedBytes = nullptr) {
+  std::vector<uint8_t> bytes;
+  Gorilla::EncodeTimestamps(timestamps, bytes);
+  if (encodedBytes) {
+    *encodedBytes = bytes.size();
+  }
+  std::vector<int64_t> decoded(timestamps.size());
+  EXPECT_EQ(Gorilla::DecodeTimestamps(bytes, decoded.size(), decoded.data()), bytes.size());
+  return decoded;
+}
+
+// Compared bit for bit so NaN payloads and -0.0 count
+std::vector<uint64_t> RoundTripBits(std::vector<double> const &values, size_t *encodedBytes = nullptr) {
+  std::vector<uint8_t> bytes;
+  Gorilla::EncodeValues(values, bytes);
+  if (encodedBytes) {
+    *encodedBytes = bytes.size();
+  }
+  std::vector<double> decoded(values.size());
+  EXPECT_EQ(Gorilla::DecodeValues(bytes, decoded.size(), decoded.data()), bytes.size());
+  std::vector<uint64_t> bits;
+  for (auto value : decoded) {
+    bits.push_back(std::bit_cast<uint64_t>(value));
+  }
+  return bits;
+}
+
+std::vector<uint64_t> Bits(std::vector<double> const &values) {
+  std::vector<uint64_t> bits;
+  for (auto value : values) {
+    bits.push_back(std::bit_cast<uint64_t>(value));
+  }
+  return bits;
+}
+
+} // namespace
+
+TEST(GorillaCodecTest, SteadyCadenceCostsABitPerTimestamp) {
+  std::vector<int64_t> timestamps;
+  for (int64_t i = 0; i < 1024; ++i) {
+    timestamps.push_back(1'700'000'000'000 + i * 1000);
+  }
+
+  size_t bytes = 0;
+  EXPECT_EQ(RoundTrip(timestamps, &bytes), timestamps);
+  // 64 bits for the first, a bucketed first delta, then one bit each
+  EXPECT_LT(bytes, 8u + 8u + 1024u / 8 + 1);
+}
+
+TEST(GorillaCodecTest, IrregularTimestampsRoundTrip) {
+  std::mt19937_64 random(7);
+  std::vector<int64_t> timestamps{0};
+  for (int i = 0; i < 2000; ++i) {
+    // Jitter, stalls and the odd clock jump across every bucket
+    auto step = static_cast<int64_t>(random() % 50) + 990;
+    if (i % 97 == 0) {
+      step += 3'600'000;
+    }
+    if (i % 501 == 0) {
+      step = 0;
+    }
+    timestamps.push_back(timestamps.back() + step);
+  }
+  EXPECT_EQ(RoundTrip(timestamps), timestamps);
+
+  std::vector<int64_t> extremes{std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min(), 0, -1,
+      std::numeric_limits<int64_t>::max(), 42};
+  EXPECT_EQ(RoundTrip(extremes), extremes);
+}
+
+TEST(GorillaCodecTest, ValuesRoundTripBitForBit) {
+  std::mt19937_64 random(11);
+  std::vector<double> values;
+  for (int i = 0; i < 500; ++i) {
+    values.push_back(50.0 + static_cast<double>(random() % 1000) / 100.0);
+  }
+  values.insert(values.end(), {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), 0.0, -0.0,
+                                  std::numeric_limits<double>::infinity(), std::numeric_limits<double>::denorm_min(), 1e308});
+  for (int i = 0; i < 200; ++i) {
+    values.push_back(std::bit_cast<double>(random()));
+  }
+  EXPECT_EQ(RoundTripBits(values), Bits(values));
+}
+
+TEST(GorillaCodecTest, RepeatedValuesCostABitEach) {
+  std::vector<double> values(1024, 16.0 * 1024 * 1024 * 1024);
+  size_t bytes = 0;
+  EXPECT_EQ(RoundTripBits(values, &bytes), Bits(values));
+  EXPECT_LE(bytes, 8u + 1023u / 8 + 1);
+}
+
+TEST(GorillaCodecTest, TruncatedColumnsAreRejected) {
+  std::vector<int64_t> timestamps{0, 1000, 2000, 5000, 100000};
+  std::vector<uint8_t> bytes;
+  Gorilla::EncodeTimestamps(timestamps, bytes);
+  bytes.pop_back();
+  std::vector<int64_t> decodedTimes(timestamps.size());
+  EXPECT_EQ(Gorilla::DecodeTimestamps(bytes, decodedTimes.size(), decodedTimes.data()), 0u);
+
+  std::vector<double> values{1.5, 2.25, -7.0};
+  bytes.clear();
+  Gorilla::EncodeValues(values, bytes);
+  bytes.resize(bytes.size() - 2);
+  std::vector<double> decodedValues(values.size());
+  EXPECT_EQ(Gorilla::DecodeValues(bytes, decodedValues.size(), decodedValues.data()), 0u);
+}
@@ -0,0 +1,72 @@
+#include "LastKnownValue.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace ReactNativeDeviceAiCore;
+
+TEST(LastKnownValueTest, UnknownUntilFirstGoodRead) {
+  ValueStore store;
+  LastKnownValue<double> total(store, "memory.total");
+
+  auto reading = total.Resolve(std::nullopt, "GetPerformanceInfo", 0);
+
+  EXPECT_EQ(reading.state, ValueState::Unknown);
+  EXPECT_FALSE(reading.value);
+}
+
+TEST(LastKnownValueTest, FailedReadReturnsLastGoodWithAge) {
+  ValueStore store;
+  LastKnownValue<double> usage(store, "cpu.usage");
+
+  auto live = usage.Resolve(37.5, "PDH", 1000);
+  EXPECT_EQ(live.state, ValueState::Live);
+  EXPECT_EQ(*live.value, 37.5);
+
+  auto fallback = usage.Resolve(std::nullopt, "PDH", 4000);
+  EXPECT_EQ(fallback.state, ValueState::LastKnown);
+  EXPECT_EQ(*fallback.value, 37.5);
+  EXPECT_EQ(fallback.ageMs, 3000);
+}
+
+TEST(LastKnownValueTest, StoreExportsCountersPerField) {
+  ValueStore store;
+  LastKnownValue<double> level(store, "battery.level");
+  LastKnownValue<std::string> type(store, "network.type");
+
+  level.Resolve(std::nullopt, "GetSystemPowerStatus", 0);
+  level.Resolve(80.0, "GetSystemPowerStatus", 100);
+  level.Resolve(std::nullopt, "GetSystemPowerStatus", 200);
+  type.Resolve(std::string("ethernet"), "NetworkInformation", 100);
+
+  auto stats = store.Stats(500);
+  ASSERT_EQ(stats.size(), 2u);
+  EXPECT_STREQ(stats[0].name, "battery.level");
+  EXPECT_STREQ(stats[0].source, "GetSystemPowerStatus");
+  EXPECT_EQ(stats[0].live, 1u);
+  EXPECT_EQ(stats[0].lastKnown, 1u);
+  EXPECT_EQ(stats[0].unknown, 1u);
+  EXPECT_EQ(*stats[0].lastGoodAgeMs, 400);
+  EXPECT_STREQ(stats[1].name, "network.type");
+  EXPECT_EQ(stats[1].live, 1u);
+}
+
+TEST(LastKnownValueTest, SectionStateTakesWorstFieldAndOldestAge) {
+  ValueStore store;
+  LastKnownValue<double> total(store, "storage.total");
+  LastKnownValue<double> available(store, "storage.available");
+  total.Resolve(100.0, "GetDiskFreeSpaceEx", 0);
+
+  SectionState state;
+  EXPECT_FALSE(state.AgeMs());
+  auto first = state.Add(total.Resolve(std::nullopt, "GetDiskFreeSpaceEx", 250));
+  EXPECT_EQ(state.State(), ValueState::LastKnown);
+  EXPECT_EQ(*state.AgeMs(), 250);
+  EXPECT_EQ(*first, 100.0);
+  EXPECT_FALSE(state.AnyLive());
+
+  auto second = state.Add(available.Resolve(std::nullopt, "GetDiskFreeSpaceEx", 250));
+  EXPECT_FALSE(second);
+  EXPECT_EQ(state.State(), ValueState::Unknown);
+}
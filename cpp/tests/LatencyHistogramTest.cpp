@@ -0,0 +1,96 @@
+#include "LatencyHistogram.h"
+#include "SpanRecorder.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+TEST(LatencyHistogramTest, BucketsCoverEveryValueWithBoundedError) {
+  size_t previous = 0;
+  for (uint64_t value : {0ull, 1ull, 31ull, 32ull, 63ull, 64ull, 65ull, 1000ull, 123456ull, 1ull << 30, (1ull << 36) + 5}) {
+    auto index = LatencyHistogram::BucketIndex(value);
+    ASSERT_LT(index, LatencyHistogram::kBucketCount);
+    EXPECT_GE(index, previous);
+    previous = index;
+
+    auto upper = LatencyHistogram::BucketUpperBound(index);
+    EXPECT_GE(upper, value);
+    EXPECT_LE(static_cast<double>(upper - value), 0.035 * static_cast<double>(value) + 1.0);
+  }
+
+  // Adjacent buckets tile the range without gaps
+  for (size_t index = 1; index < LatencyHistogram::kBucketCount; ++index) {
+    ASSERT_EQ(LatencyHistogram::BucketIndex(LatencyHistogram::BucketUpperBound(index - 1) + 1), index);
+  }
+}
+
+TEST(LatencyHistogramTest, PercentilesOfUniformDistribution) {
+  LatencyHistogram histogram;
+  for (uint64_t micros = 1; micros <= 1000; ++micros) {
+    histogram.Record(micros * 1000);
+  }
+
+  auto snapshot = histogram.Snapshot();
+  EXPECT_EQ(snapshot.count, 1000u);
+  EXPECT_EQ(snapshot.maxNs, 1000000u);
+  EXPECT_NEAR(static_cast<double>(snapshot.p50Ns), 500000.0, 500000.0 * 0.035);
+  EXPECT_NEAR(static_cast<double>(snapshot.p90Ns), 900000.0, 900000.0 * 0.035);
+  EXPECT_NEAR(static_cast<double>(snapshot.p99Ns), 990000.0, 990000.0 * 0.035);
+  EXPECT_LE(snapshot.p99Ns, snapshot.maxNs);
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecordsAreAllCounted) {
+  LatencyHistogram histogram;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&histogram, t] {
+      for (uint64_t i = 0; i < 10000; ++i) {
+        histogram.Record(i * (t + 1));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  auto snapshot = histogram.Snapshot();
+  EXPECT_EQ(snapshot.count, 40000u);
+  EXPECT_EQ(snapshot.maxNs, 9999u * 4);
+}
+
+TEST(LatencyHistogramTest, ScopedSpanRecordsOutcome) {
+  SpanRecorder recorder;
+  {
+    ScopedSpan span(recorder, Span::WmiConnect);
+  }
+  {
+    ScopedSpan span(recorder, Span::WmiConnect);
+    span.Fail();
+    span.Fallback();
+  }
+
+  auto stats = recorder.Snapshot(Span::WmiConnect);
+  EXPECT_EQ(stats.calls, 2u);
+  EXPECT_EQ(stats.failures, 1u);
+  EXPECT_EQ(stats.fallbacks, 1u);
+  EXPECT_EQ(recorder.Snapshot(Span::Memory).calls, 0u);
+  EXPECT_STREQ(ToString(Span::WmiConnect), "wmi.connect");
+}
+
+TEST(LatencyHistogramTest, SpanLatencyConvertsToSketch) {
+  SpanRecorder recorder;
+  // 1 to 100 ms
+  for (uint64_t ms = 1; ms <= 100; ++ms) {
+    recorder.Record(Span::Cpu, ms * 1000000, true);
+  }
+
+  auto sketch = recorder.LatencySketch(Span::Cpu);
+  EXPECT_EQ(sketch.Count(), 100u);
+  // Histogram and sketch error combined
+  EXPECT_NEAR(sketch.Quantile(0.5), 50.0, 50.0 * 0.05);
+  EXPECT_NEAR(sketch.Quantile(0.99), 99.0, 99.0 * 0.05);
+  EXPECT_TRUE(recorder.LatencySketch(Span::Memory).Empty());
+}
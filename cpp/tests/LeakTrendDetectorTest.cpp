@@ -0,0 +1,96 @@
+#include "LeakTrendDetector.h"
+#include "ProcessTrendTracker.h"
+
+#include <gtest/gtest.h>
+
+using namespace ReactNativeDeviceAiCore;
+
+TEST(LeakTrendDetectorTest, InsufficientUntilWindowSpansEnoughTime) {
+  LeakTrendDetector detector;
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(detector.Add(i * 1000, 100.0 + i).verdict, TrendVerdict::Insufficient);
+  }
+}
+
+TEST(LeakTrendDetectorTest, FlatSeriesIsStable) {
+  LeakTrendDetector detector;
+
+  LeakTrend trend;
+  for (int i = 0; i < 60; ++i) {
+    trend = detector.Add(i * 10000, 200e6 + (i % 3) * 1e5);
+  }
+
+  EXPECT_EQ(trend.verdict, TrendVerdict::Stable);
+}
+
+TEST(LeakTrendDetectorTest, SteadyGrowthIsLeaking) {
+  LeakTrendDetector detector;
+
+  // 1 MB every 10 s on a 200 MB base is 360 MB/h, far above 5 %/h.
+  LeakTrend trend;
+  for (int i = 0; i < 60; ++i) {
+    trend = detector.Add(i * 10000, 200e6 + i * 1e6);
+  }
+
+  EXPECT_EQ(trend.verdict, TrendVerdict::Leaking);
+  EXPECT_NEAR(trend.slopePerHour, 360e6, 1e3);
+  EXPECT_DOUBLE_EQ(trend.monotonicFraction, 1.0);
+}
+
+TEST(LeakTrendDetectorTest, NoisyGrowthIsGrowingNotLeaking) {
+  LeakTrendDetector detector;
+
+  LeakTrend trend;
+  for (int i = 0; i < 60; ++i) {
+    double sawtooth = (i % 2 == 0) ? 4e6 : -4e6;
+    trend = detector.Add(i * 10000, 200e6 + i * 1e6 + sawtooth);
+  }
+
+  EXPECT_EQ(trend.verdict, TrendVerdict::Growing);
+}
+
+TEST(LeakTrendDetectorTest, WindowForgetsOldGrowth) {
+  LeakTrendDetector detector;
+
+  for (int i = 0; i < 60; ++i) {
+    detector.Add(i * 10000, 200e6 + i * 1e6);
+  }
+  LeakTrend trend;
+  for (int i = 60; i < 60 + static_cast<int>(LeakTrendDetector::kWindow); ++i) {
+    trend = detector.Add(i * 10000, 260e6);
+  }
+
+  EXPECT_EQ(trend.verdict, TrendVerdict::Stable);
+  EXPECT_EQ(trend.samples, LeakTrendDetector::kWindow);
+}
+
+TEST(ProcessTrendTrackerTest, ReportsVerdictChangesPerMetric) {
+  ProcessTrendTracker tracker;
+
+  std::vector<ProcessTrendChange> changes;
+  for (int i = 0; i < 60; ++i) {
+    ProcessCounters counters;
+    counters.privateBytes = 100000000ull + i * 1000000ull;
+    counters.workingSet = 150000000ull;
+    counters.handleCount = 400;
+    // Read on every third tick only
+    if (i % 3 == 0) {
+      counters.threadCount = 20;
+    }
+    counters.pageFaultCount = i * 50;
+    auto tick = tracker.Track(counters, i * 10000);
+    changes.insert(changes.end(), tick.begin(), tick.end());
+  }
+
+  EXPECT_EQ(tracker.Trend(ProcessMetric::PrivateBytes).verdict, TrendVerdict::Leaking);
+  EXPECT_EQ(tracker.Trend(ProcessMetric::HandleCount).verdict, TrendVerdict::Stable);
+  EXPECT_EQ(tracker.Trend(ProcessMetric::ThreadCount).samples, 20u);
+  EXPECT_DOUBLE_EQ(tracker.PageFaultsPerSec(), 5.0);
+
+  // Every metric leaves Insufficient once; private bytes settles on Leaking.
+  ASSERT_EQ(changes.size(), kProcessMetricCount);
+  for (auto const &change : changes) {
+    EXPECT_EQ(change.previous, TrendVerdict::Insufficient);
+  }
+}
@@ -0,0 +1,171 @@
+#include "LinuxPlatformProvider.h"
+#include "SnapshotAssembler.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+// Minimal /proc and /sys tree under a temporary root
+class LinuxPlatformProviderTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    m_root = std::filesystem::temp_directory_path() /
+        ("deviceai-linux-" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+    std::filesystem::remove_all(m_root);
+
+    Write("proc/meminfo",
+        "MemTotal:       16384000 kB\n"
+        "MemFree:         1000000 kB\n"
+        "MemAvailable:    8192000 kB\n"
+        "CommitLimit:    20000000 kB\n"
+        "Committed_AS:    5000000 kB\n");
+    Write("proc/stat",
+        "cpu  100 0 100 800 0 0 0 0 0 0\n"
+        "cpu0 50 0 50 400 0 0 0 0 0 0\n"
+        "cpu1 50 0 50 400 0 0 0 0 0 0\n"
+        "intr 0\n");
+    Write("proc/cpuinfo", "processor\t: 0\nmodel name\t: Test CPU @ 3.00GHz\n");
+    Write("proc/net/route",
+        "Iface\tDestination\tGateway \tFlags\tRefCnt\tUse\tMetric\tMask\t\tMTU\tWindow\tIRTT\n"
+        "wlan0\t0000A8C0\t00000000\t0001\t0\t0\t600\t00FFFFFF\t0\t0\t0\n"
+        "wlan0\t00000000\t0100A8C0\t0003\t0\t0\t600\t00000000\t0\t0\t0\n");
+    Write("sys/class/net/wlan0/type", "1\n");
+    std::filesystem::create_directories(m_root / "sys/class/net/wlan0/wireless");
+    Write("sys/class/power_supply/AC/type", "Mains\n");
+    Write("sys/class/power_supply/BAT0/type", "Battery\n");
+    Write("sys/class/power_supply/BAT0/capacity", "57\n");
+    Write("sys/class/power_supply/BAT0/status", "Charging\n");
+    Write("sys/class/dmi/id/product_name", "Test Laptop\n");
+    Write("etc/os-release", "NAME=Test\nPRETTY_NAME=\"Test Linux 1.0\"\n");
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(m_root);
+  }
+
+  void Write(std::string const &path, std::string const &content) {
+    auto full = m_root / path;
+    std::filesystem::create_directories(full.parent_path());
+    std::ofstream(full) << content;
+  }
+
+  std::string Root() const {
+    return m_root.string();
+  }
+
+  std::filesystem::path m_root;
+};
+
+} // namespace
+
+TEST_F(LinuxPlatformProviderTest, ParsesFixtureTree) {
+  LinuxPlatformProvider provider(Root(), Root());
+
+  auto memory = provider.ReadMemory();
+  EXPECT_EQ(memory.total.value, 16384000.0 * 1024);
+  EXPECT_EQ(memory.available.value, 8192000.0 * 1024);
+
+  auto storage = provider.ReadStorage();
+  EXPECT_TRUE(storage.total.value.has_value());
+  EXPECT_GT(*storage.total.value, 0.0);
+
+  auto battery = provider.ReadBattery();
+  EXPECT_EQ(battery.level.value, 57.0);
+  EXPECT_EQ(battery.charging.value, true);
+
+  EXPECT_EQ(provider.ReadCpu().cores.value, 2.0);
+
+  auto network = provider.ReadNetwork();
+  EXPECT_EQ(network.type.value, "wifi");
+  EXPECT_EQ(network.connected.value, true);
+
+  EXPECT_EQ(provider.ReadPerformanceCounters().memoryUsage.value, 25.0);
+
+  auto wmi = provider.ReadWmi();
+  EXPECT_EQ(wmi.computerSystem.value, "Test Laptop");
+  EXPECT_EQ(wmi.operatingSystem.value, "Test Linux 1.0");
+  EXPECT_EQ(wmi.processor.value, "Test CPU @ 3.00GHz");
+}
+
+TEST_F(LinuxPlatformProviderTest, CpuUsageIsMeasuredBetweenReads) {
+  LinuxPlatformProvider provider(Root(), Root());
+
+  // No tick since the constructor primed the baseline
+  EXPECT_FALSE(provider.ReadCpu().usage.value.has_value());
+
+  // 300 more busy ticks out of 400
+  Write("proc/stat", "cpu  250 0 250 900 0 0 0 0 0 0\ncpu0 0 0 0 0 0 0 0 0 0 0\n");
+  EXPECT_EQ(provider.ReadCpu().usage.value, 75.0);
+
+  // The performance counter keeps its own baseline
+  EXPECT_EQ(provider.ReadPerformanceCounters().cpuUsage.value, 75.0);
+
+  Write("proc/stat", "cpu  250 0 250 1000 0 0 0 0 0 0\ncpu0 0 0 0 0 0 0 0 0 0 0\n");
+  EXPECT_EQ(provider.ReadCpu().usage.value, 0.0);
+}
+
+TEST_F(LinuxPlatformProviderTest, MissingBatteryReportsMainsPower) {
+  std::filesystem::remove_all(m_root / "sys/class/power_supply/BAT0");
+  LinuxPlatformProvider provider(Root(), Root());
+
+  auto battery = provider.ReadBattery();
+  EXPECT_EQ(battery.level.value, 100.0);
+  EXPECT_EQ(battery.charging.value, false);
+}
+
+TEST_F(LinuxPlatformProviderTest, NoDefaultRouteIsDisconnected) {
+  Write("proc/net/route", "Iface\tDestination\tGateway \tFlags\n");
+  LinuxPlatformProvider provider(Root(), Root());
+
+  auto network = provider.ReadNetwork();
+  EXPECT_EQ(network.type.value, "none");
+  EXPECT_EQ(network.connected.value, false);
+}
+
+TEST_F(LinuxPlatformProviderTest, MissingFilesAreFailedReads) {
+  std::filesystem::remove_all(m_root);
+  LinuxPlatformProvider provider(Root(), Root() + "/missing");
+
+  EXPECT_FALSE(provider.ReadMemory().total.value.has_value());
+  EXPECT_FALSE(provider.ReadStorage().total.value.has_value());
+  EXPECT_FALSE(provider.ReadBattery().level.value.has_value());
+  EXPECT_FALSE(provider.ReadCpu().cores.value.has_value());
+  EXPECT_FALSE(provider.ReadNetwork().connected.value.has_value());
+}
+
+TEST_F(LinuxPlatformProviderTest, ReadsIdentityFromUname) {
+  LinuxPlatformProvider provider(Root(), Root());
+
+  auto identity = provider.ReadIdentity();
+  EXPECT_FALSE(identity.osVersion.value.value_or("").empty());
+  EXPECT_FALSE(identity.architecture.value.value_or("").empty());
+  EXPECT_EQ(identity.processor.value, "Test CPU @ 3.00GHz");
+}
+
+TEST_F(LinuxPlatformProviderTest, FeedsSnapshotAssembly) {
+  LinuxPlatformProvider provider(Root(), Root());
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+
+  auto snapshot = assembler.Assemble(1000);
+  EXPECT_EQ(snapshot[Metric::MemoryAvailable].value, 8192000.0 * 1024);
+  EXPECT_EQ(snapshot[Metric::BatteryLevel].value, 57.0);
+  EXPECT_EQ(snapshot[TextField::NetworkType].View(), "wifi");
+  EXPECT_EQ(snapshot[TextField::WmiOperatingSystem].View(), "Test Linux 1.0");
+  EXPECT_EQ(snapshot.Section(Collector::Memory).state, ValueState::Live);
+
+  // No /proc/diskstats in the fixture, so disk usage falls back to unknown
+  EXPECT_EQ(snapshot[Metric::CounterDiskUsage].state, ValueState::Unknown);
+
+  auto stats = assembler.FallbackStats(1000);
+  auto memory = std::find_if(stats.begin(), stats.end(), [](auto const &field) { return field.name == std::string("memory.total"); });
+  ASSERT_NE(memory, stats.end());
+  EXPECT_STREQ(memory->source, "/proc/meminfo");
+}
@@ -0,0 +1,57 @@
+#include "MemoryBreakdown.h"
+
+#include <gtest/gtest.h>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+MemoryCounters Counters(uint32_t pageFaults, uint32_t hardFaults) {
+  MemoryCounters counters;
+  counters.commitTotal = 6ull << 30;
+  counters.commitLimit = 8ull << 30;
+  counters.pageFaultCount = pageFaults;
+  counters.hardFaultCount = hardFaults;
+  return counters;
+}
+
+} // namespace
+
+TEST(FaultRateTrackerTest, FirstReadingHasNoRate) {
+  FaultRateTracker tracker;
+
+  auto breakdown = tracker.Update(Counters(1000, 10), 0);
+
+  EXPECT_DOUBLE_EQ(breakdown.pageFaultsPerSec, 0.0);
+  EXPECT_DOUBLE_EQ(breakdown.hardFaultsPerSec, 0.0);
+  EXPECT_DOUBLE_EQ(breakdown.commitPercent, 75.0);
+}
+
+TEST(FaultRateTrackerTest, RatesComeFromCounterDeltas) {
+  FaultRateTracker tracker;
+  tracker.Update(Counters(1000, 10), 0);
+
+  auto breakdown = tracker.Update(Counters(3000, 60), 500);
+
+  EXPECT_DOUBLE_EQ(breakdown.pageFaultsPerSec, 4000.0);
+  EXPECT_DOUBLE_EQ(breakdown.hardFaultsPerSec, 100.0);
+}
+
+TEST(FaultRateTrackerTest, HandlesCounterWrap) {
+  FaultRateTracker tracker;
+  tracker.Update(Counters(0xFFFFFF00u, 0), 0);
+
+  auto breakdown = tracker.Update(Counters(0x00000100u, 0), 1000);
+
+  EXPECT_DOUBLE_EQ(breakdown.pageFaultsPerSec, 512.0);
+}
+
+TEST(FaultRateTrackerTest, BackToBackReadsKeepLastRate) {
+  FaultRateTracker tracker;
+  tracker.Update(Counters(0, 0), 0);
+  tracker.Update(Counters(100, 0), 1000);
+
+  auto breakdown = tracker.Update(Counters(150, 0), 1000);
+
+  EXPECT_DOUBLE_EQ(breakdown.pageFaultsPerSec, 100.0);
+}
@@ -0,0 +1,42 @@
+#include "MemoryPressureHysteresis.h"
+
+#include <gtest/gtest.h>
+
+using namespace ReactNativeDeviceAiCore;
+
+TEST(MemoryPressureHysteresisTest, EntersLowImmediately) {
+  MemoryPressureHysteresis hysteresis(5000);
+
+  EXPECT_FALSE(hysteresis.Observe(MemoryPressureLevel::Normal, 0));
+
+  auto transition = hysteresis.Observe(MemoryPressureLevel::Low, 100);
+  ASSERT_TRUE(transition);
+  EXPECT_EQ(*transition, MemoryPressureLevel::Low);
+
+  EXPECT_FALSE(hysteresis.Observe(MemoryPressureLevel::Low, 200));
+}
+
+TEST(MemoryPressureHysteresisTest, RecoveryWaitsForHold) {
+  MemoryPressureHysteresis hysteresis(5000);
+  hysteresis.Observe(MemoryPressureLevel::Low, 0);
+
+  EXPECT_FALSE(hysteresis.Observe(MemoryPressureLevel::Normal, 1000));
+  EXPECT_FALSE(hysteresis.Observe(MemoryPressureLevel::Normal, 5999));
+
+  auto transition = hysteresis.Observe(MemoryPressureLevel::Normal, 6000);
+  ASSERT_TRUE(transition);
+  EXPECT_EQ(*transition, MemoryPressureLevel::Normal);
+}
+
+TEST(MemoryPressureHysteresisTest, FlappingDoesNotProduceStorm) {
+  MemoryPressureHysteresis hysteresis(5000);
+
+  int64_t now = 0;
+  for (int i = 0; i < 100; ++i) {
+    hysteresis.Observe(i % 2 == 0 ? MemoryPressureLevel::Low : MemoryPressureLevel::Normal, now);
+    now += 1000;
+  }
+
+  EXPECT_EQ(hysteresis.Transitions(), 1u);
+  EXPECT_EQ(hysteresis.Level(), MemoryPressureLevel::Low);
+}
@@ -0,0 +1,151 @@
+#include "MetricHistory.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+DeviceSnapshot WithCpu(double usage, ValueState state = ValueState::Live) {
+  DeviceSnapshot snapshot;
+  snapshot[Metric::CpuUsage] = {usage, state, 0};
+  snapshot[Metric::MemoryAvailable] = {usage * 2, ValueState::Live, 0};
+  return snapshot;
+}
+
+} // namespace
+
+TEST(MetricHistoryTest, QueriesAnInclusiveTimeRange) {
+  MetricHistory history(100);
+  for (int i = 0; i < 10; ++i) {
+    history.Append(1000 * i, WithCpu(i));
+  }
+
+  HistoryQuery query;
+  query.metrics = {Metric::CpuUsage, Metric::MemoryAvailable};
+  query.fromMs = 2000;
+  query.toMs = 5000;
+  auto window = history.Query(query);
+
+  EXPECT_EQ(window.timestampsMs, (std::vector<double>{2000, 3000, 4000, 5000}));
+  ASSERT_EQ(window.series.size(), 2u);
+  EXPECT_EQ(window.series[0].metric, Metric::CpuUsage);
+  EXPECT_EQ(window.series[0].values, (std::vector<double>{2, 3, 4, 5}));
+  EXPECT_FALSE(window.decimated);
+  EXPECT_TRUE(window.series[0].timestampsMs.empty());
+  EXPECT_EQ(window.series[1].values, (std::vector<double>{4, 6, 8, 10}));
+}
+
+TEST(MetricHistoryTest, OverwritesTheOldestRowsWhenFull) {
+  MetricHistory history(4);
+  for (int i = 0; i < 10; ++i) {
+    history.Append(1000 * i, WithCpu(i));
+  }
+
+  HistoryQuery query;
+  query.metrics = {Metric::CpuUsage};
+  auto window = history.Query(query);
+
+  EXPECT_EQ(history.Size(), 4u);
+  EXPECT_EQ(window.timestampsMs, (std::vector<double>{6000, 7000, 8000, 9000}));
+  EXPECT_EQ(window.series[0].values, (std::vector<double>{6, 7, 8, 9}));
+}
+
+TEST(MetricHistoryTest, OnlyLiveValuesAreRecorded) {
+  MetricHistory history(10);
+  history.Append(0, WithCpu(1));
+  history.Append(1000, WithCpu(1, ValueState::LastKnown));
+  // Earlier than the newest row: kept in order at the newest time
+  history.Append(500, WithCpu(3));
+
+  HistoryQuery query;
+  query.metrics = {Metric::CpuUsage};
+  auto window = history.Query(query);
+
+  EXPECT_EQ(window.timestampsMs, (std::vector<double>{0, 1000, 1000}));
+  EXPECT_EQ(window.series[0].values[0], 1.0);
+  EXPECT_TRUE(std::isnan(window.series[0].values[1]));
+  EXPECT_EQ(window.series[0].values[2], 3.0);
+}
+
+TEST(MetricHistoryTest, DecimatesEachSeriesWithItsOwnTimestamps) {
+  MetricHistory history;
+  for (int i = 0; i < 86400; ++i) {
+    history.Append(1000LL * i, WithCpu(i == 50000 ? 100.0 : 10.0));
+  }
+
+  HistoryQuery query;
+  query.metrics = {Metric::CpuUsage};
+  query.maxPoints = 1000;
+  query.mode = DownsampleMode::M4;
+  auto window = history.Query(query);
+
+  ASSERT_TRUE(window.decimated);
+  auto const &series = window.series[0];
+  EXPECT_LE(series.values.size(), 1000u);
+  ASSERT_EQ(series.timestampsMs.size(), series.values.size());
+  EXPECT_EQ(series.timestampsMs.front(), 0.0);
+  EXPECT_EQ(series.timestampsMs.back(), 86399000.0);
+  EXPECT_NE(std::find(series.values.begin(), series.values.end(), 100.0), series.values.end());
+}
+
+TEST(MetricHistoryTest, QueriesAcrossSealedBlocks) {
+  MetricHistory history(100, 8);
+  for (int i = 0; i < 30; ++i) {
+    history.Append(1000 * i, WithCpu(i % 5 == 0 ? 0.5 * i : i, i == 12 ? ValueState::Unknown : ValueState::Live));
+  }
+  EXPECT_EQ(history.Blocks(), 3u);
+
+  HistoryQuery query;
+  query.metrics = {Metric::CpuUsage};
+  query.fromMs = 6000;
+  query.toMs = 26000;
+  auto window = history.Query(query);
+
+  ASSERT_EQ(window.timestampsMs.size(), 21u);
+  for (int i = 6; i <= 26; ++i) {
+    auto const value = window.series[0].values[static_cast<size_t>(i - 6)];
+    EXPECT_EQ(window.timestampsMs[static_cast<size_t>(i - 6)], 1000.0 * i);
+    if (i == 12) {
+      EXPECT_TRUE(std::isnan(value));
+    } else {
+      EXPECT_EQ(value, i % 5 == 0 ? 0.5 * i : i);
+    }
+  }
+
+  auto block = history.Block(1);
+  ASSERT_NE(block, nullptr);
+  EXPECT_EQ(block->firstMs, 8000);
+  EXPECT_EQ(block->lastMs, 15000);
+  std::vector<double> values(block->rows);
+  ASSERT_TRUE(block->DecodeValues(Metric::MemoryAvailable, values.data()));
+  EXPECT_EQ(values[0], 16.0);
+  EXPECT_EQ(history.Block(3), nullptr);
+}
+
+TEST(MetricHistoryTest, DropsBlocksThatAgeOut) {
+  MetricHistory history(20, 8);
+  for (int i = 0; i < 100; ++i) {
+    history.Append(1000 * i, WithCpu(i));
+  }
+
+  HistoryQuery query;
+  query.metrics = {Metric::CpuUsage};
+  auto window = history.Query(query);
+
+  EXPECT_EQ(history.Size(), 20u);
+  ASSERT_EQ(window.timestampsMs.size(), 20u);
+  EXPECT_EQ(window.timestampsMs.front(), 80000.0);
+  EXPECT_EQ(window.series[0].values.back(), 99.0);
+
+  auto stats = history.Stats();
+  EXPECT_EQ(stats.rows, 20u);
+  // Only the blocks still holding visible rows are kept
+  EXPECT_EQ(stats.sealedRows, 16u);
+  EXPECT_EQ(stats.blocks, 2u);
+  EXPECT_GT(stats.BytesPerValue(), 0.0);
+  EXPECT_LT(stats.BytesPerValue(), 8.0);
+}
@@ -0,0 +1,275 @@
+#include "MetricJournal.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+class MetricJournalTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    m_directory = std::filesystem::temp_directory_path() /
+        ("deviceai-journal-" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+    std::filesystem::remove_all(m_directory);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(m_directory);
+  }
+
+  // Row i has cpu usage i and time i seconds
+  static void AppendRows(MetricJournal &journal, int from, int to) {
+    for (int i = from; i < to; ++i) {
+      std::array<double, kMetricCount> row;
+      row.fill(std::numeric_limits<double>::quiet_NaN());
+      row[static_cast<size_t>(Metric::CpuUsage)] = i;
+      journal.Append(1000LL * i, row);
+    }
+  }
+
+  // Cpu usage of every restored row
+  static std::vector<double> Restored(MetricJournal const &journal) {
+    MetricHistory history(1 << 20);
+    journal.Restore(history);
+    HistoryQuery query;
+    query.metrics = {Metric::CpuUsage};
+    return history.Query(query).series[0].values;
+  }
+
+  static std::vector<double> Range(int from, int to) {
+    std::vector<double> values;
+    for (int i = from; i < to; ++i) {
+      values.push_back(i);
+    }
+    return values;
+  }
+
+  std::vector<std::filesystem::path> Segments() const {
+    std::vector<std::filesystem::path> paths;
+    for (auto const &entry : std::filesystem::directory_iterator(m_directory)) {
+      paths.push_back(entry.path());
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+  }
+
+  std::filesystem::path m_directory;
+};
+
+} // namespace
+
+TEST_F(MetricJournalTest, HistorySurvivesReopening) {
+  JournalConfig config;
+  config.blockRows = 60;
+  {
+    auto journal = MetricJournal::Open(m_directory, config);
+    ASSERT_NE(journal, nullptr);
+    AppendRows(*journal, 0, 150);
+    // Two full blocks written; the rest is written when the journal closes
+    EXPECT_EQ(journal->Stats().blocksWritten, 2u);
+  }
+
+  auto journal = MetricJournal::Open(m_directory, config);
+  ASSERT_NE(journal, nullptr);
+  EXPECT_EQ(Restored(*journal), Range(0, 150));
+  EXPECT_EQ(journal->Stats().truncatedBytes, 0u);
+
+  // Appending carries on in the same segment
+  AppendRows(*journal, 150, 200);
+  journal->Flush();
+  EXPECT_EQ(Restored(*journal), Range(0, 200));
+  EXPECT_EQ(journal->Stats().segments, 1u);
+
+  std::vector<int64_t> firsts;
+  journal->ForEachBlock(100'000, 160'000, [&](JournalBlock const &block) { firsts.push_back(block.firstMs); });
+  EXPECT_EQ(firsts, (std::vector<int64_t>{60'000, 120'000, 150'000}));
+}
+
+TEST_F(MetricJournalTest, RotatesSegmentsAndDropsExpiredOnes) {
+  JournalConfig config;
+  config.blockRows = 10;
+  config.sync = JournalSync::Never;
+  config.maxSegmentAgeMs = 30'000;
+  config.retentionMs = 60'000;
+  auto journal = MetricJournal::Open(m_directory, config);
+  ASSERT_NE(journal, nullptr);
+  AppendRows(*journal, 0, 200);
+
+  // Three blocks per segment; segments ending more than a minute before the newest row are gone
+  auto stats = journal->Stats();
+  EXPECT_EQ(stats.blocksWritten, 20u);
+  EXPECT_EQ(stats.segments, Segments().size());
+  EXPECT_LE(stats.segments, 4u);
+  auto restored = Restored(*journal);
+  ASSERT_FALSE(restored.empty());
+  EXPECT_EQ(restored.back(), 199.0);
+  EXPECT_LE(restored.front(), 199.0 - 60.0);
+}
+
+TEST_F(MetricJournalTest, TruncatesATornTailOnOpen) {
+  JournalConfig config;
+  config.blockRows = 20;
+  {
+    auto journal = MetricJournal::Open(m_directory, config);
+    AppendRows(*journal, 0, 60);
+  }
+
+  // Half of a fourth record, as if the process died mid-write
+  auto segment = Segments().front();
+  auto intactSize = std::filesystem::file_size(segment);
+  {
+    std::ifstream in(segment, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), {});
+    std::ofstream out(segment, std::ios::binary | std::ios::app);
+    out.write(bytes.data() + bytes.size() - 100, 50);
+  }
+
+  auto journal = MetricJournal::Open(m_directory, config);
+  ASSERT_NE(journal, nullptr);
+  EXPECT_EQ(journal->Stats().truncatedBytes, 50u);
+  EXPECT_EQ(std::filesystem::file_size(segment), intactSize);
+  EXPECT_EQ(Restored(*journal), Range(0, 60));
+
+  AppendRows(*journal, 60, 80);
+  journal->Flush();
+  EXPECT_EQ(Restored(*journal), Range(0, 80));
+}
+
+TEST_F(MetricJournalTest, ACorruptRecordEndsTheSegment) {
+  JournalConfig config;
+  config.blockRows = 20;
+  {
+    auto journal = MetricJournal::Open(m_directory, config);
+    AppendRows(*journal, 0, 60);
+  }
+
+  // Flip a bit in the middle of the file, inside the second record
+  auto segment = Segments().front();
+  auto size = std::filesystem::file_size(segment);
+  {
+    std::fstream file(segment, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekg(static_cast<std::streamoff>(size / 2));
+    char byte = 0;
+    file.read(&byte, 1);
+    byte ^= 0x10;
+    file.seekp(static_cast<std::streamoff>(size / 2));
+    file.write(&byte, 1);
+  }
+
+  auto journal = MetricJournal::Open(m_directory, config);
+  ASSERT_NE(journal, nullptr);
+  EXPECT_GT(journal->Stats().truncatedBytes, 0u);
+  EXPECT_EQ(Restored(*journal), Range(0, 20));
+}
+
+TEST_F(MetricJournalTest, ACorruptRowCountEndsTheSegment) {
+  JournalConfig config;
+  config.blockRows = 20;
+  {
+    auto journal = MetricJournal::Open(m_directory, config);
+    AppendRows(*journal, 0, 60);
+  }
+
+  // The high byte of the first record's row count, right after the segment
+  // header and the record magic
+  auto segment = Segments().front();
+  {
+    std::fstream file(segment, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(16 + 4 + 3);
+    char byte = 0x7F;
+    file.write(&byte, 1);
+  }
+
+  auto journal = MetricJournal::Open(m_directory, config);
+  ASSERT_NE(journal, nullptr);
+  EXPECT_GT(journal->Stats().truncatedBytes, 0u);
+  EXPECT_TRUE(Restored(*journal).empty());
+}
+
+TEST_F(MetricJournalTest, WritesPastAnUnreadableNewestSegment) {
+  JournalConfig config;
+  config.blockRows = 10;
+  // Every block starts a segment
+  config.maxSegmentBytes = 1;
+  {
+    auto journal = MetricJournal::Open(m_directory, config);
+    AppendRows(*journal, 0, 10);
+  }
+
+  // A newer segment from another format, left alone on open
+  auto garbage = m_directory / "segment-0000000002.dj";
+  {
+    std::ofstream out(garbage, std::ios::binary);
+    out << std::string(64, 'x');
+  }
+
+  auto journal = MetricJournal::Open(m_directory, config);
+  ASSERT_NE(journal, nullptr);
+  AppendRows(*journal, 10, 30);
+  journal->Flush();
+  EXPECT_EQ(journal->Stats().writeFailures, 0u);
+  EXPECT_EQ(Restored(*journal), Range(0, 30));
+  EXPECT_EQ(std::filesystem::file_size(garbage), 64u);
+  EXPECT_EQ(Segments().size(), 4u);
+}
+
+#if !defined(_WIN32)
+TEST_F(MetricJournalTest, SurvivesBeingKilledMidWrite) {
+  int ready[2];
+  ASSERT_EQ(pipe(ready), 0);
+
+  auto child = fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    // Writes and syncs small blocks as fast as it can until killed, reporting
+    // each durable row count
+    close(ready[0]);
+    JournalConfig config;
+    config.blockRows = 5;
+    config.sync = JournalSync::EveryBlock;
+    config.maxSegmentBytes = 16 * 1024;
+    auto journal = MetricJournal::Open(m_directory, config);
+    for (int i = 0;; i += 5) {
+      AppendRows(*journal, i, i + 5);
+      int32_t durable = i + 5;
+      if (write(ready[1], &durable, sizeof(durable)) != sizeof(durable)) {
+        _exit(1);
+      }
+    }
+  }
+
+  close(ready[1]);
+  int32_t durable = 0;
+  while (durable < 2000 && read(ready[0], &durable, sizeof(durable)) == sizeof(durable)) {
+  }
+  kill(child, SIGKILL);
+  int status = 0;
+  waitpid(child, &status, 0);
+  close(ready[0]);
+  ASSERT_TRUE(WIFSIGNALED(status));
+  ASSERT_GE(durable, 2000);
+
+  // Every row reported durable is back, in order and without gaps
+  auto journal = MetricJournal::Open(m_directory);
+  ASSERT_NE(journal, nullptr);
+  auto restored = Restored(*journal);
+  ASSERT_GE(restored.size(), static_cast<size_t>(durable));
+  EXPECT_EQ(restored, Range(0, static_cast<int>(restored.size())));
+  EXPECT_GT(journal->Stats().segments, 1u);
+}
+#endif
@@ -0,0 +1,137 @@
+#include "MetricQuery.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+constexpr int64_t kMinute = 60 * 1000;
+constexpr int64_t kHour = 60 * kMinute;
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+std::array<double, kMetricCount> Row(double cpu, double memory = kNaN) {
+  std::array<double, kMetricCount> row;
+  row.fill(kNaN);
+  row[static_cast<size_t>(Metric::CpuUsage)] = cpu;
+  row[static_cast<size_t>(Metric::MemoryAvailable)] = memory;
+  return row;
+}
+
+MetricQuery Query(Aggregation aggregation, int64_t stepMs, std::vector<Metric> metrics = {Metric::CpuUsage}) {
+  MetricQuery query;
+  query.metrics = std::move(metrics);
+  query.stepMs = stepMs;
+  query.aggregation = aggregation;
+  return query;
+}
+
+} // namespace
+
+TEST(MetricQueryTest, ParsesAggregationNames) {
+  EXPECT_EQ(ParseAggregation("p95"), Aggregation::P95);
+  EXPECT_EQ(ParseAggregation("rate"), Aggregation::Rate);
+  EXPECT_FALSE(ParseAggregation("median").has_value());
+  EXPECT_STREQ(ToString(Aggregation::Avg), "avg");
+}
+
+TEST(MetricQueryTest, AggregatesRawRowsPerBucket) {
+  MetricHistory history(1000, 16);
+  // 10 s buckets of 1 Hz rows: cpu 0..29, memory doubling it, a gap at 15
+  for (int i = 0; i < 30; ++i) {
+    history.Append(i * 1000, Row(i == 15 ? kNaN : i, 2.0 * i));
+  }
+
+  auto avg = RunQuery(history, Query(Aggregation::Avg, 10000, {Metric::CpuUsage, Metric::MemoryAvailable}));
+  ASSERT_TRUE(avg.has_value());
+  EXPECT_EQ(avg->sourceStepMs, 0);
+  EXPECT_EQ(avg->timestampsMs, (std::vector<double>{0, 10000, 20000}));
+  EXPECT_EQ(avg->series[0].values, (std::vector<double>{4.5, 130.0 / 9, 24.5}));
+  EXPECT_EQ(avg->series[1].values, (std::vector<double>{9, 29, 49}));
+
+  EXPECT_EQ(RunQuery(history, Query(Aggregation::Max, 10000))->series[0].values, (std::vector<double>{9, 19, 29}));
+  EXPECT_EQ(RunQuery(history, Query(Aggregation::Min, 10000))->series[0].values, (std::vector<double>{0, 10, 20}));
+  EXPECT_EQ(RunQuery(history, Query(Aggregation::Count, 10000))->series[0].values, (std::vector<double>{10, 9, 10}));
+  EXPECT_EQ(RunQuery(history, Query(Aggregation::Sum, 10000))->series[0].values, (std::vector<double>{45, 130, 245}));
+
+  // Exact, interpolated between ranks
+  EXPECT_EQ(RunQuery(history, Query(Aggregation::P50, 10000))->series[0].values, (std::vector<double>{4.5, 14, 24.5}));
+  EXPECT_DOUBLE_EQ(RunQuery(history, Query(Aggregation::P90, 10000))->series[0].values[0], 8.1);
+
+  // One unit per second, starting from the last sample of the bucket before
+  EXPECT_EQ(RunQuery(history, Query(Aggregation::Rate, 10000))->series[0].values, (std::vector<double>{1, 1, 1}));
+  EXPECT_EQ(RunQuery(history, Query(Aggregation::Rate, 1000))->series[0].values[1], 1);
+}
+
+TEST(MetricQueryTest, KeepsEmptyBucketsAndClampsTheRange) {
+  MetricHistory history(1000, 16);
+  history.Append(5000, Row(1));
+  history.Append(35000, Row(3));
+
+  auto query = Query(Aggregation::Avg, 10000);
+  auto result = RunQuery(history, query);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->timestampsMs, (std::vector<double>{0, 10000, 20000, 30000}));
+  EXPECT_EQ(result->series[0].values[0], 1);
+  EXPECT_TRUE(std::isnan(result->series[0].values[1]));
+  EXPECT_EQ(result->series[0].values[3], 3);
+
+  query.aggregation = Aggregation::Count;
+  EXPECT_EQ(RunQuery(history, query)->series[0].values, (std::vector<double>{1, 0, 0, 1}));
+
+  query.fromMs = 12000;
+  query.toMs = 25000;
+  EXPECT_EQ(RunQuery(history, query)->timestampsMs, (std::vector<double>{10000, 20000}));
+
+  query.stepMs = 0;
+  EXPECT_FALSE(RunQuery(history, query).has_value());
+
+  query.fromMs = 0;
+  query.toMs = std::numeric_limits<int64_t>::max();
+  query.stepMs = 1;
+  history.Append(int64_t(kMaxQueryBuckets) * 10, Row(4));
+  EXPECT_FALSE(RunQuery(history, query).has_value());
+
+  MetricHistory empty;
+  auto none = RunQuery(empty, Query(Aggregation::Avg, 10000));
+  ASSERT_TRUE(none.has_value());
+  EXPECT_TRUE(none->timestampsMs.empty());
+  EXPECT_TRUE(none->series[0].values.empty());
+}
+
+TEST(MetricQueryTest, ReadsCoarseStepsFromRollupTiers) {
+  MetricHistory history(120, 16);
+  // Three hours at one row per minute, cpu cycling 0..59 each hour
+  for (int i = 0; i < 180; ++i) {
+    history.Append(i * kMinute, Row(i % 60));
+  }
+
+  auto avg = RunQuery(history, Query(Aggregation::Avg, kHour));
+  ASSERT_TRUE(avg.has_value());
+  EXPECT_EQ(avg->sourceStepMs, kHour);
+  // The hour tier lags by the minute still filling
+  EXPECT_EQ(avg->series[0].values, (std::vector<double>{29.5, 29.5, 29}));
+
+  auto p95 = RunQuery(history, Query(Aggregation::P95, kHour));
+  EXPECT_NEAR(p95->series[0].values[0], 56.05, 1.0);
+
+  // Older than the raw rows kept, so minutes come from the first tier
+  auto max = RunQuery(history, Query(Aggregation::Max, 30 * kMinute));
+  EXPECT_EQ(max->sourceStepMs, kMinute);
+  EXPECT_EQ(max->series[0].values, (std::vector<double>{29, 59, 29, 59, 29, 59}));
+
+  // Finer than a minute but the raw rows don't reach back: still minutes
+  EXPECT_EQ(RunQuery(history, Query(Aggregation::Avg, 1000))->sourceStepMs, kMinute);
+
+  auto recent = Query(Aggregation::Avg, 1000);
+  recent.fromMs = 2 * kHour;
+  EXPECT_EQ(RunQuery(history, recent)->sourceStepMs, 0);
+
+  // Mean of each hour against the hour before; nothing before the first
+  auto rate = RunQuery(history, Query(Aggregation::Rate, kHour));
+  EXPECT_TRUE(std::isnan(rate->series[0].values[0]));
+  EXPECT_EQ(rate->series[0].values[1], 0);
+}
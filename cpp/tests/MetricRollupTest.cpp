@@ -0,0 +1,130 @@
+#include "MetricHistory.h"
+#include "MetricRollup.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+constexpr int64_t kMinute = 60 * 1000;
+constexpr int64_t kHour = 60 * kMinute;
+
+std::array<double, kMetricCount> Row(double cpu) {
+  std::array<double, kMetricCount> row;
+  row.fill(std::numeric_limits<double>::quiet_NaN());
+  row[static_cast<size_t>(Metric::CpuUsage)] = cpu;
+  return row;
+}
+
+DeviceSnapshot WithCpu(double usage) {
+  DeviceSnapshot snapshot;
+  snapshot[Metric::CpuUsage] = {usage, ValueState::Live, 0};
+  return snapshot;
+}
+
+} // namespace
+
+TEST(MetricRollupTest, AggregatesEachMinute) {
+  MetricRollup rollup;
+  // Two minutes at 1 Hz: 0..59 then 100..159
+  for (int i = 0; i < 120; ++i) {
+    rollup.Add(i * 1000, Row(i < 60 ? i : i + 40));
+  }
+
+  RollupQuery query;
+  query.metrics = {Metric::CpuUsage, Metric::MemoryTotal};
+  query.quantiles = {0.5, 0.95};
+  auto window = rollup.Query(0, query);
+
+  EXPECT_EQ(window.stepMs, kMinute);
+  EXPECT_EQ(window.timestampsMs, (std::vector<double>{0, 60000}));
+  auto const &cpu = window.series[0];
+  EXPECT_EQ(cpu.min, (std::vector<double>{0, 100}));
+  EXPECT_EQ(cpu.max, (std::vector<double>{59, 159}));
+  EXPECT_EQ(cpu.mean, (std::vector<double>{29.5, 129.5}));
+  EXPECT_EQ(cpu.count, (std::vector<uint32_t>{60, 60}));
+  EXPECT_NEAR(cpu.quantiles[0][0], 29.0, 0.5);
+  EXPECT_NEAR(cpu.quantiles[1][1], 156.0, 1.6);
+
+  // A metric that was never live has empty buckets
+  EXPECT_EQ(window.series[1].count, (std::vector<uint32_t>{0, 0}));
+  EXPECT_TRUE(std::isnan(window.series[1].mean[0]));
+}
+
+TEST(MetricRollupTest, HoursAreMergedFromClosedMinutes) {
+  MetricRollup rollup;
+  for (int64_t t = 0; t <= 2 * kHour; t += 10 * 1000) {
+    rollup.Add(t, Row(t < kHour ? 10.0 : 30.0));
+  }
+
+  RollupQuery query;
+  query.metrics = {Metric::CpuUsage};
+  auto hours = rollup.Query(1, query);
+
+  // The second hour has every minute; the third only gets its first minute
+  // once that minute closes
+  ASSERT_EQ(hours.timestampsMs, (std::vector<double>{0, static_cast<double>(kHour)}));
+  EXPECT_EQ(hours.series[0].count, (std::vector<uint32_t>{360, 360}));
+  EXPECT_EQ(hours.series[0].mean, (std::vector<double>{10.0, 30.0}));
+  EXPECT_EQ(rollup.Buckets(0), 121u);
+}
+
+TEST(MetricRollupTest, KeepsTheNewestBucketsPerTier) {
+  RollupTierConfig tiers[] = {{1000, 5}};
+  MetricRollup rollup(tiers);
+  for (int i = 0; i < 10; ++i) {
+    rollup.Add(i * 1000, Row(i));
+  }
+
+  EXPECT_EQ(rollup.Buckets(0), 5u);
+  EXPECT_EQ(rollup.OldestMs(0), 5000);
+  EXPECT_TRUE(rollup.Covers(0, 5000));
+  EXPECT_FALSE(rollup.Covers(0, 4999));
+
+  RollupQuery query;
+  query.metrics = {Metric::CpuUsage};
+  query.fromMs = 6500;
+  query.toMs = 8000;
+  EXPECT_EQ(rollup.Query(0, query).timestampsMs, (std::vector<double>{6000, 7000, 8000}));
+}
+
+TEST(MetricRollupTest, HistoryPicksTheCheapestTierThatCoversTheRange) {
+  // An hour of raw rows, then minutes and hours
+  MetricHistory history(3600, 256);
+  for (int64_t t = 0; t < 3 * kHour; t += 1000) {
+    history.Append(t, WithCpu(static_cast<double>(t % kMinute) / 1000.0));
+  }
+
+  RollupQuery query;
+  query.metrics = {Metric::CpuUsage};
+
+  // Last ten minutes at full resolution: raw rows
+  query.fromMs = 3 * kHour - 10 * kMinute;
+  query.maxPoints = 600;
+  auto recent = history.Rollup(query);
+  EXPECT_EQ(recent.stepMs, 0);
+  EXPECT_EQ(recent.timestampsMs.size(), 600u);
+  EXPECT_EQ(recent.series[0].count.front(), 1u);
+
+  // The same ten minutes in five points: minutes
+  query.maxPoints = 5;
+  EXPECT_EQ(history.Rollup(query).stepMs, kMinute);
+
+  // Full resolution over two hours ago is no longer raw: minutes
+  query.fromMs = kHour / 2;
+  query.toMs = kHour;
+  query.maxPoints = 0;
+  auto older = history.Rollup(query);
+  EXPECT_EQ(older.stepMs, kMinute);
+  EXPECT_EQ(older.series[0].max.front(), 59.0);
+
+  // Everything in two points: hours
+  query.fromMs = std::numeric_limits<int64_t>::min();
+  query.toMs = std::numeric_limits<int64_t>::max();
+  query.maxPoints = 2;
+  EXPECT_EQ(history.Rollup(query).stepMs, kHour);
+}
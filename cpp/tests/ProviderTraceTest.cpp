@@ -0,0 +1,218 @@
+#include "FakePlatformProvider.h"
+#include "ProviderTrace.h"
+#include "RecordingProvider.h"
+#include "ReplayProvider.h"
+#include "SnapshotAssembler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+std::vector<uint8_t> Bytes(std::ostringstream const &out) {
+  auto text = out.str();
+  return {text.begin(), text.end()};
+}
+
+class ThrowingProvider final : public PlatformProvider {
+public:
+  const char *Name() const noexcept override {
+    return "throwing";
+  }
+  MemoryReading ReadMemory() override {
+    throw std::runtime_error("unavailable");
+  }
+  StorageReading ReadStorage() override {
+    return {};
+  }
+  BatteryReading ReadBattery() override {
+    return {};
+  }
+  CpuReading ReadCpu() override {
+    return {};
+  }
+  NetworkReading ReadNetwork() override {
+    return {};
+  }
+  CounterReading ReadPerformanceCounters() override {
+    return {};
+  }
+  WmiReading ReadWmi() override {
+    return {};
+  }
+  IdentityReading ReadIdentity() override {
+    return {};
+  }
+};
+
+} // namespace
+
+TEST(ProviderTraceTest, RoundTripsReadingsAndSources) {
+  std::ostringstream out;
+  ProviderTraceWriter writer(out, "win32");
+
+  MemoryReading memory;
+  memory.total = {17179869184.0, "GlobalMemoryStatusEx"};
+  memory.available = {std::nullopt, "GlobalMemoryStatusEx"};
+  writer.Write(100, 20, memory);
+
+  NetworkReading network;
+  network.type = {std::string("wifi"), "NetworkInformation"};
+  network.connected = {false, "NetworkInformation"};
+  writer.Write(90, 5, network);
+
+  BatteryReading battery;
+  battery.level = {55.5, nullptr};
+  writer.Write(300, 1, battery);
+
+  auto trace = ProviderTrace::Decode(Bytes(out));
+  ASSERT_TRUE(trace.has_value());
+  EXPECT_EQ(trace->provider, "win32");
+  EXPECT_GT(trace->startUnixMs, 0);
+  EXPECT_FALSE(trace->truncated);
+  EXPECT_EQ(trace->Size(), 3u);
+  EXPECT_EQ(trace->DurationUs(), 301 - 90);
+
+  ASSERT_EQ(trace->memory.size(), 1u);
+  EXPECT_EQ(trace->memory[0].atUs, 100);
+  EXPECT_EQ(trace->memory[0].durationUs, 20);
+  EXPECT_EQ(trace->memory[0].reading.total.value, 17179869184.0);
+  EXPECT_STREQ(trace->memory[0].reading.total.source, "GlobalMemoryStatusEx");
+  EXPECT_FALSE(trace->memory[0].reading.available.value.has_value());
+  EXPECT_STREQ(trace->memory[0].reading.available.source, "GlobalMemoryStatusEx");
+
+  // Written after a later-starting read, so its start is a negative delta
+  ASSERT_EQ(trace->network.size(), 1u);
+  EXPECT_EQ(trace->network[0].atUs, 90);
+  EXPECT_EQ(trace->network[0].reading.type.value, "wifi");
+  EXPECT_EQ(trace->network[0].reading.connected.value, false);
+
+  ASSERT_EQ(trace->battery.size(), 1u);
+  EXPECT_EQ(trace->battery[0].reading.level.value, 55.5);
+  EXPECT_EQ(trace->battery[0].reading.level.source, nullptr);
+  EXPECT_FALSE(trace->battery[0].reading.charging.value.has_value());
+}
+
+TEST(ProviderTraceTest, KeepsCompleteRecordsOfATruncatedTrace) {
+  std::ostringstream out;
+  ProviderTraceWriter writer(out, "fake");
+  CpuReading cpu;
+  cpu.usage = {42.0, "PDH"};
+  cpu.cores = {8.0, "GetSystemInfo"};
+  writer.Write(0, 1, cpu);
+  writer.Write(1000, 1, cpu);
+
+  auto bytes = Bytes(out);
+  bytes.resize(bytes.size() - 3);
+  auto trace = ProviderTrace::Decode(bytes);
+  ASSERT_TRUE(trace.has_value());
+  EXPECT_TRUE(trace->truncated);
+  ASSERT_EQ(trace->cpu.size(), 1u);
+  EXPECT_EQ(trace->cpu[0].reading.usage.value, 42.0);
+}
+
+TEST(ProviderTraceTest, RejectsUnknownHeader) {
+  std::vector<uint8_t> bytes = {'N', 'O', 'P', 'E', 1, 0, 0};
+  EXPECT_FALSE(ProviderTrace::Decode(bytes).has_value());
+  EXPECT_FALSE(ProviderTrace::Decode({}).has_value());
+}
+
+TEST(ProviderTraceTest, RecordingAThrowingReadRecordsAFailure) {
+  std::ostringstream out;
+  ProviderTraceWriter writer(out, "throwing");
+  ThrowingProvider inner;
+  RecordingProvider recording(inner, writer);
+
+  EXPECT_THROW(recording.ReadMemory(), std::runtime_error);
+  EXPECT_EQ(writer.Records(), 1u);
+
+  auto trace = ProviderTrace::Decode(Bytes(out));
+  ASSERT_TRUE(trace.has_value());
+  ASSERT_EQ(trace->memory.size(), 1u);
+  EXPECT_FALSE(trace->memory[0].reading.total.value.has_value());
+}
+
+TEST(ProviderTraceTest, ReplayReproducesRecordedSnapshots) {
+  std::ostringstream out;
+  FakePlatformProvider fake;
+  fake.SetFailing(Collector::Storage, true);
+  std::vector<DeviceSnapshot> recorded;
+  {
+    ProviderTraceWriter writer(out, fake.Name());
+    RecordingProvider recording(fake, writer);
+    SpanRecorder spans;
+    SnapshotAssembler assembler(recording, spans);
+    for (int64_t i = 0; i < 5; ++i) {
+      recorded.push_back(assembler.Assemble(i * 1000));
+    }
+  }
+
+  auto trace = ProviderTrace::Decode(Bytes(out));
+  ASSERT_TRUE(trace.has_value());
+  EXPECT_EQ(trace->provider, "fake");
+  EXPECT_EQ(trace->cpu.size(), 5u);
+
+  ReplayProvider replay(std::move(*trace));
+  SpanRecorder spans;
+  SnapshotAssembler assembler(replay, spans);
+  for (int64_t i = 0; i < 5; ++i) {
+    auto snapshot = assembler.Assemble(i * 1000);
+    EXPECT_EQ(std::memcmp(&snapshot, &recorded[i], sizeof(DeviceSnapshot)), 0) << "snapshot " << i;
+  }
+  EXPECT_TRUE(replay.Finished());
+  EXPECT_EQ(spans.Snapshot(Span::Storage).failures, 5u);
+
+  // Past the end of the trace every collector fails
+  auto after = assembler.Assemble(5000);
+  EXPECT_EQ(after[Metric::CpuUsage].state, ValueState::LastKnown);
+}
+
+TEST(ProviderTraceTest, LoopingReplayStartsOver) {
+  ProviderTrace trace;
+  for (int i = 0; i < 3; ++i) {
+    CpuReading cpu;
+    cpu.usage = {static_cast<double>(i), "PDH"};
+    trace.cpu.push_back({i * 1000, 10, cpu});
+  }
+
+  ReplayOptions options;
+  options.loop = true;
+  ReplayProvider replay(std::move(trace), options);
+  std::vector<double> usage;
+  for (int i = 0; i < 7; ++i) {
+    usage.push_back(*replay.ReadCpu().usage.value);
+  }
+  EXPECT_EQ(usage, (std::vector<double>{0, 1, 2, 0, 1, 2, 0}));
+  EXPECT_FALSE(replay.Finished());
+  // A collector with nothing recorded fails
+  EXPECT_FALSE(replay.ReadMemory().total.value.has_value());
+}
+
+TEST(ProviderTraceTest, AcceleratedReplayKeepsRecordedSpacing) {
+  ProviderTrace trace;
+  for (int i = 0; i < 3; ++i) {
+    MemoryReading memory;
+    memory.total = {1.0, "test"};
+    trace.memory.push_back({1'000'000 + i * 200'000, 0, memory});
+  }
+
+  // 400 ms of recording at 20x is 20 ms
+  ReplayOptions options;
+  options.speed = 20.0;
+  ReplayProvider replay(std::move(trace), options);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 3; ++i) {
+    replay.ReadMemory();
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_GE(elapsed, std::chrono::milliseconds(19));
+  EXPECT_LT(elapsed, std::chrono::milliseconds(400));
+}
@@ -0,0 +1,140 @@
+#include "QuantileSketch.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+double Exact(std::vector<double> sorted, double q) {
+  std::sort(sorted.begin(), sorted.end());
+  return sorted[static_cast<size_t>(q * static_cast<double>(sorted.size() - 1))];
+}
+
+} // namespace
+
+TEST(QuantileSketchTest, QuantilesAreWithinRelativeAccuracy) {
+  std::mt19937 random(3);
+  std::lognormal_distribution<double> distribution(3.0, 1.5);
+  QuantileSketch sketch;
+  std::vector<double> values;
+  for (int i = 0; i < 20000; ++i) {
+    values.push_back(distribution(random));
+    sketch.Add(values.back());
+  }
+
+  EXPECT_EQ(sketch.Count(), values.size());
+  for (double q : {0.0, 0.5, 0.9, 0.95, 0.99, 1.0}) {
+    auto exact = Exact(values, q);
+    EXPECT_NEAR(sketch.Quantile(q), exact, exact * QuantileSketch::kRelativeAccuracy) << "q=" << q;
+  }
+}
+
+TEST(QuantileSketchTest, MergingMatchesOneSketchOfEverything) {
+  QuantileSketch all;
+  QuantileSketch first;
+  QuantileSketch second;
+  for (int i = 1; i <= 1000; ++i) {
+    all.Add(i);
+    (i % 3 == 0 ? first : second).Add(i);
+  }
+  first.Merge(second);
+
+  EXPECT_EQ(first.Count(), all.Count());
+  EXPECT_EQ(first.Buckets(), all.Buckets());
+  for (double q : {0.01, 0.25, 0.5, 0.75, 0.99}) {
+    EXPECT_EQ(first.Quantile(q), all.Quantile(q));
+  }
+}
+
+TEST(QuantileSketchTest, HandlesZeroNegativesAndNaN) {
+  QuantileSketch sketch;
+  EXPECT_TRUE(std::isnan(sketch.Quantile(0.5)));
+
+  sketch.Add(-100.0);
+  sketch.Add(0.0, 2);
+  sketch.Add(std::nan(""));
+  sketch.Add(50.0);
+
+  EXPECT_EQ(sketch.Count(), 4u);
+  EXPECT_NEAR(sketch.Quantile(0.0), -100.0, 1.0);
+  EXPECT_EQ(sketch.Quantile(0.5), 0.0);
+  EXPECT_NEAR(sketch.Quantile(1.0), 50.0, 0.5);
+}
+
+TEST(QuantileSketchTest, EncodingRoundTrips) {
+  QuantileSketch sketch;
+  for (int i = -50; i <= 500; ++i) {
+    sketch.Add(i * 0.37, 1 + static_cast<uint32_t>(i & 3));
+  }
+  std::vector<uint8_t> bytes;
+  sketch.Encode(bytes);
+
+  auto decoded = QuantileSketch::Decode(bytes);
+  ASSERT_TRUE(decoded.has_value());
+  EXPECT_EQ(decoded->Count(), sketch.Count());
+  EXPECT_EQ(decoded->Buckets(), sketch.Buckets());
+  for (double q : {0.0, 0.1, 0.5, 0.9, 1.0}) {
+    EXPECT_EQ(decoded->Quantile(q), sketch.Quantile(q));
+  }
+
+  // Truncated, trailing bytes, another version
+  EXPECT_FALSE(QuantileSketch::Decode(std::span(bytes).first(bytes.size() - 1)).has_value());
+  auto longer = bytes;
+  longer.push_back(0);
+  EXPECT_FALSE(QuantileSketch::Decode(longer).has_value());
+  bytes[0] = 9;
+  EXPECT_FALSE(QuantileSketch::Decode(bytes).has_value());
+}
+
+TEST(QuantileSketchTest, SketchSetsMergeByName) {
+  std::vector<NamedSketch> first{{"cpu", {}}, {"wmi", {}}};
+  std::vector<NamedSketch> second{{"cpu", {}}};
+  for (int i = 1; i <= 100; ++i) {
+    first[0].sketch.Add(i);
+    first[1].sketch.Add(1000.0 + i);
+    second[0].sketch.Add(100.0 + i);
+  }
+
+  auto bytes = EncodeSketchSet(first);
+  auto decoded = DecodeSketchSet(bytes);
+  ASSERT_TRUE(decoded.has_value());
+  ASSERT_EQ(decoded->size(), 2u);
+  EXPECT_EQ((*decoded)[1].name, "wmi");
+
+  auto other = DecodeSketchSet(EncodeSketchSet(second));
+  ASSERT_TRUE(other.has_value());
+  (*decoded)[0].sketch.Merge((*other)[0].sketch);
+  EXPECT_EQ((*decoded)[0].sketch.Count(), 200u);
+  EXPECT_NEAR((*decoded)[0].sketch.Quantile(0.5), 100.0, 1.0);
+
+  // Any flipped bit fails the checksum
+  bytes[bytes.size() / 2] ^= 0x10;
+  EXPECT_FALSE(DecodeSketchSet(bytes).has_value());
+  EXPECT_FALSE(DecodeSketchSet({}).has_value());
+}
+
+TEST(QuantileSketchTest, CollapsesSmallestValuesPastTheBucketLimit) {
+  QuantileSketch sketch;
+  // 1e-6 up to about 1e18: more buckets than the limit
+  std::vector<double> values;
+  for (double value = 1e-6; value < 1e18; value *= 1.015) {
+    values.push_back(value);
+    sketch.Add(value);
+  }
+  ASSERT_GT(values.size(), QuantileSketch::kMaxBuckets);
+
+  EXPECT_EQ(sketch.Buckets(), QuantileSketch::kMaxBuckets);
+  EXPECT_EQ(sketch.Count(), values.size());
+  // The tail keeps its accuracy; the smallest values are what gave way
+  for (double q : {0.5, 0.95, 0.99, 1.0}) {
+    auto exact = Exact(values, q);
+    EXPECT_NEAR(sketch.Quantile(q), exact, exact * QuantileSketch::kRelativeAccuracy) << "q=" << q;
+  }
+  EXPECT_GT(sketch.Quantile(0.0), values.front() * 2);
+}
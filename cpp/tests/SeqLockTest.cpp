@@ -0,0 +1,152 @@
+#include "SeqLock.h"
+#include "SnapshotPublisher.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+struct Triple {
+  uint32_t a = 0;
+  uint32_t b = 0;
+  uint32_t c = 0;
+};
+
+// Every field of the snapshot derived from one stamp, so a reader can tell
+// whether what it copied came from a single publish
+DeviceSnapshot Stamped(uint64_t stamp) {
+  DeviceSnapshot snapshot;
+  snapshot.sequence = stamp;
+  snapshot.timestampMs = static_cast<int64_t>(stamp);
+  for (auto &metric : snapshot.metrics) {
+    metric = {static_cast<double>(stamp), ValueState::Live, static_cast<int64_t>(stamp)};
+  }
+  std::string text(stamp % TextValue::kCapacity, static_cast<char>('a' + stamp % 26));
+  for (auto &field : snapshot.texts) {
+    field.Assign(text);
+    field.ageMs = static_cast<int64_t>(stamp);
+  }
+  for (auto &section : snapshot.sections) {
+    section.ageMs = static_cast<int64_t>(stamp);
+  }
+  return snapshot;
+}
+
+bool IsStamped(DeviceSnapshot const &snapshot) {
+  auto stamp = snapshot.sequence;
+  if (stamp == 0) {
+    return snapshot.metrics[0].state == ValueState::Unknown;
+  }
+  // Field by field: padding bytes are indeterminate, so the snapshots can't
+  // be compared as a whole
+  auto expected = Stamped(stamp);
+  if (snapshot.timestampMs != expected.timestampMs) {
+    return false;
+  }
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    auto const &metric = snapshot.metrics[i];
+    auto const &want = expected.metrics[i];
+    if (metric.value != want.value || metric.state != want.state || metric.ageMs != want.ageMs) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < kTextFieldCount; ++i) {
+    auto const &text = snapshot.texts[i];
+    auto const &want = expected.texts[i];
+    if (text.View() != want.View() || text.state != want.state || text.ageMs != want.ageMs) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < kCollectorCount; ++i) {
+    auto const &section = snapshot.sections[i];
+    auto const &want = expected.sections[i];
+    if (section.state != want.state || section.ageMs != want.ageMs) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+TEST(SeqLockTest, ValuesThatAreNotWholeWordsRoundTrip) {
+  SeqLock<Triple> lock(Triple{1, 2, 3});
+  EXPECT_EQ(lock.Stores(), 0u);
+
+  lock.Store(Triple{4, 5, 6});
+  auto value = lock.Load();
+  EXPECT_EQ(value.a, 4u);
+  EXPECT_EQ(value.b, 5u);
+  EXPECT_EQ(value.c, 6u);
+  EXPECT_EQ(lock.Stores(), 1u);
+
+  // A member straddling no word boundary, and one in the last partial word
+  uint32_t b = 0;
+  lock.LoadBytes(offsetof(Triple, b), sizeof(b), &b);
+  EXPECT_EQ(b, 5u);
+  uint32_t c = 0;
+  lock.LoadBytes(offsetof(Triple, c), sizeof(c), &c);
+  EXPECT_EQ(c, 6u);
+}
+
+TEST(SeqLockTest, ReadersNeverSeeAMixOfTwoPublishes) {
+  constexpr int kReaders = 4;
+  constexpr uint64_t kPublishes = 20000;
+
+  SnapshotPublisher publisher;
+  std::atomic<bool> done{false};
+  std::atomic<uint64_t> torn{0};
+  std::atomic<uint64_t> reads{0};
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < kReaders; ++r) {
+    readers.emplace_back([&, r] {
+      uint64_t lastSequence = 0;
+      uint64_t count = 0;
+      while (!done.load(std::memory_order_relaxed)) {
+        if (r % 2 == 0) {
+          // Whole snapshots
+          auto snapshot = publisher.Latest();
+          if (!IsStamped(snapshot) || snapshot.sequence < lastSequence) {
+            torn.fetch_add(1);
+          }
+          lastSequence = snapshot.sequence;
+        } else {
+          // Single fields, which must each still come from one publish
+          auto metric = publisher.Read(Metric::CounterDiskUsage);
+          auto text = publisher.Read(TextField::Architecture);
+          if (static_cast<int64_t>(metric.value) != metric.ageMs || text.length != static_cast<uint64_t>(text.ageMs) % TextValue::kCapacity) {
+            torn.fetch_add(1);
+          }
+        }
+        ++count;
+      }
+      reads.fetch_add(count);
+    });
+  }
+
+  for (uint64_t stamp = 1; stamp <= kPublishes; ++stamp) {
+    publisher.Publish(Stamped(stamp));
+    if (stamp % 64 == 0) {
+      // Let readers run between publishes even on a single core
+      std::this_thread::yield();
+    }
+  }
+  done = true;
+  for (auto &reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(torn.load(), 0u);
+  EXPECT_GT(reads.load(), 0u);
+  EXPECT_TRUE(IsStamped(publisher.Latest()));
+  EXPECT_EQ(publisher.Sequence(), kPublishes);
+  EXPECT_EQ(publisher.Publishes(), kPublishes);
+}
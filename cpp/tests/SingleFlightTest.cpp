@@ -0,0 +1,138 @@
+#include "SingleFlight.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <latch>
+#include <thread>
+
+using namespace ReactNativeDeviceAiCore;
+
+TEST(SingleFlightTest, ConcurrentCallersShareOneCollection) {
+  VirtualClock clock;
+  SingleFlight<int> flight(1000, clock);
+
+  std::vector<int> results;
+  auto waiter = [&](std::optional<int> const &value) { results.push_back(value.value_or(-1)); };
+
+  EXPECT_TRUE(flight.Join(waiter));
+  EXPECT_FALSE(flight.Join(waiter));
+  EXPECT_FALSE(flight.Join(waiter));
+  EXPECT_TRUE(results.empty());
+
+  flight.Complete(42);
+
+  EXPECT_EQ(results, (std::vector<int>{42, 42, 42}));
+  auto stats = flight.Stats();
+  EXPECT_EQ(stats.collections, 1u);
+  EXPECT_EQ(stats.coalesced, 2u);
+}
+
+TEST(SingleFlightTest, FreshResultAnswersInline) {
+  VirtualClock clock;
+  SingleFlight<int> flight(1000, clock);
+  int result = 0;
+  auto waiter = [&](std::optional<int> const &value) { result = value.value_or(-1); };
+
+  ASSERT_TRUE(flight.Join(waiter));
+  flight.Complete(7);
+
+  clock.Advance(1000);
+  result = 0;
+  EXPECT_FALSE(flight.Join(waiter));
+  EXPECT_EQ(result, 7);
+
+  clock.Advance(1);
+  EXPECT_TRUE(flight.Join(waiter));
+  flight.Complete(8);
+  EXPECT_EQ(result, 8);
+  EXPECT_EQ(flight.Stats().cacheHits, 1u);
+}
+
+TEST(SingleFlightTest, FailuresAreNotCached) {
+  VirtualClock clock;
+  SingleFlight<int> flight(1000, clock);
+  std::optional<int> result = 0;
+  auto waiter = [&](std::optional<int> const &value) { result = value; };
+
+  ASSERT_TRUE(flight.Join(waiter));
+  flight.Complete(std::nullopt);
+  EXPECT_FALSE(result);
+
+  EXPECT_TRUE(flight.Join(waiter));
+  flight.Complete(3);
+  EXPECT_EQ(result, 3);
+  EXPECT_EQ(flight.Stats().failures, 1u);
+}
+
+TEST(SingleFlightTest, ZeroWindowStillCoalescesInFlight) {
+  VirtualClock clock;
+  SingleFlight<int> flight(0, clock);
+  auto waiter = [](std::optional<int> const &) {};
+
+  ASSERT_TRUE(flight.Join(waiter));
+  EXPECT_FALSE(flight.Join(waiter));
+  flight.Complete(1);
+
+  clock.Advance(1);
+  EXPECT_TRUE(flight.Join(waiter));
+  flight.Complete(2);
+  EXPECT_EQ(flight.Stats().collections, 2u);
+}
+
+TEST(SingleFlightTest, ThreadedCallersAllResolve) {
+  SingleFlight<int> flight(0);
+  constexpr int kCallers = 32;
+  std::atomic<int> resolved{0};
+  std::atomic<int> leaders{0};
+  std::latch start(kCallers);
+  std::vector<std::thread> leaderThreads;
+  std::mutex leaderMutex;
+
+  std::vector<std::thread> callers;
+  for (int i = 0; i < kCallers; ++i) {
+    callers.emplace_back([&] {
+      start.arrive_and_wait();
+      if (flight.Join([&](std::optional<int> const &value) {
+            if (value == 5) {
+              resolved.fetch_add(1);
+            }
+          })) {
+        leaders.fetch_add(1);
+        std::lock_guard lock(leaderMutex);
+        leaderThreads.emplace_back([&] {
+          std::this_thread::sleep_for(std::chrono::milliseconds(5));
+          flight.Complete(5);
+        });
+      }
+    });
+  }
+  for (auto &caller : callers) {
+    caller.join();
+  }
+  for (auto &leader : leaderThreads) {
+    leader.join();
+  }
+
+  EXPECT_EQ(resolved.load(), kCallers);
+  EXPECT_EQ(static_cast<int>(flight.Stats().collections), leaders.load());
+  EXPECT_LT(leaders.load(), kCallers);
+}
+
+TEST(SingleFlightTest, WaiterCanStartNextFlight) {
+  VirtualClock clock;
+  SingleFlight<int> flight(0, clock);
+  bool rejoined = false;
+  int second = 0;
+
+  ASSERT_TRUE(flight.Join([&](std::optional<int> const &) {
+    clock.Advance(1);
+    rejoined = flight.Join([&](std::optional<int> const &value) { second = value.value_or(-1); });
+  }));
+  flight.Complete(1);
+
+  ASSERT_TRUE(rejoined);
+  flight.Complete(2);
+  EXPECT_EQ(second, 2);
+  flight.WaitIdle();
+}
@@ -0,0 +1,92 @@
+#include "FakePlatformProvider.h"
+#include "SnapshotAssembler.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace ReactNativeDeviceAiCore;
+
+TEST(SnapshotAssemblerTest, AssemblesEveryFieldLive) {
+  FakePlatformProvider provider;
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+
+  auto snapshot = assembler.Assemble(1000);
+
+  EXPECT_EQ(snapshot.sequence, 1u);
+  EXPECT_EQ(snapshot.timestampMs, 1000);
+  for (auto const &metric : snapshot.metrics) {
+    EXPECT_EQ(metric.state, ValueState::Live);
+  }
+  for (auto const &text : snapshot.texts) {
+    EXPECT_EQ(text.state, ValueState::Live);
+  }
+  EXPECT_EQ(snapshot[Metric::CpuCores].value, 8.0);
+  EXPECT_EQ(snapshot[Metric::BatteryCharging].value, 1.0);
+  EXPECT_EQ(snapshot[TextField::NetworkType].View(), "wifi");
+  EXPECT_EQ(snapshot.Section(Collector::Wmi).state, ValueState::Live);
+  EXPECT_EQ(spans.Snapshot(Span::Cpu).calls, 1u);
+}
+
+TEST(SnapshotAssemblerTest, FailedCollectorFallsBackToLastKnownValues) {
+  FakePlatformProvider provider;
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+
+  DeviceSnapshot first;
+  ASSERT_TRUE(assembler.Collect(Collector::Storage, first, 1000));
+
+  provider.SetFailing(Collector::Storage, true);
+  DeviceSnapshot second;
+  EXPECT_FALSE(assembler.Collect(Collector::Storage, second, 4000));
+
+  EXPECT_EQ(second[Metric::StorageTotal].state, ValueState::LastKnown);
+  EXPECT_EQ(second[Metric::StorageTotal].value, first[Metric::StorageTotal].value);
+  EXPECT_EQ(second[Metric::StorageTotal].ageMs, 3000);
+  EXPECT_EQ(second.Section(Collector::Storage).state, ValueState::LastKnown);
+  EXPECT_EQ(second.Section(Collector::Storage).ageMs, 3000);
+
+  auto stats = spans.Snapshot(Span::Storage);
+  EXPECT_EQ(stats.failures, 1u);
+  EXPECT_EQ(stats.fallbacks, 1u);
+}
+
+TEST(SnapshotAssemblerTest, NeverReadFieldsStayUnknown) {
+  FakePlatformProvider provider;
+  provider.SetFailing(Collector::Wmi, true);
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+
+  DeviceSnapshot snapshot;
+  EXPECT_FALSE(assembler.Collect(Collector::Wmi, snapshot, 0));
+
+  EXPECT_EQ(snapshot[TextField::WmiProcessor].state, ValueState::Unknown);
+  EXPECT_TRUE(snapshot[TextField::WmiProcessor].View().empty());
+  EXPECT_EQ(snapshot.Section(Collector::Wmi).state, ValueState::Unknown);
+}
+
+TEST(SnapshotAssemblerTest, FallbackStatsNameEveryField) {
+  FakePlatformProvider provider;
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  assembler.Assemble(0);
+
+  auto stats = assembler.FallbackStats(0);
+
+  ASSERT_EQ(stats.size(), kMetricCount + kTextFieldCount);
+  EXPECT_STREQ(stats[0].name, "memory.total");
+  EXPECT_STREQ(stats[0].source, FakePlatformProvider::kSource);
+  EXPECT_EQ(stats[0].live, 1u);
+}
+
+TEST(SnapshotAssemblerTest, LongTextIsCutAtCodePointBoundary) {
+  TextValue text;
+  // 'é' is two bytes in UTF-8, so the capacity lands inside the last one
+  std::string value(TextValue::kCapacity - 1, 'a');
+  value += "\xC3\xA9";
+
+  text.Assign(value);
+
+  EXPECT_EQ(text.View(), std::string(TextValue::kCapacity - 1, 'a'));
+}
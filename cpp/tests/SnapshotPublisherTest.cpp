@@ -0,0 +1,67 @@
+#include "FakePlatformProvider.h"
+#include "SnapshotAssembler.h"
+#include "SnapshotPublisher.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace ReactNativeDeviceAiCore;
+
+TEST(SnapshotPublisherTest, EverythingIsUnknownBeforeTheFirstPublish) {
+  SnapshotPublisher publisher;
+
+  EXPECT_EQ(publisher.Publishes(), 0u);
+  EXPECT_EQ(publisher.Sequence(), 0u);
+  EXPECT_EQ(publisher.Read(Metric::CpuUsage).state, ValueState::Unknown);
+  EXPECT_EQ(publisher.Read(TextField::OsVersion).length, 0);
+  EXPECT_EQ(publisher.Latest().Section(Collector::Memory).state, ValueState::Unknown);
+}
+
+TEST(SnapshotPublisherTest, ReadsBackThePublishedSnapshot) {
+  FakePlatformProvider provider;
+  SpanRecorder spans;
+  SnapshotAssembler assembler(provider, spans);
+  SnapshotPublisher publisher;
+
+  auto snapshot = assembler.Assemble(1000);
+  publisher.Publish(snapshot);
+
+  auto latest = publisher.Latest();
+  EXPECT_EQ(std::memcmp(&latest, &snapshot, sizeof(DeviceSnapshot)), 0);
+  EXPECT_EQ(publisher.Publishes(), 1u);
+  EXPECT_EQ(publisher.Sequence(), snapshot.sequence);
+  EXPECT_EQ(publisher.TimestampMs(), 1000);
+
+  // Field reads cover exactly their own bytes
+  for (size_t i = 0; i < kMetricCount; ++i) {
+    auto metric = static_cast<Metric>(i);
+    EXPECT_EQ(publisher.Read(metric).value, snapshot[metric].value) << ToString(metric);
+    EXPECT_EQ(publisher.Read(metric).state, ValueState::Live) << ToString(metric);
+  }
+  for (size_t i = 0; i < kTextFieldCount; ++i) {
+    auto field = static_cast<TextField>(i);
+    EXPECT_EQ(publisher.Read(field).View(), snapshot[field].View()) << ToString(field);
+  }
+  EXPECT_EQ(publisher.Read(Collector::Cpu).state, ValueState::Live);
+}
+
+TEST(SnapshotPublisherTest, LaterPublishReplacesEveryField) {
+  SnapshotPublisher publisher;
+  DeviceSnapshot first;
+  first.sequence = 1;
+  first[Metric::CpuUsage] = {10.0, ValueState::Live, 0};
+  first[TextField::NetworkType].Assign("ethernet");
+  publisher.Publish(first);
+
+  DeviceSnapshot second;
+  second.sequence = 2;
+  second[Metric::CpuUsage] = {20.0, ValueState::LastKnown, 500};
+  publisher.Publish(second);
+
+  EXPECT_EQ(publisher.Sequence(), 2u);
+  EXPECT_EQ(publisher.Read(Metric::CpuUsage).value, 20.0);
+  EXPECT_EQ(publisher.Read(Metric::CpuUsage).ageMs, 500);
+  EXPECT_TRUE(publisher.Read(TextField::NetworkType).View().empty());
+  EXPECT_EQ(publisher.Publishes(), 2u);
+}
@@ -0,0 +1,25 @@
+#include "StringConversion.h"
+
+#include <gtest/gtest.h>
+
+using namespace ReactNativeDeviceAiCore;
+
+TEST(StringConversionTest, ConvertsAsciiAndMultiByteCharacters) {
+  EXPECT_EQ(Utf16ToUtf8(u"Intel(R) Core(TM)"), "Intel(R) Core(TM)");
+  EXPECT_EQ(Utf16ToUtf8(u"Café €"), "Caf\xC3\xA9 \xE2\x82\xAC");
+}
+
+TEST(StringConversionTest, JoinsSurrogatePairs) {
+  // U+1F600 is D83D DE00 in UTF-16
+  EXPECT_EQ(Utf16ToUtf8(u"\U0001F600"), "\xF0\x9F\x98\x80");
+}
+
+TEST(StringConversionTest, ReplacesUnpairedSurrogates) {
+  std::u16string text = {u'a', static_cast<char16_t>(0xD800), u'b'};
+  EXPECT_EQ(Utf16ToUtf8(text), "a\xEF\xBF\xBD" "b");
+}
+
+TEST(StringConversionTest, WideStringsMatchUtf16) {
+  EXPECT_EQ(WideToUtf8(L"Café \U0001F600"), "Caf\xC3\xA9 \xF0\x9F\x98\x80");
+  EXPECT_EQ(WideToUtf8(L""), "");
+}
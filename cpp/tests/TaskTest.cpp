@@ -0,0 +1,103 @@
+#include "Task.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <deque>
+#include <thread>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+// Single worker thread draining posted coroutines, standing in for the thread pool.
+class WorkerExecutor final : public Executor {
+public:
+  WorkerExecutor() : m_thread([this] { Run(); }) {}
+
+  ~WorkerExecutor() override {
+    {
+      std::lock_guard lock(m_mutex);
+      m_stopping = true;
+    }
+    m_wake.notify_all();
+    m_thread.join();
+  }
+
+  void Post(std::coroutine_handle<> handle) noexcept override {
+    {
+      std::lock_guard lock(m_mutex);
+      m_queue.push_back(handle);
+    }
+    m_wake.notify_one();
+  }
+
+  std::thread::id Id() const noexcept {
+    return m_thread.get_id();
+  }
+
+private:
+  void Run() {
+    std::unique_lock lock(m_mutex);
+    while (true) {
+      m_wake.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+      if (m_queue.empty()) {
+        return;
+      }
+      auto handle = m_queue.front();
+      m_queue.pop_front();
+      lock.unlock();
+      handle.resume();
+      lock.lock();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::deque<std::coroutine_handle<>> m_queue;
+  bool m_stopping = false;
+  std::thread m_thread;
+};
+
+} // namespace
+
+TEST(TaskTest, ScheduleOnResumesOnExecutor) {
+  WorkerExecutor executor;
+  std::thread::id resumedOn;
+
+  {
+    AsyncScope scope;
+    auto body = [&](AsyncScope::Token) -> FireAndForget {
+      co_await ScheduleOn(executor);
+      resumedOn = std::this_thread::get_id();
+    };
+    body(scope.Enter());
+  }
+
+  EXPECT_EQ(resumedOn, executor.Id());
+  EXPECT_NE(executor.Id(), std::this_thread::get_id());
+}
+
+TEST(TaskTest, FireAndForgetReleasesCallerImmediately) {
+  WorkerExecutor executor;
+  std::mutex gate;
+  std::unique_lock hold(gate);
+  std::atomic<bool> finished{false};
+
+  {
+    AsyncScope scope;
+    auto body = [&](AsyncScope::Token) -> FireAndForget {
+      co_await ScheduleOn(executor);
+      std::lock_guard wait(gate);
+      finished = true;
+    };
+    body(scope.Enter());
+
+    // The caller is back while the body is still blocked on the worker
+    EXPECT_FALSE(finished);
+    hold.unlock();
+  }
+
+  // Leaving the scope waited for the detached coroutine
+  EXPECT_TRUE(finished);
+}
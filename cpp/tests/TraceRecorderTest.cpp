@@ -0,0 +1,133 @@
+#include "SpanRecorder.h"
+#include "TraceRecorder.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+#if DEVICEAI_TRACING
+
+TEST(TraceRecorderTest, DisabledRecorderDropsEvents) {
+  TraceRecorder recorder;
+  recorder.Complete("wmi", 0, 10, TraceStatus::Ok);
+  EXPECT_TRUE(recorder.Events().empty());
+}
+
+TEST(TraceRecorderTest, EventsKeepTheirThread) {
+  TraceRecorder recorder;
+  recorder.SetEnabled(true);
+  recorder.Complete("memory", 1000, 500, TraceStatus::Ok);
+
+  std::thread worker([&] { recorder.Complete("wmi.connect", 2000, 7000, TraceStatus::Failed); });
+  worker.join();
+
+  auto events = recorder.Events();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_STREQ(events[0].name, "memory");
+  EXPECT_STREQ(events[1].name, "wmi.connect");
+  EXPECT_NE(events[0].threadId, events[1].threadId);
+  EXPECT_EQ(events[1].status, TraceStatus::Failed);
+}
+
+TEST(TraceRecorderTest, FullBufferKeepsNewestEvents) {
+  TraceRecorder recorder;
+  recorder.SetEnabled(true);
+  auto total = static_cast<int64_t>(TraceRecorder::kEventsPerThread) + 10;
+  for (int64_t i = 0; i < total; ++i) {
+    recorder.Complete("cpu", i, 1, TraceStatus::Ok);
+  }
+
+  auto events = recorder.Events();
+  // The slot the writer would reuse next is never reported
+  ASSERT_EQ(events.size(), TraceRecorder::kEventsPerThread - 1);
+  EXPECT_EQ(events.front().startNs, 11);
+  EXPECT_EQ(events.back().startNs, total - 1);
+
+  recorder.Clear();
+  EXPECT_TRUE(recorder.Events().empty());
+}
+
+TEST(TraceRecorderTest, ChromeJsonHasCompleteEvents) {
+  TraceRecorder recorder;
+  recorder.SetEnabled(true);
+  recorder.Complete("pdh.query", 1500, 2500, TraceStatus::Fallback);
+
+  auto json = recorder.ToChromeJson();
+  EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"pdh.query\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(json.find("\"ts\":1.500"), std::string::npos);
+  EXPECT_NE(json.find("\"dur\":2.500"), std::string::npos);
+  EXPECT_NE(json.find("\"status\":\"fallback\""), std::string::npos);
+
+  auto path = testing::TempDir() + "deviceai_trace.json";
+  ASSERT_TRUE(recorder.WriteChromeJson(path));
+  std::ifstream file(path);
+  std::string written((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  EXPECT_EQ(written, json);
+  std::remove(path.c_str());
+}
+
+TEST(TraceRecorderTest, ConcurrentWritersWhileReading) {
+  TraceRecorder recorder;
+  recorder.SetEnabled(true);
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 4; ++t) {
+    writers.emplace_back([&] {
+      for (int64_t i = 0; !stop.load(); ++i) {
+        recorder.Complete("storage", i, i, TraceStatus::Ok);
+      }
+    });
+  }
+
+  for (int round = 0; round < 50; ++round) {
+    for (auto const &event : recorder.Events()) {
+      // A torn slot would pair a start with another event's duration
+      ASSERT_EQ(event.startNs, event.durationNs);
+    }
+  }
+  stop = true;
+  for (auto &writer : writers) {
+    writer.join();
+  }
+}
+
+TEST(TraceRecorderTest, ScopedSpanTracesIntoProcessRecorder) {
+  auto &trace = TraceRecorder::Instance();
+  trace.Clear();
+  trace.SetEnabled(true);
+  SpanRecorder spans;
+  {
+    ScopedSpan span(spans, Span::Battery);
+    span.Fallback();
+  }
+  trace.SetEnabled(false);
+  {
+    ScopedSpan span(spans, Span::Battery);
+  }
+
+  auto events = trace.Events();
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_STREQ(events[0].name, "battery");
+  EXPECT_EQ(events[0].status, TraceStatus::Fallback);
+  trace.Clear();
+}
+
+#else
+
+TEST(TraceRecorderTest, CompiledOutRecorderStaysDisabled) {
+  TraceRecorder recorder;
+  recorder.SetEnabled(true);
+  EXPECT_FALSE(recorder.Enabled());
+  recorder.Complete("wmi", 0, 10, TraceStatus::Ok);
+  EXPECT_TRUE(recorder.Events().empty());
+}
+
+#endif
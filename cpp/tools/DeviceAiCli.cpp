@@ -0,0 +1,472 @@
+// Runs the native collectors without a React Native host and prints each
+// snapshot as a JSON line or CSV row, with how long every collector took. A
+// per-collector latency summary goes to stderr at exit. With --count 0 it runs
+// until interrupted, which makes it a convenient target for perf or VTune.
+// --record saves every raw provider read to a trace that --provider replay
+// plays back, at recorded speed or faster with --speed. --sketches writes
+// each collector's latency distribution as mergeable quantile sketches, which
+// SketchMerge combines across runs and machines.
+//
+//   DeviceAiCli [--provider linux|fake|replay] [--collectors memory,cpu,...|all] [--count N]
+//               [--interval-ms MS] [--format json|csv] [--fake-latency-us US]
+//               [--record PATH] [--trace PATH] [--speed X] [--loop] [--sketches PATH]
+
+#include "DeviceSnapshot.h"
+#include "FakePlatformProvider.h"
+#include "ProviderTrace.h"
+#include "QuantileSketch.h"
+#include "RecordingProvider.h"
+#include "ReplayProvider.h"
+#include "SnapshotAssembler.h"
+#include "SpanRecorder.h"
+#if defined(__linux__)
+#include "LinuxPlatformProvider.h"
+#endif
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+enum class Format { Json, Csv };
+
+struct Options {
+#if defined(__linux__)
+  std::string provider = "linux";
+#else
+  std::string provider = "fake";
+#endif
+  std::vector<Collector> collectors;
+  bool identity = true;
+  int count = 1;
+  int intervalMs = 1000;
+  Format format = Format::Json;
+  int fakeLatencyUs = 0;
+  std::string recordPath;
+  std::string tracePath;
+  double speed = 0.0;
+  bool loop = false;
+  std::string sketchPath;
+};
+
+volatile std::sig_atomic_t g_interrupted = 0;
+
+bool ParseCollectors(std::string_view list, Options &options) {
+  options.collectors.clear();
+  options.identity = false;
+  while (!list.empty()) {
+    auto comma = list.find(',');
+    auto name = list.substr(0, comma);
+    list = comma == std::string_view::npos ? std::string_view() : list.substr(comma + 1);
+
+    if (name == "all") {
+      for (size_t i = 0; i < kCollectorCount; ++i) {
+        options.collectors.push_back(static_cast<Collector>(i));
+      }
+      options.identity = true;
+      continue;
+    }
+    if (name == "identity") {
+      options.identity = true;
+      continue;
+    }
+    bool found = false;
+    for (size_t i = 0; i < kCollectorCount; ++i) {
+      if (name == ToString(static_cast<Collector>(i))) {
+        options.collectors.push_back(static_cast<Collector>(i));
+        found = true;
+      }
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return !options.collectors.empty() || options.identity;
+}
+
+bool ParseOptions(int argc, char **argv, Options &options) {
+  ParseCollectors("all", options);
+  for (int i = 1; i < argc; ++i) {
+    auto next = [&]() -> char const * {
+      return i + 1 < argc ? argv[++i] : nullptr;
+    };
+    char const *value = nullptr;
+
+    if (std::strcmp(argv[i], "--provider") == 0) {
+      if (!(value = next())) return false;
+      options.provider = value;
+    } else if (std::strcmp(argv[i], "--collectors") == 0) {
+      if (!(value = next()) || !ParseCollectors(value, options)) return false;
+    } else if (std::strcmp(argv[i], "--count") == 0) {
+      if (!(value = next())) return false;
+      options.count = std::atoi(value);
+    } else if (std::strcmp(argv[i], "--interval-ms") == 0) {
+      if (!(value = next())) return false;
+      options.intervalMs = std::atoi(value);
+    } else if (std::strcmp(argv[i], "--format") == 0) {
+      if (!(value = next())) return false;
+      if (std::strcmp(value, "json") == 0) {
+        options.format = Format::Json;
+      } else if (std::strcmp(value, "csv") == 0) {
+        options.format = Format::Csv;
+      } else {
+        return false;
+      }
+    } else if (std::strcmp(argv[i], "--fake-latency-us") == 0) {
+      if (!(value = next())) return false;
+      options.fakeLatencyUs = std::atoi(value);
+    } else if (std::strcmp(argv[i], "--record") == 0) {
+      if (!(value = next())) return false;
+      options.recordPath = value;
+    } else if (std::strcmp(argv[i], "--trace") == 0) {
+      if (!(value = next())) return false;
+      options.tracePath = value;
+    } else if (std::strcmp(argv[i], "--speed") == 0) {
+      if (!(value = next())) return false;
+      options.speed = std::atof(value);
+    } else if (std::strcmp(argv[i], "--loop") == 0) {
+      options.loop = true;
+    } else if (std::strcmp(argv[i], "--sketches") == 0) {
+      if (!(value = next())) return false;
+      options.sketchPath = value;
+    } else {
+      return false;
+    }
+  }
+  if (options.provider == "replay" && options.tracePath.empty()) {
+    return false;
+  }
+  return options.count >= 0 && options.intervalMs >= 0 && options.fakeLatencyUs >= 0 && options.speed >= 0.0;
+}
+
+std::unique_ptr<PlatformProvider> MakeProvider(Options const &options) {
+  if (options.provider == "fake") {
+    auto provider = std::make_unique<FakePlatformProvider>();
+    for (size_t i = 0; i < kCollectorCount; ++i) {
+      provider->SetLatency(static_cast<Collector>(i), std::chrono::microseconds(options.fakeLatencyUs));
+    }
+    return provider;
+  }
+  if (options.provider == "replay") {
+    auto trace = ProviderTrace::Load(options.tracePath);
+    if (!trace) {
+      std::fprintf(stderr, "cannot read trace: %s\n", options.tracePath.c_str());
+      return nullptr;
+    }
+    if (trace->truncated) {
+      std::fprintf(stderr, "trace ends in a partial record; replaying the %zu complete reads\n", trace->Size());
+    }
+    ReplayOptions replay;
+    replay.speed = options.speed;
+    replay.loop = options.loop;
+    replay.replayLatency = options.speed > 0.0;
+    return std::make_unique<ReplayProvider>(std::move(*trace), replay);
+  }
+#if defined(__linux__)
+  if (options.provider == "linux") {
+    return std::make_unique<LinuxPlatformProvider>();
+  }
+#endif
+  std::fprintf(stderr, "unknown provider: %s\n", options.provider.c_str());
+  return nullptr;
+}
+
+bool IsFlag(Metric metric) noexcept {
+  return metric == Metric::BatteryCharging || metric == Metric::NetworkConnected;
+}
+
+void AppendNumber(std::string &out, double value) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+  out += buffer;
+}
+
+void AppendJsonString(std::string &out, std::string_view text) {
+  out += '"';
+  for (auto c : text) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buffer[8];
+      std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+      out += buffer;
+    } else {
+      out += c;
+    }
+  }
+  out += '"';
+}
+
+void AppendJsonMetric(std::string &out, MetricValue const &value, Metric metric) {
+  if (value.state == ValueState::Unknown) {
+    out += "null";
+  } else if (IsFlag(metric)) {
+    out += value.value != 0.0 ? "true" : "false";
+  } else {
+    AppendNumber(out, value.value);
+  }
+}
+
+void AppendJsonText(std::string &out, TextValue const &text) {
+  if (text.state == ValueState::Unknown) {
+    out += "null";
+  } else {
+    AppendJsonString(out, text.View());
+  }
+}
+
+constexpr TextField kIdentityFields[] = {TextField::OsVersion, TextField::BuildNumber, TextField::Processor, TextField::Architecture};
+
+std::string ToJson(Options const &options, char const *provider, DeviceSnapshot const &snapshot, std::vector<double> const &durationsMs) {
+  std::string out = "{\"sequence\":";
+  AppendNumber(out, static_cast<double>(snapshot.sequence));
+  out += ",\"timestampMs\":";
+  AppendNumber(out, static_cast<double>(snapshot.timestampMs));
+  out += ",\"provider\":";
+  AppendJsonString(out, provider);
+  out += ",\"collectors\":{";
+  for (size_t i = 0; i < options.collectors.size(); ++i) {
+    auto collector = options.collectors[i];
+    auto const &section = snapshot.Section(collector);
+    if (i > 0) {
+      out += ',';
+    }
+    AppendJsonString(out, ToString(collector));
+    out += ":{\"state\":";
+    AppendJsonString(out, ToString(section.state));
+    out += ",\"ageMs\":";
+    AppendNumber(out, static_cast<double>(section.ageMs));
+    out += ",\"durationMs\":";
+    AppendNumber(out, durationsMs[i]);
+    for (auto metric : MetricsOf(collector)) {
+      out += ',';
+      AppendJsonString(out, ShortName(metric));
+      out += ':';
+      AppendJsonMetric(out, snapshot[metric], metric);
+    }
+    for (auto field : TextsOf(collector)) {
+      out += ',';
+      AppendJsonString(out, ShortName(field));
+      out += ':';
+      AppendJsonText(out, snapshot[field]);
+    }
+    out += '}';
+  }
+  out += '}';
+  if (options.identity) {
+    out += ",\"identity\":{";
+    bool first = true;
+    for (auto field : kIdentityFields) {
+      if (!first) {
+        out += ',';
+      }
+      first = false;
+      AppendJsonString(out, ToString(field));
+      out += ':';
+      AppendJsonText(out, snapshot[field]);
+    }
+    out += '}';
+  }
+  out += '}';
+  return out;
+}
+
+void AppendCsvText(std::string &out, std::string_view text) {
+  out += '"';
+  for (auto c : text) {
+    if (c == '"') {
+      out += '"';
+    }
+    out += c;
+  }
+  out += '"';
+}
+
+std::string CsvHeader(Options const &options) {
+  std::string out = "sequence,timestampMs";
+  for (auto collector : options.collectors) {
+    out += ',';
+    out += ToString(collector);
+    out += ".state,";
+    out += ToString(collector);
+    out += ".durationMs";
+    for (auto metric : MetricsOf(collector)) {
+      out += ',';
+      out += ToString(metric);
+    }
+    for (auto field : TextsOf(collector)) {
+      out += ',';
+      out += ToString(field);
+    }
+  }
+  if (options.identity) {
+    for (auto field : kIdentityFields) {
+      out += ',';
+      out += ToString(field);
+    }
+  }
+  return out;
+}
+
+// Unknown fields are left empty
+std::string ToCsv(Options const &options, DeviceSnapshot const &snapshot, std::vector<double> const &durationsMs) {
+  std::string out;
+  AppendNumber(out, static_cast<double>(snapshot.sequence));
+  out += ',';
+  AppendNumber(out, static_cast<double>(snapshot.timestampMs));
+  for (size_t i = 0; i < options.collectors.size(); ++i) {
+    auto collector = options.collectors[i];
+    out += ',';
+    out += ToString(snapshot.Section(collector).state);
+    out += ',';
+    AppendNumber(out, durationsMs[i]);
+    for (auto metric : MetricsOf(collector)) {
+      out += ',';
+      if (snapshot[metric].state != ValueState::Unknown) {
+        AppendNumber(out, snapshot[metric].value);
+      }
+    }
+    for (auto field : TextsOf(collector)) {
+      out += ',';
+      if (snapshot[field].state != ValueState::Unknown) {
+        AppendCsvText(out, snapshot[field].View());
+      }
+    }
+  }
+  if (options.identity) {
+    for (auto field : kIdentityFields) {
+      out += ',';
+      if (snapshot[field].state != ValueState::Unknown) {
+        AppendCsvText(out, snapshot[field].View());
+      }
+    }
+  }
+  return out;
+}
+
+void PrintSummary(Options const &options, SpanRecorder const &spans) {
+  constexpr double kNsPerMs = 1e6;
+  std::fprintf(stderr, "%-20s %8s %8s %10s %10s %10s\n", "collector", "calls", "failures", "p50 ms", "p99 ms", "max ms");
+  for (auto collector : options.collectors) {
+    auto stats = spans.Snapshot(SpanOf(collector));
+    std::fprintf(stderr, "%-20s %8llu %8llu %10.3f %10.3f %10.3f\n", ToString(collector),
+        static_cast<unsigned long long>(stats.calls), static_cast<unsigned long long>(stats.failures),
+        static_cast<double>(stats.latency.p50Ns) / kNsPerMs, static_cast<double>(stats.latency.p99Ns) / kNsPerMs,
+        static_cast<double>(stats.latency.maxNs) / kNsPerMs);
+  }
+}
+
+bool WriteSketches(Options const &options, SpanRecorder const &spans) {
+  std::vector<NamedSketch> sketches;
+  for (auto collector : options.collectors) {
+    sketches.push_back(NamedSketch{ToString(collector), spans.LatencySketch(SpanOf(collector))});
+  }
+  auto bytes = EncodeSketchSet(sketches);
+  std::ofstream file(options.sketchPath, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<char const *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  return static_cast<bool>(file);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!ParseOptions(argc, argv, options)) {
+    std::fprintf(stderr,
+        "usage: %s [--provider linux|fake|replay] [--collectors memory,storage,battery,cpu,network,performanceCounters,wmi,identity|all]\n"
+        "          [--count N (0 = until interrupted)] [--interval-ms MS] [--format json|csv] [--fake-latency-us US]\n"
+        "          [--record PATH] [--trace PATH (with --provider replay)] [--speed X (0 = unpaced)] [--loop]\n"
+        "          [--sketches PATH]\n",
+        argv[0]);
+    return 2;
+  }
+
+  auto provider = MakeProvider(options);
+  if (!provider) {
+    return 2;
+  }
+  // A replayed trace brings its own timing, so rounds are not spaced out
+  auto *replay = dynamic_cast<ReplayProvider *>(provider.get());
+
+  std::ofstream recordFile;
+  std::unique_ptr<ProviderTraceWriter> writer;
+  std::unique_ptr<RecordingProvider> recording;
+  if (!options.recordPath.empty()) {
+    recordFile.open(options.recordPath, std::ios::binary | std::ios::trunc);
+    if (!recordFile) {
+      std::fprintf(stderr, "cannot write trace: %s\n", options.recordPath.c_str());
+      return 2;
+    }
+    writer = std::make_unique<ProviderTraceWriter>(recordFile, provider->Name());
+    recording = std::make_unique<RecordingProvider>(*provider, *writer);
+  }
+  PlatformProvider &source = recording ? static_cast<PlatformProvider &>(*recording) : *provider;
+
+  std::signal(SIGINT, [](int) { g_interrupted = 1; });
+  std::signal(SIGTERM, [](int) { g_interrupted = 1; });
+
+  SpanRecorder spans;
+  SnapshotAssembler assembler(source, spans);
+  auto const &clock = SteadyClock::Instance();
+  if (options.format == Format::Csv) {
+    std::puts(CsvHeader(options).c_str());
+  }
+
+  auto next = std::chrono::steady_clock::now();
+  std::vector<double> durationsMs(options.collectors.size());
+  for (uint64_t sequence = 1; !g_interrupted && (options.count == 0 || sequence <= static_cast<uint64_t>(options.count)); ++sequence) {
+    DeviceSnapshot snapshot;
+    snapshot.sequence = sequence;
+    snapshot.timestampMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    for (size_t i = 0; i < options.collectors.size(); ++i) {
+      auto begin = std::chrono::steady_clock::now();
+      assembler.Collect(options.collectors[i], snapshot, clock.NowMs());
+      durationsMs[i] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    }
+    if (options.identity) {
+      assembler.CollectIdentity(snapshot, clock.NowMs());
+    }
+
+    auto line = options.format == Format::Json ? ToJson(options, provider->Name(), snapshot, durationsMs)
+                                               : ToCsv(options, snapshot, durationsMs);
+    std::puts(line.c_str());
+    std::fflush(stdout);
+    if (replay && replay->Finished()) {
+      break;
+    }
+
+    // Fixed rate: a slow round shortens the following wait instead of shifting every later one
+    next += std::chrono::milliseconds(options.intervalMs);
+    if (!replay && (options.count == 0 || sequence < static_cast<uint64_t>(options.count))) {
+      while (!g_interrupted && std::chrono::steady_clock::now() < next) {
+        std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(next - std::chrono::steady_clock::now(),
+            std::chrono::milliseconds(100)));
+      }
+    }
+  }
+
+  PrintSummary(options, spans);
+  if (!options.sketchPath.empty() && !WriteSketches(options, spans)) {
+    std::fprintf(stderr, "cannot write sketches: %s\n", options.sketchPath.c_str());
+    return 1;
+  }
+  if (writer) {
+    recordFile.flush();
+    std::fprintf(stderr, "recorded %llu reads, %llu bytes, to %s\n", static_cast<unsigned long long>(writer->Records()),
+        static_cast<unsigned long long>(writer->BytesWritten()), options.recordPath.c_str());
+  }
+  return 0;
+}
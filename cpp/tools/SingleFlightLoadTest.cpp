@@ -0,0 +1,148 @@
+// Fires bursts of concurrent requests at a stub collector and reports how many
+// collections ran and the caller latency distribution, with and without
+// single-flight coalescing.
+//
+//   SingleFlightLoadTest [--callers N] [--rounds R] [--latency-ms L] [--freshness-ms F] [--no-coalesce]
+
+#include "SingleFlight.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+struct Options {
+  int callers = 64;
+  int rounds = 20;
+  int latencyMs = 50;
+  int freshnessMs = 0;
+  bool coalesce = true;
+};
+
+bool ParseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    auto next = [&](int &out) {
+      if (i + 1 >= argc) {
+        return false;
+      }
+      out = std::atoi(argv[++i]);
+      return true;
+    };
+
+    if (std::strcmp(argv[i], "--callers") == 0) {
+      if (!next(options.callers)) return false;
+    } else if (std::strcmp(argv[i], "--rounds") == 0) {
+      if (!next(options.rounds)) return false;
+    } else if (std::strcmp(argv[i], "--latency-ms") == 0) {
+      if (!next(options.latencyMs)) return false;
+    } else if (std::strcmp(argv[i], "--freshness-ms") == 0) {
+      if (!next(options.freshnessMs)) return false;
+    } else if (std::strcmp(argv[i], "--no-coalesce") == 0) {
+      options.coalesce = false;
+    } else {
+      return false;
+    }
+  }
+  return options.callers > 0 && options.rounds > 0 && options.latencyMs >= 0;
+}
+
+// Stands in for the WMI/PDH work behind getDeviceInfo.
+struct StubCollector {
+  int latencyMs;
+  std::atomic<uint64_t> collections{0};
+
+  int Collect() {
+    collections.fetch_add(1, std::memory_order_relaxed);
+    std::this_thread::sleep_for(std::chrono::milliseconds(latencyMs));
+    return 1;
+  }
+};
+
+double Percentile(std::vector<double> &sorted, double p) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  auto index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+  return sorted[std::min(index, sorted.size() - 1)];
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!ParseOptions(argc, argv, options)) {
+    std::fprintf(stderr,
+        "usage: %s [--callers N] [--rounds R] [--latency-ms L] [--freshness-ms F] [--no-coalesce]\n", argv[0]);
+    return 2;
+  }
+
+  StubCollector collector{options.latencyMs};
+  SingleFlight<int> flight(options.freshnessMs);
+  std::mutex latencyMutex;
+  std::vector<double> latenciesMs;
+  latenciesMs.reserve(static_cast<size_t>(options.callers) * options.rounds);
+
+  for (int round = 0; round < options.rounds; ++round) {
+    std::latch start(options.callers);
+    std::latch done(options.callers);
+    std::vector<std::thread> threads;
+    std::vector<std::thread> leaders(options.callers);
+
+    for (int caller = 0; caller < options.callers; ++caller) {
+      threads.emplace_back([&, caller] {
+        start.arrive_and_wait();
+        auto begin = std::chrono::steady_clock::now();
+        auto record = [&, begin](std::optional<int> const &) {
+          std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - begin;
+          {
+            std::lock_guard lock(latencyMutex);
+            latenciesMs.push_back(elapsed.count());
+          }
+          done.count_down();
+        };
+
+        if (!options.coalesce) {
+          record(collector.Collect());
+          return;
+        }
+
+        // The leader collects on its own thread, as the module does on the thread pool
+        if (flight.Join(record)) {
+          leaders[caller] = std::thread([&] { flight.Complete(collector.Collect()); });
+        }
+      });
+    }
+
+    done.wait();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    for (auto &leader : leaders) {
+      if (leader.joinable()) {
+        leader.join();
+      }
+    }
+  }
+
+  std::sort(latenciesMs.begin(), latenciesMs.end());
+  auto stats = flight.Stats();
+  std::printf("mode:          %s\n", options.coalesce ? "single-flight" : "uncoalesced");
+  std::printf("calls:         %zu\n", latenciesMs.size());
+  std::printf("collections:   %llu\n", static_cast<unsigned long long>(collector.collections.load()));
+  std::printf("coalesced:     %llu\n", static_cast<unsigned long long>(stats.coalesced));
+  std::printf("cache hits:    %llu\n", static_cast<unsigned long long>(stats.cacheHits));
+  std::printf("p50 latency:   %.2f ms\n", Percentile(latenciesMs, 0.50));
+  std::printf("p99 latency:   %.2f ms\n", Percentile(latenciesMs, 0.99));
+  std::printf("max latency:   %.2f ms\n", latenciesMs.empty() ? 0.0 : latenciesMs.back());
+  return 0;
+}
@@ -0,0 +1,79 @@
+// Merges quantile sketch files, such as those DeviceAiCli --sketches writes
+// on many machines or runs, by name, and prints each merged distribution.
+// With --out the merged set is also written back as one file, so merging can
+// be done in stages. Exits non-zero on an unreadable or corrupt file.
+//
+//   SketchMerge [--out PATH] FILE...
+
+#include "QuantileSketch.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+std::vector<uint8_t> ReadFile(char const *path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  char const *outPath = nullptr;
+  std::vector<char const *> inputs;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      outPath = argv[++i];
+    } else {
+      inputs.push_back(argv[i]);
+    }
+  }
+  if (inputs.empty()) {
+    std::fprintf(stderr, "usage: %s [--out PATH] FILE...\n", argv[0]);
+    return 2;
+  }
+
+  // In order of first appearance
+  std::vector<NamedSketch> merged;
+  for (auto const *path : inputs) {
+    auto sketches = DecodeSketchSet(ReadFile(path));
+    if (!sketches) {
+      std::fprintf(stderr, "not a readable sketch file: %s\n", path);
+      return 1;
+    }
+    for (auto &entry : *sketches) {
+      auto found = std::find_if(merged.begin(), merged.end(), [&](NamedSketch const &existing) { return existing.name == entry.name; });
+      if (found == merged.end()) {
+        merged.push_back(std::move(entry));
+      } else {
+        found->sketch.Merge(entry.sketch);
+      }
+    }
+  }
+
+  std::printf("%-20s %10s %10s %10s %10s %10s\n", "name", "count", "p50", "p90", "p95", "p99");
+  for (auto const &entry : merged) {
+    auto const &sketch = entry.sketch;
+    std::printf("%-20s %10llu %10.3f %10.3f %10.3f %10.3f\n", entry.name.c_str(), static_cast<unsigned long long>(sketch.Count()),
+        sketch.Quantile(0.5), sketch.Quantile(0.9), sketch.Quantile(0.95), sketch.Quantile(0.99));
+  }
+
+  if (outPath) {
+    auto bytes = EncodeSketchSet(merged);
+    std::ofstream file(outPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<char const *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+      std::fprintf(stderr, "cannot write %s\n", outPath);
+      return 1;
+    }
+  }
+  return 0;
+}
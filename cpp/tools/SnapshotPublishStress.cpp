@@ -0,0 +1,150 @@
+// Hammers a SnapshotPublisher with reader threads while one writer publishes
+// as fast as it can (or at a fixed interval), checking that every snapshot a
+// reader copies comes from a single publish, and reports read throughput.
+// --field-reads makes readers copy one metric instead of the whole snapshot,
+// as the JSI getters do. Exits non-zero on any inconsistent read.
+//
+//   SnapshotPublishStress [--readers N] [--duration-ms D] [--publish-interval-us U] [--field-reads]
+
+#include "SnapshotPublisher.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+struct Options {
+  int readers = 4;
+  int durationMs = 2000;
+  int publishIntervalUs = 0;
+  bool fieldReads = false;
+};
+
+bool ParseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    auto next = [&](int &out) {
+      if (i + 1 >= argc) {
+        return false;
+      }
+      out = std::atoi(argv[++i]);
+      return true;
+    };
+
+    if (std::strcmp(argv[i], "--readers") == 0) {
+      if (!next(options.readers)) return false;
+    } else if (std::strcmp(argv[i], "--duration-ms") == 0) {
+      if (!next(options.durationMs)) return false;
+    } else if (std::strcmp(argv[i], "--publish-interval-us") == 0) {
+      if (!next(options.publishIntervalUs)) return false;
+    } else if (std::strcmp(argv[i], "--field-reads") == 0) {
+      options.fieldReads = true;
+    } else {
+      return false;
+    }
+  }
+  return options.readers > 0 && options.durationMs > 0 && options.publishIntervalUs >= 0;
+}
+
+// Every field derived from one stamp, so a torn copy shows up as a mismatch
+DeviceSnapshot Stamped(uint64_t stamp) {
+  DeviceSnapshot snapshot;
+  snapshot.sequence = stamp;
+  snapshot.timestampMs = static_cast<int64_t>(stamp);
+  for (auto &metric : snapshot.metrics) {
+    metric = {static_cast<double>(stamp), ValueState::Live, static_cast<int64_t>(stamp)};
+  }
+  std::string text(stamp % TextValue::kCapacity, static_cast<char>('a' + stamp % 26));
+  for (auto &field : snapshot.texts) {
+    field.Assign(text);
+  }
+  return snapshot;
+}
+
+bool IsConsistent(DeviceSnapshot const &snapshot) {
+  if (snapshot.sequence == 0) {
+    return true;
+  }
+  auto expected = Stamped(snapshot.sequence);
+  return std::memcmp(&snapshot, &expected, sizeof(DeviceSnapshot)) == 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!ParseOptions(argc, argv, options)) {
+    std::fprintf(stderr, "usage: %s [--readers N] [--duration-ms D] [--publish-interval-us U] [--field-reads]\n", argv[0]);
+    return 2;
+  }
+
+  SnapshotPublisher publisher;
+  std::atomic<bool> done{false};
+  std::vector<uint64_t> reads(options.readers);
+  std::vector<uint64_t> inconsistent(options.readers);
+  std::latch start(options.readers + 1);
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < options.readers; ++r) {
+    readers.emplace_back([&, r] {
+      uint64_t count = 0;
+      uint64_t bad = 0;
+      uint64_t lastSequence = 0;
+      start.arrive_and_wait();
+      while (!done.load(std::memory_order_relaxed)) {
+        if (options.fieldReads) {
+          auto metric = publisher.Read(Metric::CpuUsage);
+          bad += static_cast<int64_t>(metric.value) != metric.ageMs;
+        } else {
+          auto snapshot = publisher.Latest();
+          bad += !IsConsistent(snapshot) || snapshot.sequence < lastSequence;
+          lastSequence = snapshot.sequence;
+        }
+        ++count;
+      }
+      reads[r] = count;
+      inconsistent[r] = bad;
+    });
+  }
+
+  start.arrive_and_wait();
+  auto begin = std::chrono::steady_clock::now();
+  auto end = begin + std::chrono::milliseconds(options.durationMs);
+  uint64_t stamp = 0;
+  while (std::chrono::steady_clock::now() < end) {
+    publisher.Publish(Stamped(++stamp));
+    if (options.publishIntervalUs > 0) {
+      std::this_thread::sleep_for(std::chrono::microseconds(options.publishIntervalUs));
+    }
+  }
+  done = true;
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+  uint64_t totalReads = 0;
+  uint64_t totalInconsistent = 0;
+  for (int r = 0; r < options.readers; ++r) {
+    totalReads += reads[r];
+    totalInconsistent += inconsistent[r];
+  }
+
+  std::printf("readers:               %d (%s)\n", options.readers, options.fieldReads ? "one metric per read" : "whole snapshot per read");
+  std::printf("snapshot size:         %zu bytes\n", sizeof(DeviceSnapshot));
+  std::printf("publishes:             %llu (%.0f/s)\n", static_cast<unsigned long long>(publisher.Publishes()),
+      publisher.Publishes() / elapsed.count());
+  std::printf("reads:                 %llu (%.2f M/s total, %.2f M/s per reader)\n", static_cast<unsigned long long>(totalReads),
+      totalReads / elapsed.count() / 1e6, totalReads / elapsed.count() / 1e6 / options.readers);
+  std::printf("inconsistent reads:    %llu\n", static_cast<unsigned long long>(totalInconsistent));
+  std::printf("result:                %s\n", totalInconsistent == 0 ? "PASS" : "FAIL");
+  return totalInconsistent == 0 ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+// Measures the cost of timing one collection span (two steady_clock reads and
+// the histogram update) on empty scopes, single-threaded and with threads
+// contending on the same span. --trace also records every span as a trace
+// event. Exits non-zero when a span costs more than the budget.
+//
+//   SpanOverheadBench [--iterations N] [--threads T] [--budget-ns B] [--trace]
+
+#include "SpanRecorder.h"
+#include "TraceRecorder.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <latch>
+#include <thread>
+#include <vector>
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+struct Options {
+  int iterations = 5000000;
+  int threads = 4;
+  int budgetNs = 1000;
+  bool trace = false;
+};
+
+bool ParseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    auto next = [&](int &out) {
+      if (i + 1 >= argc) {
+        return false;
+      }
+      out = std::atoi(argv[++i]);
+      return true;
+    };
+
+    if (std::strcmp(argv[i], "--iterations") == 0) {
+      if (!next(options.iterations)) return false;
+    } else if (std::strcmp(argv[i], "--threads") == 0) {
+      if (!next(options.threads)) return false;
+    } else if (std::strcmp(argv[i], "--budget-ns") == 0) {
+      if (!next(options.budgetNs)) return false;
+    } else if (std::strcmp(argv[i], "--trace") == 0) {
+      options.trace = true;
+    } else {
+      return false;
+    }
+  }
+  return options.iterations > 0 && options.threads > 0 && options.budgetNs > 0;
+}
+
+// Nanoseconds per span over iterations empty scopes
+double TimeSpans(SpanRecorder &recorder, int iterations) {
+  auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    ScopedSpan span(recorder, Span::PdhQuery);
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - begin;
+  return elapsed.count() / iterations;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!ParseOptions(argc, argv, options)) {
+    std::fprintf(stderr, "usage: %s [--iterations N] [--threads T] [--budget-ns B] [--trace]\n", argv[0]);
+    return 2;
+  }
+  TraceRecorder::Instance().SetEnabled(options.trace);
+
+  SpanRecorder recorder;
+  TimeSpans(recorder, options.iterations / 10); // warm up
+  auto singleNs = TimeSpans(recorder, options.iterations);
+
+  std::vector<double> perThreadNs(options.threads);
+  std::latch start(options.threads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < options.threads; ++t) {
+    threads.emplace_back([&, t] {
+      start.arrive_and_wait();
+      perThreadNs[t] = TimeSpans(recorder, options.iterations);
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  double contendedNs = 0.0;
+  for (auto ns : perThreadNs) {
+    contendedNs = std::max(contendedNs, ns);
+  }
+
+  auto stats = recorder.Snapshot(Span::PdhQuery);
+  std::printf("spans recorded:        %llu\n", static_cast<unsigned long long>(stats.calls));
+  std::printf("single thread:         %.1f ns/span\n", singleNs);
+  std::printf("%d threads contended:   %.1f ns/span (slowest thread)\n", options.threads, contendedNs);
+  std::printf("empty span p50/p99:    %llu / %llu ns\n", static_cast<unsigned long long>(stats.latency.p50Ns),
+      static_cast<unsigned long long>(stats.latency.p99Ns));
+  std::printf("trace events:          %s\n", options.trace ? "on" : "off");
+  std::printf("budget:                %d ns/span\n", options.budgetNs);
+
+  bool withinBudget = singleNs <= options.budgetNs && contendedNs <= options.budgetNs;
+  std::printf("result:                %s\n", withinBudget ? "PASS" : "FAIL");
+  return withinBudget ? 0 : 1;
+}
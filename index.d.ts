@@ -44,12 +44,237 @@ declare module 'react-native-device-ai' {
     error?: string;
   }
 
+  export interface CollectOptions {
+    /** Overall latency budget in milliseconds; late sections resolve stale */
+    budgetMs?: number;
+  }
+
+  export type BreakerState = 'closed' | 'open' | 'halfOpen';
+
+  export interface CollectorStats {
+    runs: number;
+    failures: number;
+    timeouts: number;
+    /** Calls answered from the last good value because the breaker was open */
+    skipped: number;
+    lastDurationMs: number;
+    breaker: BreakerState;
+    consecutiveFailures: number;
+    breakerOpens: number;
+    /** Time until the next probe; present only while the breaker is open */
+    retryInMs?: number;
+  }
+
+  /** How a section's fields were read: all live, some from the last good read, or some never read */
+  export type ValueState = 'live' | 'lastKnown' | 'unknown';
+
+  export interface FieldStats {
+    /** Dotted field path, e.g. 'memory.total' */
+    field: string;
+    /** API that produced the last good value; absent until one succeeds */
+    source?: string;
+    lastGoodAgeMs?: number;
+    live: number;
+    lastKnown: number;
+    unknown: number;
+  }
+
+  export interface SpanDiagnostics {
+    /** Collector ('memory', 'wmi', ...) or native call inside one ('pdh.query', 'wmi.connect', 'registry.read', ...) */
+    name: string;
+    calls: number;
+    failures: number;
+    /** Calls that answered at least partly from last-known or unknown values */
+    fallbacks: number;
+    p50Ms: number;
+    p90Ms: number;
+    p99Ms: number;
+    maxMs: number;
+    meanMs: number;
+  }
+
+  export type CollectorName = 'memory' | 'storage' | 'battery' | 'cpu' | 'network' | 'performanceCounters' | 'wmi';
+
   export interface WindowsSystemInfo {
     wmiData: Record<string, any>;
     performanceCounters: Record<string, number>;
     systemMetrics: Record<string, number>;
   }
 
+  export interface MemoryBreakdown {
+    total: number;
+    available: number;
+    commitTotal: number;
+    commitLimit: number;
+    commitPeak: number;
+    commitUsage: number;
+    systemCache: number;
+    kernelPaged: number;
+    kernelNonpaged: number;
+    /** Absent when the process lacks the privilege to query page lists */
+    standby?: number;
+    modified?: number;
+    pageFaultsPerSec: number;
+    hardFaultsPerSec: number;
+  }
+
+  export interface MemoryPressureEvent {
+    level: 'low' | 'normal';
+    timestamp: number;
+    memory?: Partial<MemoryBreakdown>;
+  }
+
+  export type TrendVerdict = 'insufficient' | 'stable' | 'growing' | 'leaking';
+
+  export type ProcessMetric = 'privateBytes' | 'workingSet' | 'handleCount' | 'threadCount';
+
+  export interface ProcessTrend {
+    verdict: TrendVerdict;
+    /** Least-squares growth in metric units per hour */
+    slopePerHour: number;
+    /** Fraction of consecutive samples that rose */
+    monotonicFraction: number;
+    samples: number;
+  }
+
+  export interface ProcessProfile {
+    privateBytes: number;
+    workingSet: number;
+    peakWorkingSet: number;
+    handleCount: number;
+    threadCount: number;
+    pageFaultsPerSec: number;
+    trends: Record<ProcessMetric, ProcessTrend>;
+    /** GC heap statistics, present when the JS engine exposes them (Hermes) */
+    jsHeap?: {
+      allocatedBytes?: number;
+      heapSize?: number;
+      numGCs?: number;
+      gcTimeMs?: number;
+    };
+  }
+
+  export interface ProcessTrendEvent {
+    metric: ProcessMetric;
+    verdict: TrendVerdict;
+    previousVerdict: TrendVerdict;
+    slopePerHour: number;
+    value: number;
+    timestamp: number;
+  }
+
+  export interface AnomalyEvent {
+    /** History metric name, e.g. 'cpu.usage', or 'process.workingSet' style for host process counters */
+    metric: string;
+    phase: 'start' | 'escalate' | 'end';
+    severity: 'warning' | 'critical';
+    /** Unix ms of the sample that started the anomaly */
+    startTime: number;
+    value: number;
+    expected: number;
+    /** Deviations from the expected value */
+    score: number;
+    /** Largest |score| of the anomaly so far, signed */
+    peakScore: number;
+    timestamp: number;
+  }
+
+  export interface AnomalyLog {
+    events: AnomalyEvent[];
+    open: AnomalyEvent[];
+  }
+
+  export interface AlertRule {
+    id: string;
+    /** e.g. 'cpu.usage > 90 for 30s clear 80', 'storage.available < 5%', 'battery.drainRate > 20%/h' */
+    rule: string;
+  }
+
+  export interface AlertEvent {
+    id: string;
+    state: 'firing' | 'ok';
+    /** In the units the rule was written in */
+    value: number;
+    threshold: number;
+    /** Unix ms when the condition started to hold */
+    since: number;
+    timestamp: number;
+  }
+
+  export interface Subscription {
+    remove(): void;
+  }
+
+  export interface SamplerDiagnostics {
+    running: boolean;
+    policy: 'performance' | 'balanced' | 'energy-saver' | 'background' | 'unavailable';
+    intervalMs: number;
+    tolerableDelayMs: number;
+    wakeupsPerMinute: number;
+    totalWakeups: number;
+    volatility: number;
+    powerSource: 'ac' | 'battery' | 'unknown';
+    energySaver: boolean;
+    foreground: boolean;
+  }
+
+  export interface LiveSection {
+    readonly state: 'live' | 'lastKnown' | 'unknown';
+    readonly stale: boolean;
+    readonly ageMs?: number;
+  }
+
+  export interface LiveSnapshot {
+    readonly sequence: number;
+    readonly timestampMs?: number;
+    readonly osVersion?: string;
+    readonly buildNumber?: string;
+    readonly processor?: string;
+    readonly architecture?: string;
+    readonly memory: LiveSection & { readonly total?: number; readonly available?: number };
+    readonly storage: LiveSection & { readonly total?: number; readonly available?: number };
+    readonly battery: LiveSection & { readonly level?: number; readonly isCharging?: boolean };
+    readonly cpu: LiveSection & { readonly usage?: number; readonly cores?: number };
+    readonly network: LiveSection & { readonly type?: string; readonly isConnected?: boolean };
+    readonly performanceCounters: LiveSection & { readonly cpuUsage?: number; readonly memoryUsage?: number; readonly diskUsage?: number };
+    readonly wmiData: LiveSection & { readonly computerSystem?: string; readonly operatingSystem?: string; readonly processor?: string };
+    /** One snapshot whose fields all come from the same sampler wakeup (only on DeviceAI.live itself) */
+    read?(): LiveSnapshot;
+  }
+
+  export interface MetricHistoryOptions {
+    metrics: string[];
+    fromMs?: number;
+    toMs?: number;
+    maxPoints?: number;
+    mode?: 'm4' | 'lttb' | 'none';
+    precision?: 'float32' | 'float64';
+  }
+
+  export interface MetricHistory {
+    timestamps: Float64Array;
+    series: Record<string, { timestamps: Float64Array; values: Float32Array | Float64Array }>;
+  }
+
+  export type MetricAggregation = 'avg' | 'min' | 'max' | 'sum' | 'count' | 'p50' | 'p90' | 'p95' | 'p99' | 'rate';
+
+  export interface MetricQueryOptions {
+    metrics: string[];
+    fromMs?: number;
+    toMs?: number;
+    stepMs?: number;
+    aggregation?: MetricAggregation;
+    precision?: 'float32' | 'float64';
+  }
+
+  export interface MetricQueryResult {
+    stepMs: number;
+    /** Resolution the buckets were computed from; 0 for raw samples */
+    sourceStepMs: number;
+    timestamps: Float64Array;
+    series: Record<string, Float32Array | Float64Array>;
+  }
+
   export interface DeviceQueryResult {
     success: boolean;
     prompt: string;
@@ -135,7 +360,118 @@ declare module 'react-native-device-ai' {
     /**
      * Get enhanced Windows system information (Windows only)
      */
-    getWindowsSystemInfo(): Promise<WindowsSystemInfo>;
+    getWindowsSystemInfo(options?: CollectOptions): Promise<WindowsSystemInfo>;
+
+    /**
+     * Get run, failure and timeout counts and circuit breaker state for each native data source (Windows only)
+     */
+    getCollectorStats(): Record<CollectorName, CollectorStats>;
+
+    /**
+     * Get how often each reported field was read live, from its last good value, or left unknown (Windows only)
+     */
+    getFallbackStats(): FieldStats[];
+
+    /**
+     * Get latency percentiles and call, failure and fallback counts for each native collector and call (Windows only)
+     */
+    getDiagnostics(): SpanDiagnostics[];
+
+    /**
+     * Turn recording of native collection spans as trace events on or off (Windows only)
+     */
+    setTracingEnabled(enabled: boolean): void;
+
+    /**
+     * Get the recorded trace events as Chrome trace-event JSON (Windows only)
+     */
+    getTraceEvents(): Promise<string>;
+
+    /**
+     * Write the recorded trace events to a Chrome trace-event JSON file (Windows only)
+     */
+    writeTraceFile(path: string): Promise<string>;
+
+    /**
+     * Get detailed memory breakdown with commit, pools and fault rates (Windows only)
+     */
+    getMemoryBreakdown(): Promise<MemoryBreakdown>;
+
+    /**
+     * Subscribe to debounced native low-memory transitions (Windows only)
+     */
+    onMemoryPressure(listener: (event: MemoryPressureEvent) => void): Subscription;
+
+    /**
+     * Set how long native device/system info results are reused after a collection (Windows only)
+     */
+    setCoalescingWindow(windowMs: number): void;
+
+    /**
+     * Profile the host process with leak-trend verdicts (Windows only)
+     */
+    getProcessProfile(): Promise<ProcessProfile>;
+
+    /**
+     * Subscribe to leak-trend verdict changes of the host process (Windows only)
+     */
+    onProcessTrend(listener: (event: ProcessTrendEvent) => void): Subscription;
+
+    /**
+     * Subscribe to anomalies in the sampled metrics and host process counters (Windows only)
+     */
+    onAnomaly(listener: (event: AnomalyEvent) => void): Subscription;
+
+    /**
+     * Replace the threshold alert rules evaluated natively on every sample (Windows only)
+     */
+    setAlertRules(rules: AlertRule[]): void;
+
+    /**
+     * Subscribe to alert rules starting to fire or resolving (Windows only)
+     */
+    onAlert(listener: (event: AlertEvent) => void): Subscription;
+
+    /**
+     * Get the alert rules firing now (Windows only)
+     */
+    getFiringAlerts(): AlertEvent[];
+
+    /**
+     * Start the adaptive native background sampler (Windows only)
+     */
+    startSampling(): void;
+
+    /**
+     * Stop the native background sampler (Windows only)
+     */
+    stopSampling(): void;
+
+    /**
+     * Get the active sampling policy and achieved wakeups per minute (Windows only)
+     */
+    getSamplerDiagnostics(): SamplerDiagnostics;
+
+    /**
+     * Get a window of the sampler's metric history as typed arrays (Windows only)
+     */
+    getMetricHistory(options: MetricHistoryOptions): MetricHistory;
+
+    /**
+     * Aggregate the sampler's metric history over fixed time buckets (Windows only)
+     */
+    queryMetrics(options: MetricQueryOptions): MetricQueryResult;
+
+    /**
+     * Get logged anomaly events and the anomalies in progress (Windows only)
+     */
+    getAnomalies(sinceMs?: number): AnomalyLog;
+
+    /**
+     * Latest sampler snapshot as synchronous property reads (Windows only);
+     * null without a JSI runtime
+     */
+    readonly live: LiveSnapshot | null;
   }
 
   // Enhanced DeviceAI class with MCP support
@@ -1,4 +1,4 @@
-const { Platform, Dimensions } = require('react-native');
+const { Platform, Dimensions, AppState, DeviceEventEmitter } = require('react-native');
 const AzureOpenAI = require('./AzureOpenAI.js');
 
 // Try to import the native module with fallback handling
@@ -18,6 +18,8 @@ class DeviceAI {
     this.deviceInfo = null;
     this.lastUpdate = null;
     this.cacheTimeout = 5 * 60 * 1000; // 5 minutes
+    this.appStateSubscription = null;
+    this.memoryPressureListenerCount = 0;
     
     // Auto-configure from environment variables if available
     this._autoConfigureFromEnvironment();
@@ -131,6 +133,10 @@ class DeviceAI {
     try {
       const deviceData = await this._collectDeviceInfo();
       const performanceData = this._extractPerformanceInfo(deviceData);
+      const memoryPressure = await this._collectMemoryPressure();
+      if (memoryPressure) {
+        performanceData.memoryPressure = memoryPressure;
+      }
       let aiTips;
       
       try {
@@ -490,6 +496,11 @@ class DeviceAI {
    * @private
    */
   _generateFallbackPerformanceTips(performanceData) {
+    const pressure = performanceData.memoryPressure;
+    if (pressure && (pressure.commitUsage > 90 || pressure.hardFaultsPerSec > 100)) {
+      return "The system is under memory pressure and paging to disk. Close memory-heavy applications to reduce commit charge and hard faults.";
+    }
+
     const memoryUsage = performanceData.memory.usedPercentage;
     if (memoryUsage > 80) {
       return "High memory usage detected. Consider closing unused applications and restarting your device.";
@@ -627,10 +638,15 @@ class DeviceAI {
 
   /**
    * Get enhanced Windows system information (Windows only)
-   * Requires native module to be available
+   * Requires native module to be available. Each source runs under its own deadline;
+   * a section that misses it resolves with its last good value and `stale: true`.
+   * A field that could not be read falls back to its last good value; one never read
+   * is omitted, and each section's `state` says which happened.
+   * @param {Object} [options]
+   * @param {number} [options.budgetMs] - Overall latency budget in milliseconds (default 2000)
    * @returns {Promise<Object>} Windows-specific system information
    */
-  async getWindowsSystemInfo() {
+  async getWindowsSystemInfo(options = {}) {
     if (Platform.OS !== 'windows') {
       throw new Error('Windows system info is only available on Windows platform');
     }
@@ -640,7 +656,7 @@ class DeviceAI {
     }
 
     try {
-      return await NativeDeviceAI.getWindowsSystemInfo();
+      return await NativeDeviceAI.getWindowsSystemInfo(options);
     } catch (error) {
       console.error('Error getting Windows system info:', error);
       throw error;
@@ -693,6 +709,509 @@ class DeviceAI {
     }
   }
 
+  /**
+   * Get detailed Windows memory breakdown (Windows only)
+   * Includes commit charge, system cache, kernel pools, page lists and fault rates
+   * @returns {Promise<Object>} Memory breakdown
+   */
+  async getMemoryBreakdown() {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Memory breakdown is only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.getMemoryBreakdown !== 'function') {
+      throw new Error('Native module required for memory breakdown');
+    }
+
+    try {
+      return await NativeDeviceAI.getMemoryBreakdown();
+    } catch (error) {
+      console.error('Error getting memory breakdown:', error);
+      throw error;
+    }
+  }
+
+  /**
+   * Collect commit and hard-fault data for memory-pressure insights when available
+   * @private
+   */
+  async _collectMemoryPressure() {
+    if (Platform.OS !== 'windows' || !this.isNativeModuleAvailable() ||
+        typeof NativeDeviceAI.getMemoryBreakdown !== 'function') {
+      return null;
+    }
+
+    try {
+      const breakdown = await NativeDeviceAI.getMemoryBreakdown();
+      return {
+        commitUsage: breakdown.commitUsage,
+        commitTotal: breakdown.commitTotal,
+        commitLimit: breakdown.commitLimit,
+        hardFaultsPerSec: breakdown.hardFaultsPerSec,
+        pageFaultsPerSec: breakdown.pageFaultsPerSec,
+      };
+    } catch (error) {
+      console.warn('Could not get memory breakdown:', error.message);
+      return null;
+    }
+  }
+
+  /**
+   * Subscribe to native low-memory transitions (Windows only)
+   * Entering low memory also drops the cached device info so the next call re-collects
+   * @param {Function} listener - Called with { level: 'low' | 'normal', timestamp, memory }
+   * @returns {Object} Subscription with a remove() method
+   */
+  onMemoryPressure(listener) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Memory pressure events are only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.startMemoryMonitoring !== 'function' ||
+        !DeviceEventEmitter) {
+      throw new Error('Native module required for memory pressure events');
+    }
+
+    const subscription = DeviceEventEmitter.addListener('deviceAiMemoryPressure', (event) => {
+      if (event.level === 'low') {
+        this.deviceInfo = null;
+        this.lastUpdate = null;
+      }
+      listener(event);
+    });
+
+    this.memoryPressureListenerCount += 1;
+    if (this.memoryPressureListenerCount === 1) {
+      NativeDeviceAI.startMemoryMonitoring();
+    }
+
+    let removed = false;
+    return {
+      remove: () => {
+        if (removed) {
+          return;
+        }
+        removed = true;
+        subscription.remove();
+        this.memoryPressureListenerCount -= 1;
+        if (this.memoryPressureListenerCount === 0) {
+          NativeDeviceAI.stopMemoryMonitoring();
+        }
+      }
+    };
+  }
+
+  /**
+   * Set how long a native getDeviceInfo/getWindowsSystemInfo result is reused (Windows only)
+   * Concurrent calls always share one in-flight collection; this window also answers
+   * calls that arrive shortly after it completes. Defaults to 1000 ms, 0 disables reuse.
+   * @param {number} windowMs - Freshness window in milliseconds
+   */
+  setCoalescingWindow(windowMs) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Request coalescing is only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.setCoalescingWindow !== 'function') {
+      throw new Error('Native module required for request coalescing');
+    }
+
+    if (typeof windowMs !== 'number' || !Number.isFinite(windowMs) || windowMs < 0) {
+      throw new Error('Coalescing window must be a non-negative number of milliseconds');
+    }
+
+    NativeDeviceAI.setCoalescingWindow(windowMs);
+  }
+
+  /**
+   * Get run, failure and timeout counts and circuit breaker state for each native data source (Windows only)
+   * @returns {Object} Stats keyed by collector
+   */
+  getCollectorStats() {
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.getCollectorStats !== 'function') {
+      throw new Error('Native module required for collector stats');
+    }
+
+    return NativeDeviceAI.getCollectorStats();
+  }
+
+  /**
+   * Get live, last-known and unknown counts for each reported field (Windows only)
+   * @returns {Array<Object>} One entry per field with its source and last good age
+   */
+  getFallbackStats() {
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.getFallbackStats !== 'function') {
+      throw new Error('Native module required for fallback stats');
+    }
+
+    return NativeDeviceAI.getFallbackStats();
+  }
+
+  /**
+   * Get latency percentiles and call, failure and fallback counts for each native
+   * collector and the PDH, WMI and registry calls inside them (Windows only)
+   * @returns {Array<Object>} One entry per span with p50/p90/p99/max in milliseconds
+   */
+  getDiagnostics() {
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.getDiagnostics !== 'function') {
+      throw new Error('Native module required for diagnostics');
+    }
+
+    return NativeDeviceAI.getDiagnostics();
+  }
+
+  /**
+   * Turn recording of native collection spans as trace events on or off (Windows only)
+   * Enabling clears events left from an earlier session.
+   * @param {boolean} enabled - Whether to record trace events
+   */
+  setTracingEnabled(enabled) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Trace events are only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.setTracingEnabled !== 'function') {
+      throw new Error('Native module required for trace events');
+    }
+
+    NativeDeviceAI.setTracingEnabled(Boolean(enabled));
+  }
+
+  /**
+   * Get the recorded trace events in Chrome trace-event JSON format (Windows only)
+   * Load the result in chrome://tracing or https://ui.perfetto.dev.
+   * @returns {Promise<string>} Trace JSON
+   */
+  async getTraceEvents() {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Trace events are only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.getTraceEvents !== 'function') {
+      throw new Error('Native module required for trace events');
+    }
+
+    try {
+      return await NativeDeviceAI.getTraceEvents();
+    } catch (error) {
+      console.error('Error getting trace events:', error);
+      throw error;
+    }
+  }
+
+  /**
+   * Write the recorded trace events to a Chrome trace-event JSON file (Windows only)
+   * @param {string} path - Destination file path
+   * @returns {Promise<string>} The path written
+   */
+  async writeTraceFile(path) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Trace events are only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.writeTraceFile !== 'function') {
+      throw new Error('Native module required for trace events');
+    }
+
+    if (typeof path !== 'string' || path.length === 0) {
+      throw new Error('Trace file path must be a non-empty string');
+    }
+
+    try {
+      return await NativeDeviceAI.writeTraceFile(path);
+    } catch (error) {
+      console.error('Error writing trace file:', error);
+      throw error;
+    }
+  }
+
+  /**
+   * Profile the host process itself (Windows only)
+   * Includes private bytes, working set, handles, threads and leak-trend verdicts.
+   * Trends advance on background sampler ticks, so they stay 'insufficient' until sampling runs.
+   * @returns {Promise<Object>} Process profile
+   */
+  async getProcessProfile() {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Process profiling is only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.getProcessProfile !== 'function') {
+      throw new Error('Native module required for process profiling');
+    }
+
+    try {
+      const profile = await NativeDeviceAI.getProcessProfile();
+      const jsHeap = this._collectJsHeapStats();
+      return jsHeap ? { ...profile, jsHeap } : profile;
+    } catch (error) {
+      console.error('Error getting process profile:', error);
+      throw error;
+    }
+  }
+
+  /**
+   * Read GC heap statistics from the JS engine when it exposes them (Hermes)
+   * @private
+   */
+  _collectJsHeapStats() {
+    const hermes = global.HermesInternal;
+    if (!hermes || typeof hermes.getInstrumentedStats !== 'function') {
+      return null;
+    }
+
+    try {
+      const stats = hermes.getInstrumentedStats();
+      return {
+        allocatedBytes: stats.js_allocatedBytes,
+        heapSize: stats.js_heapSize,
+        numGCs: stats.js_numGCs,
+        gcTimeMs: stats.js_gcTime !== undefined ? stats.js_gcTime * 1000 : undefined,
+      };
+    } catch (error) {
+      return null;
+    }
+  }
+
+  /**
+   * Subscribe to leak-trend verdict changes of the host process (Windows only)
+   * Requires the background sampler to be running
+   * @param {Function} listener - Called with { metric, verdict, previousVerdict, slopePerHour, value, timestamp }
+   * @returns {Object} Subscription with a remove() method
+   */
+  onProcessTrend(listener) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Process trend events are only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.getProcessProfile !== 'function' ||
+        !DeviceEventEmitter) {
+      throw new Error('Native module required for process trend events');
+    }
+
+    const subscription = DeviceEventEmitter.addListener('deviceAiProcessTrend', listener);
+    return {
+      remove: () => subscription.remove()
+    };
+  }
+
+  /**
+   * Subscribe to anomalies in the sampled metrics and host process counters (Windows only)
+   * Each series is scored against its own baseline for the hour of day; an anomaly
+   * starts, may escalate from 'warning' to 'critical', and ends once back in range.
+   * Requires the background sampler to be running
+   * @param {Function} listener - Called with { metric, phase, severity, startTime, value, expected, score, peakScore, timestamp }
+   * @returns {Object} Subscription with a remove() method
+   */
+  onAnomaly(listener) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Anomaly events are only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.startSampling !== 'function' ||
+        !DeviceEventEmitter) {
+      throw new Error('Native module required for anomaly events');
+    }
+
+    const subscription = DeviceEventEmitter.addListener('deviceAiAnomaly', listener);
+    return {
+      remove: () => subscription.remove()
+    };
+  }
+
+  /**
+   * Replace the threshold alert rules evaluated natively on every sample (Windows only)
+   * Rules read like 'cpu.usage > 90 for 30s clear 80 cooldown 5m'; a rule whose id
+   * and text are unchanged keeps its state. Requires the background sampler to be running
+   * @param {Array<Object>} rules - [{ id, rule }]
+   * @throws {Error} Naming the first rule that does not compile; the previous rules stay in place
+   */
+  setAlertRules(rules) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Alert rules are only available on Windows platform');
+    }
+
+    if (typeof global.__deviceAiSetAlertRules !== 'function') {
+      throw new Error('Native module with JSI required for alert rules');
+    }
+
+    if (!Array.isArray(rules)) {
+      throw new Error('Alert rules must be an array of { id, rule } objects');
+    }
+
+    global.__deviceAiSetAlertRules(rules);
+  }
+
+  /**
+   * Subscribe to alert rules starting to fire or resolving (Windows only)
+   * @param {Function} listener - Called with { id, state: 'firing' | 'ok', value, threshold, since, timestamp }
+   * @returns {Object} Subscription with a remove() method
+   */
+  onAlert(listener) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Alert events are only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.startSampling !== 'function' ||
+        !DeviceEventEmitter) {
+      throw new Error('Native module required for alert events');
+    }
+
+    const subscription = DeviceEventEmitter.addListener('deviceAiAlert', listener);
+    return {
+      remove: () => subscription.remove()
+    };
+  }
+
+  /**
+   * Get the alert rules firing now (Windows only)
+   * @returns {Array<Object>} Shaped like onAlert events
+   */
+  getFiringAlerts() {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Alert rules are only available on Windows platform');
+    }
+
+    if (typeof global.__deviceAiFiringAlerts !== 'function') {
+      throw new Error('Native module with JSI required for alert rules');
+    }
+
+    return global.__deviceAiFiringAlerts();
+  }
+
+  /**
+   * Start the native background sampler (Windows only)
+   * Cadence adapts to power source, energy saver, app state and metric volatility
+   */
+  startSampling() {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Background sampling is only available on Windows platform');
+    }
+
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.startSampling !== 'function') {
+      throw new Error('Native module required for background sampling');
+    }
+
+    // Let the sampler back off while the app is in the background
+    if (!this.appStateSubscription && AppState && AppState.addEventListener) {
+      NativeDeviceAI.setAppForeground(AppState.currentState !== 'background');
+      this.appStateSubscription = AppState.addEventListener('change', (state) => {
+        NativeDeviceAI.setAppForeground(state !== 'background');
+      });
+    }
+
+    NativeDeviceAI.startSampling();
+  }
+
+  /**
+   * Stop the native background sampler (Windows only)
+   */
+  stopSampling() {
+    if (this.appStateSubscription) {
+      this.appStateSubscription.remove();
+      this.appStateSubscription = null;
+    }
+
+    if (this.isNativeModuleAvailable() && typeof NativeDeviceAI.stopSampling === 'function') {
+      NativeDeviceAI.stopSampling();
+    }
+  }
+
+  /**
+   * Latest sampler snapshot as synchronous property reads (Windows only), e.g.
+   * DeviceAI.live.cpu.usage. Each read copies one field from native memory, so it
+   * is cheap enough to call every frame. Refreshed on sampler wakeups while
+   * sampling runs; fields stay undefined until the first wakeup. Separate reads
+   * may come from different wakeups; live.read() returns one pinned snapshot.
+   * @returns {Object|null} Live snapshot, or null without a JSI runtime
+   */
+  get live() {
+    return global.__deviceAiLive || null;
+  }
+
+  /**
+   * Get a window of the sampler's metric history as typed arrays (Windows only)
+   * @param {Object} options - History window
+   * @param {Array<string>} options.metrics - Metric names, e.g. 'cpu.usage'
+   * @param {number} [options.fromMs] - Start of the window, Unix ms (inclusive)
+   * @param {number} [options.toMs] - End of the window, Unix ms (inclusive)
+   * @param {number} [options.maxPoints] - Decimate each series natively to at most this many points
+   * @param {string} [options.mode] - 'm4' (default), 'lttb' or 'none'
+   * @param {string} [options.precision] - 'float32' (default) or 'float64' values
+   * @returns {Object} Float64Array timestamps and, per metric, timestamps and values arrays
+   */
+  getMetricHistory(options) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Metric history is only available on Windows platform');
+    }
+
+    if (typeof global.__deviceAiHistory !== 'function') {
+      throw new Error('Native module with JSI required for metric history');
+    }
+
+    if (!options || !Array.isArray(options.metrics) || options.metrics.length === 0) {
+      throw new Error('At least one metric name is required');
+    }
+
+    return global.__deviceAiHistory(options);
+  }
+
+  /**
+   * Aggregate the sampler's metric history over fixed time buckets (Windows only)
+   * @param {Object} options - Query
+   * @param {Array<string>} options.metrics - Metric names, e.g. 'cpu.usage'
+   * @param {number} [options.fromMs] - Start of the range, Unix ms (inclusive)
+   * @param {number} [options.toMs] - End of the range, Unix ms (inclusive)
+   * @param {number} [options.stepMs] - Bucket width in ms (default 60000)
+   * @param {string} [options.aggregation] - 'avg' (default), 'min', 'max', 'sum', 'count', 'p50', 'p90', 'p95', 'p99' or 'rate'
+   * @param {string} [options.precision] - 'float32' (default) or 'float64' values
+   * @returns {Object} Float64Array bucket timestamps and one values array per metric
+   */
+  queryMetrics(options) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Metric queries are only available on Windows platform');
+    }
+
+    if (typeof global.__deviceAiQuery !== 'function') {
+      throw new Error('Native module with JSI required for metric queries');
+    }
+
+    if (!options || !Array.isArray(options.metrics) || options.metrics.length === 0) {
+      throw new Error('At least one metric name is required');
+    }
+
+    return global.__deviceAiQuery(options);
+  }
+
+  /**
+   * Get the anomaly events logged by the sampler and the anomalies still in progress (Windows only)
+   * @param {number} [sinceMs] - Only events at or after this Unix ms timestamp
+   * @returns {Object} { events, open }, each an array shaped like onAnomaly events
+   */
+  getAnomalies(sinceMs) {
+    if (Platform.OS !== 'windows') {
+      throw new Error('Anomaly detection is only available on Windows platform');
+    }
+
+    if (typeof global.__deviceAiAnomalies !== 'function') {
+      throw new Error('Native module with JSI required for anomaly detection');
+    }
+
+    return global.__deviceAiAnomalies(sinceMs);
+  }
+
+  /**
+   * Get the active sampling policy and achieved wakeups per minute (Windows only)
+   * @returns {Object} Sampler diagnostics
+   */
+  getSamplerDiagnostics() {
+    if (!this.isNativeModuleAvailable() || typeof NativeDeviceAI.getSamplerDiagnostics !== 'function') {
+      throw new Error('Native module required for sampler diagnostics');
+    }
+
+    return NativeDeviceAI.getSamplerDiagnostics();
+  }
+
   /**
    * Get enhanced battery information (cross-platform with Windows-specific enhancements)
    * @returns {Promise<Object>} Enhanced battery information
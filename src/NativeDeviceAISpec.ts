@@ -5,52 +5,184 @@
 import type {TurboModule} from 'react-native/Libraries/TurboModule/RCTExport';
 import {TurboModuleRegistry} from 'react-native';
 
+type ProcessTrend = {
+  readonly verdict: string;
+  readonly slopePerHour: number;
+  readonly monotonicFraction: number;
+  readonly samples: number;
+};
+
+type CollectOptions = {
+  readonly budgetMs?: number;
+};
+
+type FieldStats = {
+  readonly field: string;
+  readonly source?: string;
+  readonly lastGoodAgeMs?: number;
+  readonly live: number;
+  readonly lastKnown: number;
+  readonly unknown: number;
+};
+
+type SpanDiagnostics = {
+  readonly name: string;
+  readonly calls: number;
+  readonly failures: number;
+  readonly fallbacks: number;
+  readonly p50Ms: number;
+  readonly p90Ms: number;
+  readonly p99Ms: number;
+  readonly maxMs: number;
+  readonly meanMs: number;
+};
+
+type CollectorStats = {
+  readonly runs: number;
+  readonly failures: number;
+  readonly timeouts: number;
+  readonly skipped: number;
+  readonly lastDurationMs: number;
+  readonly breaker: string;
+  readonly consecutiveFailures: number;
+  readonly breakerOpens: number;
+  readonly retryInMs?: number;
+};
+
 export interface Spec extends TurboModule {
-  readonly getDeviceInfo: () => Promise<{
+  readonly getDeviceInfo: (options?: CollectOptions) => Promise<{
     readonly platform: string;
-    readonly osVersion: string;
-    readonly deviceModel: string;
+    readonly osVersion?: string;
+    readonly deviceModel?: string;
     readonly memory: {
-      readonly total: number;
-      readonly available: number;
+      readonly total?: number;
+      readonly available?: number;
+      readonly state: string;
+      readonly stale: boolean;
+      readonly ageMs?: number;
     };
     readonly storage: {
-      readonly total: number;
-      readonly available: number;
+      readonly total?: number;
+      readonly available?: number;
+      readonly state: string;
+      readonly stale: boolean;
+      readonly ageMs?: number;
     };
     readonly battery: {
-      readonly level: number;
-      readonly isCharging: boolean;
+      readonly level?: number;
+      readonly isCharging?: boolean;
+      readonly state: string;
+      readonly stale: boolean;
+      readonly ageMs?: number;
     };
     readonly cpu: {
-      readonly usage: number;
-      readonly cores: number;
+      readonly usage?: number;
+      readonly cores?: number;
+      readonly state: string;
+      readonly stale: boolean;
+      readonly ageMs?: number;
     };
     readonly network: {
-      readonly type: string;
-      readonly isConnected: boolean;
+      readonly type?: string;
+      readonly isConnected?: boolean;
+      readonly state: string;
+      readonly stale: boolean;
+      readonly ageMs?: number;
     };
   }>;
   
-  readonly getWindowsSystemInfo: () => Promise<{
-    readonly osVersion: string;
-    readonly buildNumber: string;
-    readonly processor: string;
-    readonly architecture: string;
+  readonly getWindowsSystemInfo: (options?: CollectOptions) => Promise<{
+    readonly osVersion?: string;
+    readonly buildNumber?: string;
+    readonly processor?: string;
+    readonly architecture?: string;
     readonly performanceCounters: {
-      readonly cpuUsage: number;
-      readonly memoryUsage: number;
-      readonly diskUsage: number;
+      readonly cpuUsage?: number;
+      readonly memoryUsage?: number;
+      readonly diskUsage?: number;
+      readonly state: string;
+      readonly stale: boolean;
+      readonly ageMs?: number;
     };
     readonly wmiData: {
-      readonly computerSystem: string;
-      readonly operatingSystem: string;
-      readonly processor: string;
+      readonly computerSystem?: string;
+      readonly operatingSystem?: string;
+      readonly processor?: string;
+      readonly state: string;
+      readonly stale: boolean;
+      readonly ageMs?: number;
     };
   }>;
   
   readonly isNativeModuleAvailable: () => boolean;
   readonly getSupportedFeatures: () => ReadonlyArray<string>;
+
+  readonly startSampling: () => void;
+  readonly stopSampling: () => void;
+  readonly setAppForeground: (foreground: boolean) => void;
+  readonly getSamplerDiagnostics: () => {
+    readonly running: boolean;
+    readonly policy: string;
+    readonly intervalMs: number;
+    readonly tolerableDelayMs: number;
+    readonly wakeupsPerMinute: number;
+    readonly totalWakeups: number;
+    readonly volatility: number;
+    readonly powerSource: string;
+    readonly energySaver: boolean;
+    readonly foreground: boolean;
+  };
+
+  readonly getMemoryBreakdown: () => Promise<{
+    readonly total: number;
+    readonly available: number;
+    readonly commitTotal: number;
+    readonly commitLimit: number;
+    readonly commitPeak: number;
+    readonly commitUsage: number;
+    readonly systemCache: number;
+    readonly kernelPaged: number;
+    readonly kernelNonpaged: number;
+    readonly standby?: number;
+    readonly modified?: number;
+    readonly pageFaultsPerSec: number;
+    readonly hardFaultsPerSec: number;
+  }>;
+
+  readonly startMemoryMonitoring: () => void;
+  readonly stopMemoryMonitoring: () => void;
+
+  readonly getProcessProfile: () => Promise<{
+    readonly privateBytes: number;
+    readonly workingSet: number;
+    readonly peakWorkingSet: number;
+    readonly handleCount: number;
+    readonly threadCount: number;
+    readonly pageFaultsPerSec: number;
+    readonly trends: {
+      readonly privateBytes: ProcessTrend;
+      readonly workingSet: ProcessTrend;
+      readonly handleCount: ProcessTrend;
+      readonly threadCount: ProcessTrend;
+    };
+  }>;
+
+  readonly setCoalescingWindow: (windowMs: number) => void;
+
+  readonly getCollectorStats: () => {
+    readonly memory: CollectorStats;
+    readonly storage: CollectorStats;
+    readonly battery: CollectorStats;
+    readonly cpu: CollectorStats;
+    readonly network: CollectorStats;
+    readonly performanceCounters: CollectorStats;
+    readonly wmi: CollectorStats;
+  };
+  readonly getFallbackStats: () => ReadonlyArray<FieldStats>;
+  readonly getDiagnostics: () => ReadonlyArray<SpanDiagnostics>;
+  readonly setTracingEnabled: (enabled: boolean) => void;
+  readonly getTraceEvents: () => Promise<string>;
+  readonly writeTraceFile: (path: string) => Promise<string>;
 }
 
 export default TurboModuleRegistry.getEnforcing<Spec>('ReactNativeDeviceAi');
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "pch.h"
+#include "AlertRulesExport.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace winrt::ReactNativeDeviceAiSpecs {
+
+using namespace ReactNativeDeviceAiCore;
+namespace jsi = facebook::jsi;
+
+namespace {
+
+std::vector<std::pair<std::string, std::string>> ParseRules(jsi::Runtime &runtime, jsi::Value const &value) {
+  if (!value.isObject() || !value.asObject(runtime).isArray(runtime)) {
+    throw jsi::JSError(runtime, "rules must be an array of { id, rule } objects");
+  }
+  std::vector<std::pair<std::string, std::string>> rules;
+  auto array = value.asObject(runtime).asArray(runtime);
+  for (size_t i = 0; i < array.size(runtime); ++i) {
+    auto entry = array.getValueAtIndex(runtime, i);
+    if (!entry.isObject()) {
+      throw jsi::JSError(runtime, "rules must be an array of { id, rule } objects");
+    }
+    auto object = entry.asObject(runtime);
+    auto id = object.getProperty(runtime, "id");
+    auto rule = object.getProperty(runtime, "rule");
+    if (!id.isString() || !rule.isString()) {
+      throw jsi::JSError(runtime, "each rule needs a string id and rule");
+    }
+    rules.emplace_back(id.asString(runtime).utf8(runtime), rule.asString(runtime).utf8(runtime));
+  }
+  return rules;
+}
+
+jsi::Object AlertObject(jsi::Runtime &runtime, AlertEvent const &event) {
+  jsi::Object object(runtime);
+  object.setProperty(runtime, "id", jsi::String::createFromUtf8(runtime, event.id));
+  object.setProperty(runtime, "state", jsi::String::createFromAscii(runtime, ToString(event.state)));
+  object.setProperty(runtime, "value", event.value);
+  object.setProperty(runtime, "threshold", event.threshold);
+  object.setProperty(runtime, "since", static_cast<double>(event.sinceMs));
+  object.setProperty(runtime, "timestamp", static_cast<double>(event.timeMs));
+  return object;
+}
+
+} // namespace
+
+void InstallAlertRules(jsi::Runtime &runtime, std::shared_ptr<AlertEngine> alerts) {
+  auto setRules = [alerts](jsi::Runtime &runtime, jsi::Value const &, jsi::Value const *args, size_t count) -> jsi::Value {
+    if (count < 1) {
+      throw jsi::JSError(runtime, "rules must be an array of { id, rule } objects");
+    }
+    if (auto error = alerts->SetRules(ParseRules(runtime, args[0]))) {
+      throw jsi::JSError(runtime, *error);
+    }
+    return jsi::Value::undefined();
+  };
+
+  runtime.global().setProperty(runtime, "__deviceAiSetAlertRules",
+      jsi::Function::createFromHostFunction(runtime, jsi::PropNameID::forAscii(runtime, "__deviceAiSetAlertRules"), 1, std::move(setRules)));
+
+  auto firing = [alerts](jsi::Runtime &runtime, jsi::Value const &, jsi::Value const *, size_t) -> jsi::Value {
+    auto events = alerts->Firing();
+    jsi::Array array(runtime, events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+      array.setValueAtIndex(runtime, i, AlertObject(runtime, events[i]));
+    }
+    return array;
+  };
+
+  runtime.global().setProperty(runtime, "__deviceAiFiringAlerts",
+      jsi::Function::createFromHostFunction(runtime, jsi::PropNameID::forAscii(runtime, "__deviceAiFiringAlerts"), 0, std::move(firing)));
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
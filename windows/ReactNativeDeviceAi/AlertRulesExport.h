@@ -0,0 +1,27 @@
+#pragma once
+
+#include "pch.h"
+
+#include <JSI/JsiApiContext.h>
+
+#include <AlertEngine.h>
+
+#include <memory>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// Defines global.__deviceAiSetAlertRules(rules), which compiles an array of
+// { id, rule } objects with AlertEngine::SetRules and replaces the rules the
+// sampler evaluates. Throws with the failing rule's id and reason, leaving the
+// previous rules in place.
+//
+// Also defines global.__deviceAiFiringAlerts(), which returns the rules firing
+// now, shaped like deviceAiAlert events:
+//
+//   [{ id, state: 'firing', value, threshold, since, timestamp }, ...]
+//
+// Both must run on the JS thread.
+void InstallAlertRules(facebook::jsi::Runtime &runtime, std::shared_ptr<ReactNativeDeviceAiCore::AlertEngine> alerts);
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,119 @@
+#include "pch.h"
+#include "BackgroundSampler.h"
+
+namespace winrt::ReactNativeDeviceAiSpecs {
+
+using namespace ReactNativeDeviceAiCore;
+
+BackgroundSampler::BackgroundSampler(TickHandler onTick) noexcept
+    : m_onTick(std::move(onTick)), m_policy(SteadyClock::Instance()) {
+  // A plain synchronization timer: high-resolution timers cannot be coalesced.
+  m_timer.attach(CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS));
+  m_stopEvent.attach(CreateEventW(nullptr, TRUE, FALSE, nullptr));
+  m_rearmEvent.attach(CreateEventW(nullptr, FALSE, FALSE, nullptr));
+}
+
+BackgroundSampler::~BackgroundSampler() noexcept {
+  Stop();
+}
+
+void BackgroundSampler::Start() noexcept {
+  std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+  if (m_thread.joinable() || !m_timer || !m_stopEvent || !m_rearmEvent) {
+    return;
+  }
+
+  try {
+    using namespace winrt::Windows::System::Power;
+    m_powerSupplyRevoker = PowerManager::PowerSupplyStatusChanged(winrt::auto_revoke, [this](auto &&, auto &&) { RefreshInputs(); });
+    m_energySaverRevoker = PowerManager::EnergySaverStatusChanged(winrt::auto_revoke, [this](auto &&, auto &&) { RefreshInputs(); });
+  } catch (...) {
+    // Without change notifications the inputs are still refreshed on every wakeup.
+  }
+
+  RefreshInputs();
+  ResetEvent(m_stopEvent.get());
+  m_thread = std::thread([this]() { Run(); });
+}
+
+void BackgroundSampler::Stop() noexcept {
+  std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+  if (!m_thread.joinable()) {
+    return;
+  }
+
+  m_powerSupplyRevoker.revoke();
+  m_energySaverRevoker.revoke();
+
+  SetEvent(m_stopEvent.get());
+  m_thread.join();
+  CancelWaitableTimer(m_timer.get());
+}
+
+bool BackgroundSampler::IsRunning() const noexcept {
+  return m_thread.joinable();
+}
+
+void BackgroundSampler::SetForeground(bool foreground) noexcept {
+  if (m_foreground.exchange(foreground) != foreground) {
+    RefreshInputs();
+  }
+}
+
+SamplingDiagnostics BackgroundSampler::Diagnostics() const noexcept {
+  return m_policy.Diagnostics();
+}
+
+void BackgroundSampler::RefreshInputs() noexcept {
+  SamplingInputs inputs;
+  inputs.foreground = m_foreground.load();
+
+  SYSTEM_POWER_STATUS powerStatus;
+  if (GetSystemPowerStatus(&powerStatus)) {
+    if (powerStatus.ACLineStatus == 1) {
+      inputs.powerSource = PowerSource::Ac;
+    } else if (powerStatus.ACLineStatus == 0) {
+      inputs.powerSource = PowerSource::Battery;
+    }
+    inputs.energySaver = powerStatus.SystemStatusFlag == 1;
+  }
+
+  if (m_policy.SetInputs(inputs) && m_rearmEvent) {
+    SetEvent(m_rearmEvent.get());
+  }
+}
+
+void BackgroundSampler::Run() noexcept {
+  winrt::init_apartment(winrt::apartment_type::multi_threaded);
+
+  HANDLE handles[] = {m_stopEvent.get(), m_rearmEvent.get(), m_timer.get()};
+  auto decision = m_policy.Current();
+
+  while (true) {
+    // Negative due time is relative, in 100 ns units.
+    LARGE_INTEGER dueTime;
+    dueTime.QuadPart = -decision.intervalMs * 10000LL;
+    SetWaitableTimerEx(
+        m_timer.get(), &dueTime, 0, nullptr, nullptr, nullptr, static_cast<ULONG>(decision.tolerableDelayMs));
+
+    auto waitResult = WaitForMultipleObjects(ARRAYSIZE(handles), handles, FALSE, INFINITE);
+    if (waitResult == WAIT_OBJECT_0 + 1) {
+      decision = m_policy.Current();
+      continue;
+    }
+    if (waitResult != WAIT_OBJECT_0 + 2) {
+      break;
+    }
+
+    double value = std::numeric_limits<double>::quiet_NaN();
+    try {
+      value = m_onTick();
+    } catch (...) {
+    }
+    decision = m_policy.OnSample(value);
+  }
+
+  winrt::uninit_apartment();
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
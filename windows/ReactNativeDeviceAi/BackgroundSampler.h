@@ -0,0 +1,59 @@
+#pragma once
+
+#include "pch.h"
+
+#include <AdaptiveSamplingPolicy.h>
+
+#include <winrt/Windows.System.Power.h>
+
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// Background sampling thread. Wakeups come from a coalescable waitable timer
+// armed with the interval and tolerable delay chosen by AdaptiveSamplingPolicy,
+// so the OS can batch them with other timer activity while on battery.
+class BackgroundSampler
+{
+public:
+  // Invoked on the sampler thread for every wakeup. Returns the value of the
+  // metric whose volatility drives the cadence (NaN when not yet available).
+  using TickHandler = std::function<double()>;
+
+  explicit BackgroundSampler(TickHandler onTick) noexcept;
+  ~BackgroundSampler() noexcept;
+
+  BackgroundSampler(BackgroundSampler const &) = delete;
+  BackgroundSampler &operator=(BackgroundSampler const &) = delete;
+
+  void Start() noexcept;
+  void Stop() noexcept;
+  bool IsRunning() const noexcept;
+
+  void SetForeground(bool foreground) noexcept;
+  ReactNativeDeviceAiCore::SamplingDiagnostics Diagnostics() const noexcept;
+
+private:
+  void Run() noexcept;
+  void RefreshInputs() noexcept;
+
+  TickHandler m_onTick;
+  ReactNativeDeviceAiCore::AdaptiveSamplingPolicy m_policy;
+  std::atomic<bool> m_foreground{true};
+
+  winrt::handle m_timer;
+  winrt::handle m_stopEvent;
+  winrt::handle m_rearmEvent;
+
+  std::mutex m_lifecycleMutex;
+  std::thread m_thread;
+  winrt::Windows::System::Power::PowerManager::PowerSupplyStatusChanged_revoker m_powerSupplyRevoker;
+  winrt::Windows::System::Power::PowerManager::EnergySaverStatusChanged_revoker m_energySaverRevoker;
+};
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
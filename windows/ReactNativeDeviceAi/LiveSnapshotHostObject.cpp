@@ -0,0 +1,162 @@
+#include "pch.h"
+#include "LiveSnapshotHostObject.h"
+
+#include <string>
+
+namespace winrt::ReactNativeDeviceAiSpecs {
+
+using namespace ReactNativeDeviceAiCore;
+namespace jsi = facebook::jsi;
+
+namespace {
+
+constexpr TextField kIdentityTexts[] = {TextField::OsVersion, TextField::BuildNumber, TextField::Processor, TextField::Architecture};
+
+jsi::Value ToValue(jsi::Runtime &runtime, TextValue const &text) {
+  if (text.state == ValueState::Unknown) {
+    return jsi::Value::undefined();
+  }
+  return jsi::String::createFromUtf8(runtime, reinterpret_cast<uint8_t const *>(text.chars.data()), text.length);
+}
+
+} // namespace
+
+MetricValue LiveSnapshotHostObject::Source::Read(Metric metric) const noexcept {
+  return pinned ? (*pinned)[metric] : latest->Read(metric);
+}
+
+TextValue LiveSnapshotHostObject::Source::Read(TextField field) const noexcept {
+  return pinned ? (*pinned)[field] : latest->Read(field);
+}
+
+SectionSummary LiveSnapshotHostObject::Source::Read(Collector collector) const noexcept {
+  return pinned ? pinned->Section(collector) : latest->Read(collector);
+}
+
+uint64_t LiveSnapshotHostObject::Source::Sequence() const noexcept {
+  return pinned ? pinned->sequence : latest->Sequence();
+}
+
+int64_t LiveSnapshotHostObject::Source::TimestampMs() const noexcept {
+  return pinned ? pinned->timestampMs : latest->TimestampMs();
+}
+
+// One collector's section: its fields plus state, stale and ageMs, with the
+// same meaning as in getDeviceInfo
+class LiveSnapshotHostObject::Section final : public jsi::HostObject
+{
+public:
+  Section(Source source, Collector collector) noexcept : m_source(std::move(source)), m_collector(collector) {}
+
+  jsi::Value get(jsi::Runtime &runtime, jsi::PropNameID const &name) override {
+    auto property = name.utf8(runtime);
+
+    for (auto metric : MetricsOf(m_collector)) {
+      if (property == ShortName(metric)) {
+        auto value = m_source.Read(metric);
+        if (value.state == ValueState::Unknown) {
+          return jsi::Value::undefined();
+        }
+        return IsBoolean(metric) ? jsi::Value(value.value != 0.0) : jsi::Value(value.value);
+      }
+    }
+    for (auto field : TextsOf(m_collector)) {
+      if (property == ShortName(field)) {
+        return ToValue(runtime, m_source.Read(field));
+      }
+    }
+
+    if (property == "state" || property == "stale" || property == "ageMs") {
+      auto summary = m_source.Read(m_collector);
+      if (property == "state") {
+        return jsi::String::createFromAscii(runtime, ToString(summary.state));
+      }
+      if (property == "stale") {
+        return jsi::Value(summary.state != ValueState::Live);
+      }
+      return summary.state == ValueState::LastKnown ? jsi::Value(static_cast<double>(summary.ageMs)) : jsi::Value::undefined();
+    }
+    return jsi::Value::undefined();
+  }
+
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime &runtime) override {
+    std::vector<jsi::PropNameID> names;
+    for (auto metric : MetricsOf(m_collector)) {
+      names.push_back(jsi::PropNameID::forAscii(runtime, ShortName(metric)));
+    }
+    for (auto field : TextsOf(m_collector)) {
+      names.push_back(jsi::PropNameID::forAscii(runtime, ShortName(field)));
+    }
+    for (auto const *name : {"state", "stale", "ageMs"}) {
+      names.push_back(jsi::PropNameID::forAscii(runtime, name));
+    }
+    return names;
+  }
+
+private:
+  Source m_source;
+  Collector m_collector;
+};
+
+LiveSnapshotHostObject::LiveSnapshotHostObject(Source source) : m_source(std::move(source)) {
+  for (size_t i = 0; i < kCollectorCount; ++i) {
+    m_sections[i] = std::make_shared<Section>(m_source, static_cast<Collector>(i));
+  }
+}
+
+jsi::Value LiveSnapshotHostObject::get(jsi::Runtime &runtime, jsi::PropNameID const &name) {
+  auto property = name.utf8(runtime);
+
+  for (size_t i = 0; i < kCollectorCount; ++i) {
+    if (property == SectionName(static_cast<Collector>(i))) {
+      return jsi::Object::createFromHostObject(runtime, m_sections[i]);
+    }
+  }
+  for (auto field : kIdentityTexts) {
+    if (property == ToString(field)) {
+      return ToValue(runtime, m_source.Read(field));
+    }
+  }
+
+  // One consistent copy of the whole snapshot, for reading several fields together
+  if (property == "read" && !m_source.pinned) {
+    return jsi::Function::createFromHostFunction(runtime, jsi::PropNameID::forAscii(runtime, "read"), 0,
+        [latest = m_source.latest](jsi::Runtime &runtime, jsi::Value const &, jsi::Value const *, size_t) {
+          Source pinned{latest, std::make_shared<DeviceSnapshot const>(latest->Latest())};
+          return jsi::Object::createFromHostObject(runtime, std::make_shared<LiveSnapshotHostObject>(std::move(pinned)));
+        });
+  }
+
+  // Sequence 0 means the sampler has not published yet
+  if (property == "sequence") {
+    return jsi::Value(static_cast<double>(m_source.Sequence()));
+  }
+  if (property == "timestampMs") {
+    auto sequence = m_source.Sequence();
+    return sequence == 0 ? jsi::Value::undefined() : jsi::Value(static_cast<double>(m_source.TimestampMs()));
+  }
+  return jsi::Value::undefined();
+}
+
+std::vector<jsi::PropNameID> LiveSnapshotHostObject::getPropertyNames(jsi::Runtime &runtime) {
+  std::vector<jsi::PropNameID> names;
+  for (size_t i = 0; i < kCollectorCount; ++i) {
+    names.push_back(jsi::PropNameID::forAscii(runtime, SectionName(static_cast<Collector>(i))));
+  }
+  for (auto field : kIdentityTexts) {
+    names.push_back(jsi::PropNameID::forAscii(runtime, ToString(field)));
+  }
+  names.push_back(jsi::PropNameID::forAscii(runtime, "sequence"));
+  names.push_back(jsi::PropNameID::forAscii(runtime, "timestampMs"));
+  if (!m_source.pinned) {
+    names.push_back(jsi::PropNameID::forAscii(runtime, "read"));
+  }
+  return names;
+}
+
+void LiveSnapshotHostObject::Install(jsi::Runtime &runtime, std::shared_ptr<SnapshotPublisher const> latest) {
+  auto live = std::make_shared<LiveSnapshotHostObject>(Source{std::move(latest), nullptr});
+  runtime.global().setProperty(runtime, "__deviceAiLive", jsi::Object::createFromHostObject(runtime, std::move(live)));
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "pch.h"
+
+#include <JSI/JsiApiContext.h>
+
+#include <SnapshotPublisher.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// global.__deviceAiLive: the latest sampled snapshot as plain property reads,
+// e.g. live.cpu.usage or live.wmiData.processor. Every getter copies just the
+// field it returns out of the SnapshotPublisher, so reads are synchronous,
+// never wait for the sampler thread and never go through JSValue marshalling.
+// Two getters may see different publishes; live.read() pins one snapshot whose
+// fields all come from the same wakeup. Fields that were never read are
+// undefined.
+class LiveSnapshotHostObject final : public facebook::jsi::HostObject
+{
+public:
+  // Reads from the publisher, or from one pinned copy when pinned is set
+  struct Source {
+    std::shared_ptr<ReactNativeDeviceAiCore::SnapshotPublisher const> latest;
+    std::shared_ptr<ReactNativeDeviceAiCore::DeviceSnapshot const> pinned;
+
+    ReactNativeDeviceAiCore::MetricValue Read(ReactNativeDeviceAiCore::Metric metric) const noexcept;
+    ReactNativeDeviceAiCore::TextValue Read(ReactNativeDeviceAiCore::TextField field) const noexcept;
+    ReactNativeDeviceAiCore::SectionSummary Read(ReactNativeDeviceAiCore::Collector collector) const noexcept;
+    uint64_t Sequence() const noexcept;
+    int64_t TimestampMs() const noexcept;
+  };
+
+  explicit LiveSnapshotHostObject(Source source);
+
+  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, facebook::jsi::PropNameID const &name) override;
+  std::vector<facebook::jsi::PropNameID> getPropertyNames(facebook::jsi::Runtime &runtime) override;
+
+  // Defines global.__deviceAiLive; must run on the JS thread
+  static void Install(facebook::jsi::Runtime &runtime, std::shared_ptr<ReactNativeDeviceAiCore::SnapshotPublisher const> latest);
+
+private:
+  class Section;
+
+  Source m_source;
+  std::array<std::shared_ptr<Section>, ReactNativeDeviceAiCore::kCollectorCount> m_sections;
+};
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,105 @@
+#include "pch.h"
+#include "MemoryCollector.h"
+
+#include <psapi.h>
+#include <winternl.h>
+
+namespace winrt::ReactNativeDeviceAiSpecs {
+
+namespace {
+
+// Leading fields of SYSTEM_PERFORMANCE_INFORMATION; winternl.h only exposes it as
+// reserved bytes. The layout has been stable since Windows XP.
+struct SystemPerformanceInformationPrefix {
+  LARGE_INTEGER IdleProcessTime;
+  LARGE_INTEGER IoReadTransferCount;
+  LARGE_INTEGER IoWriteTransferCount;
+  LARGE_INTEGER IoOtherTransferCount;
+  ULONG IoReadOperationCount;
+  ULONG IoWriteOperationCount;
+  ULONG IoOtherOperationCount;
+  ULONG AvailablePages;
+  SIZE_T CommittedPages;
+  SIZE_T CommitLimit;
+  SIZE_T PeakCommitment;
+  ULONG PageFaultCount;
+  ULONG CopyOnWriteCount;
+  ULONG TransitionCount;
+  ULONG CacheTransitionCount;
+  ULONG DemandZeroCount;
+  ULONG PageReadCount;
+  ULONG PageReadIoCount;
+};
+
+struct SystemMemoryListInformation {
+  ULONG_PTR ZeroPageCount;
+  ULONG_PTR FreePageCount;
+  ULONG_PTR ModifiedPageCount;
+  ULONG_PTR ModifiedNoWritePageCount;
+  ULONG_PTR BadPageCount;
+  ULONG_PTR PageCountByPriority[8];
+  ULONG_PTR RepurposedPagesByPriority[8];
+  ULONG_PTR ModifiedPageCountPageFile;
+};
+
+constexpr ULONG kSystemPerformanceInformation = 2;
+constexpr ULONG kSystemMemoryListInformation = 80;
+
+using NtQuerySystemInformationPtr = NTSTATUS(WINAPI *)(ULONG, PVOID, ULONG, PULONG);
+
+NtQuerySystemInformationPtr GetNtQuerySystemInformation() noexcept {
+  static auto const fn = []() -> NtQuerySystemInformationPtr {
+    HMODULE hMod = GetModuleHandle(TEXT("ntdll.dll"));
+    return hMod ? reinterpret_cast<NtQuerySystemInformationPtr>(GetProcAddress(hMod, "NtQuerySystemInformation"))
+                : nullptr;
+  }();
+  return fn;
+}
+
+} // namespace
+
+bool ReadMemoryCounters(ReactNativeDeviceAiCore::MemoryCounters &counters) noexcept {
+  PERFORMANCE_INFORMATION perfInfo{};
+  perfInfo.cb = sizeof(perfInfo);
+  if (!GetPerformanceInfo(&perfInfo, sizeof(perfInfo))) {
+    return false;
+  }
+
+  uint64_t const pageSize = perfInfo.PageSize;
+  counters.totalPhys = perfInfo.PhysicalTotal * pageSize;
+  counters.availablePhys = perfInfo.PhysicalAvailable * pageSize;
+  counters.commitTotal = perfInfo.CommitTotal * pageSize;
+  counters.commitLimit = perfInfo.CommitLimit * pageSize;
+  counters.commitPeak = perfInfo.CommitPeak * pageSize;
+  counters.systemCache = perfInfo.SystemCache * pageSize;
+  counters.kernelPaged = perfInfo.KernelPaged * pageSize;
+  counters.kernelNonpaged = perfInfo.KernelNonpaged * pageSize;
+
+  auto ntQuerySystemInformation = GetNtQuerySystemInformation();
+  if (!ntQuerySystemInformation) {
+    return true;
+  }
+
+  // Newer builds append fields to the structure, so hand the kernel a generous buffer.
+  alignas(8) BYTE perfBuffer[1024] = {};
+  if (ntQuerySystemInformation(kSystemPerformanceInformation, perfBuffer, sizeof(perfBuffer), nullptr) >= 0) {
+    auto const *systemPerf = reinterpret_cast<SystemPerformanceInformationPrefix const *>(perfBuffer);
+    counters.pageFaultCount = systemPerf->PageFaultCount;
+    counters.hardFaultCount = systemPerf->PageReadIoCount;
+  }
+
+  // Requires SeProfileSingleProcessPrivilege; unprivileged apps leave the lists unset.
+  SystemMemoryListInformation lists{};
+  if (ntQuerySystemInformation(kSystemMemoryListInformation, &lists, sizeof(lists), nullptr) >= 0) {
+    uint64_t standbyPages = 0;
+    for (auto pages : lists.PageCountByPriority) {
+      standbyPages += pages;
+    }
+    counters.standbyList = standbyPages * pageSize;
+    counters.modifiedList = static_cast<uint64_t>(lists.ModifiedPageCount) * pageSize;
+  }
+
+  return true;
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "pch.h"
+
+#include <MemoryBreakdown.h>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// Reads every memory counter the module reports in one pass:
+// GetPerformanceInfo for commit, cache and pools, plus NtQuerySystemInformation
+// for cumulative fault counts and (when permitted) standby/modified list sizes.
+bool ReadMemoryCounters(ReactNativeDeviceAiCore::MemoryCounters &counters) noexcept;
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
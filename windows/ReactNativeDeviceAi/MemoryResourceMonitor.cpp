@@ -0,0 +1,93 @@
+#include "pch.h"
+#include "MemoryResourceMonitor.h"
+
+#include <Clock.h>
+
+namespace winrt::ReactNativeDeviceAiSpecs {
+
+using namespace ReactNativeDeviceAiCore;
+
+namespace {
+
+constexpr DWORD kLowMemoryRecheckMs = 1000;
+
+} // namespace
+
+MemoryResourceMonitor::MemoryResourceMonitor(TransitionHandler onTransition) noexcept
+    : m_onTransition(std::move(onTransition)) {
+  m_lowMemory.attach(CreateMemoryResourceNotification(LowMemoryResourceNotification));
+  m_highMemory.attach(CreateMemoryResourceNotification(HighMemoryResourceNotification));
+  m_stopEvent.attach(CreateEventW(nullptr, TRUE, FALSE, nullptr));
+}
+
+MemoryResourceMonitor::~MemoryResourceMonitor() noexcept {
+  Stop();
+}
+
+void MemoryResourceMonitor::Start() noexcept {
+  std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+  if (m_thread.joinable() || !m_lowMemory || !m_highMemory || !m_stopEvent) {
+    return;
+  }
+
+  ResetEvent(m_stopEvent.get());
+  m_thread = std::thread([this]() { Run(); });
+}
+
+void MemoryResourceMonitor::Stop() noexcept {
+  std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+  if (!m_thread.joinable()) {
+    return;
+  }
+
+  SetEvent(m_stopEvent.get());
+  m_thread.join();
+}
+
+bool MemoryResourceMonitor::IsRunning() const noexcept {
+  return m_thread.joinable();
+}
+
+void MemoryResourceMonitor::Run() noexcept {
+  MemoryPressureHysteresis hysteresis;
+  auto &clock = SteadyClock::Instance();
+
+  while (true) {
+    // The notifications are level-triggered: while memory is healthy wait for
+    // the low one; while it is low wait for the high one or the re-check timeout.
+    bool low = hysteresis.Level() == MemoryPressureLevel::Low;
+    HANDLE handles[] = {m_stopEvent.get(), low ? m_highMemory.get() : m_lowMemory.get()};
+    auto waitResult = WaitForMultipleObjects(ARRAYSIZE(handles), handles, FALSE, low ? kLowMemoryRecheckMs : INFINITE);
+
+    if (waitResult == WAIT_OBJECT_0 || waitResult == WAIT_FAILED) {
+      break;
+    }
+
+    MemoryPressureLevel observed = MemoryPressureLevel::Normal;
+    if (!low) {
+      observed = MemoryPressureLevel::Low;
+    } else if (waitResult == WAIT_TIMEOUT) {
+      BOOL isLow = FALSE;
+      if (QueryMemoryResourceNotification(m_lowMemory.get(), &isLow) && isLow) {
+        observed = MemoryPressureLevel::Low;
+      }
+    }
+
+    if (auto transition = hysteresis.Observe(observed, clock.NowMs())) {
+      try {
+        m_onTransition(*transition);
+      } catch (...) {
+      }
+    }
+
+    if (low && waitResult == WAIT_OBJECT_0 + 1) {
+      // High memory stays signaled while it holds; sleep out the recovery hold
+      // instead of spinning on the signaled handle.
+      if (WaitForSingleObject(m_stopEvent.get(), kLowMemoryRecheckMs) == WAIT_OBJECT_0) {
+        break;
+      }
+    }
+  }
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "pch.h"
+
+#include <MemoryPressureHysteresis.h>
+
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// Waits on the kernel's low/high memory resource notifications from a native
+// thread and reports debounced pressure transitions. Nothing polls while memory
+// is healthy; while it is low the thread re-checks once a second so recovery
+// is noticed even before the high-memory notification fires.
+class MemoryResourceMonitor
+{
+public:
+  // Invoked on the monitor thread for every debounced transition.
+  using TransitionHandler = std::function<void(ReactNativeDeviceAiCore::MemoryPressureLevel)>;
+
+  explicit MemoryResourceMonitor(TransitionHandler onTransition) noexcept;
+  ~MemoryResourceMonitor() noexcept;
+
+  MemoryResourceMonitor(MemoryResourceMonitor const &) = delete;
+  MemoryResourceMonitor &operator=(MemoryResourceMonitor const &) = delete;
+
+  void Start() noexcept;
+  void Stop() noexcept;
+  bool IsRunning() const noexcept;
+
+private:
+  void Run() noexcept;
+
+  TransitionHandler m_onTransition;
+  winrt::handle m_lowMemory;
+  winrt::handle m_highMemory;
+  winrt::handle m_stopEvent;
+
+  std::mutex m_lifecycleMutex;
+  std::thread m_thread;
+};
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
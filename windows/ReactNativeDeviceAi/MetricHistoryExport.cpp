@@ -0,0 +1,266 @@
+#include "pch.h"
+#include "MetricHistoryExport.h"
+
+#include <ProcessTrendTracker.h>
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace winrt::ReactNativeDeviceAiSpecs {
+
+using namespace ReactNativeDeviceAiCore;
+namespace jsi = facebook::jsi;
+
+namespace {
+
+// Owns the bytes behind a JS ArrayBuffer
+template <typename T>
+class VectorBuffer final : public jsi::MutableBuffer
+{
+public:
+  explicit VectorBuffer(std::vector<T> values) noexcept : m_values(std::move(values)) {}
+
+  size_t size() const override {
+    return m_values.size() * sizeof(T);
+  }
+
+  uint8_t *data() override {
+    return reinterpret_cast<uint8_t *>(m_values.data());
+  }
+
+private:
+  std::vector<T> m_values;
+};
+
+template <typename T>
+jsi::Object TypedArray(jsi::Runtime &runtime, char const *constructor, std::vector<T> values) {
+  jsi::ArrayBuffer buffer(runtime, std::make_shared<VectorBuffer<T>>(std::move(values)));
+  return runtime.global().getPropertyAsFunction(runtime, constructor).callAsConstructor(runtime, std::move(buffer)).asObject(runtime);
+}
+
+jsi::Object Values(jsi::Runtime &runtime, std::vector<double> values, bool float64) {
+  if (float64) {
+    return TypedArray(runtime, "Float64Array", std::move(values));
+  }
+  return TypedArray(runtime, "Float32Array", std::vector<float>(values.begin(), values.end()));
+}
+
+std::vector<Metric> ParseMetrics(jsi::Runtime &runtime, jsi::Object const &options) {
+  auto metrics = options.getProperty(runtime, "metrics");
+  if (!metrics.isObject() || !metrics.asObject(runtime).isArray(runtime)) {
+    throw jsi::JSError(runtime, "metrics must be an array of metric names");
+  }
+  std::vector<Metric> parsed;
+  auto names = metrics.asObject(runtime).asArray(runtime);
+  for (size_t i = 0; i < names.size(runtime); ++i) {
+    auto name = names.getValueAtIndex(runtime, i).asString(runtime).utf8(runtime);
+    auto metric = FindMetric(name);
+    if (!metric) {
+      throw jsi::JSError(runtime, "Unknown metric: " + name);
+    }
+    parsed.push_back(*metric);
+  }
+  return parsed;
+}
+
+std::optional<double> Number(jsi::Runtime &runtime, jsi::Object const &options, char const *name) {
+  auto value = options.getProperty(runtime, name);
+  return value.isNumber() ? std::optional<double>(value.getNumber()) : std::nullopt;
+}
+
+// A finite number saturated into int64: casting NaN, infinities or numbers
+// past 2^63 is undefined
+int64_t ToInt64(jsi::Runtime &runtime, double value, char const *name) {
+  if (!std::isfinite(value)) {
+    throw jsi::JSError(runtime, std::string(name) + " must be a finite number");
+  }
+  // -2^63 and 2^63 are exact doubles
+  constexpr double kLimit = 9223372036854775808.0;
+  if (value >= kLimit) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  if (value < -kLimit) {
+    return std::numeric_limits<int64_t>::min();
+  }
+  return static_cast<int64_t>(value);
+}
+
+std::optional<int64_t> Integer(jsi::Runtime &runtime, jsi::Object const &options, char const *name) {
+  auto value = Number(runtime, options, name);
+  return value ? std::optional<int64_t>(ToInt64(runtime, *value, name)) : std::nullopt;
+}
+
+std::string StepError() {
+  return "stepMs must be positive and the range at most " + std::to_string(kMaxQueryBuckets) + " steps";
+}
+
+bool Float64(jsi::Runtime &runtime, jsi::Object const &options) {
+  auto precision = options.getProperty(runtime, "precision");
+  return precision.isString() && precision.asString(runtime).utf8(runtime) == "float64";
+}
+
+HistoryQuery ParseQuery(jsi::Runtime &runtime, jsi::Object const &options) {
+  HistoryQuery query;
+  query.metrics = ParseMetrics(runtime, options);
+
+  if (auto fromMs = Integer(runtime, options, "fromMs")) {
+    query.fromMs = *fromMs;
+  }
+  if (auto toMs = Integer(runtime, options, "toMs")) {
+    query.toMs = *toMs;
+  }
+  if (auto maxPoints = Integer(runtime, options, "maxPoints"); maxPoints && *maxPoints > 0) {
+    query.maxPoints = static_cast<size_t>(*maxPoints);
+  }
+
+  auto mode = options.getProperty(runtime, "mode");
+  if (mode.isString()) {
+    auto parsed = ParseDownsampleMode(mode.asString(runtime).utf8(runtime));
+    if (!parsed) {
+      throw jsi::JSError(runtime, "mode must be 'm4', 'lttb' or 'none'");
+    }
+    query.mode = *parsed;
+  }
+  return query;
+}
+
+MetricQuery ParseMetricQuery(jsi::Runtime &runtime, jsi::Object const &options) {
+  MetricQuery query;
+  query.metrics = ParseMetrics(runtime, options);
+
+  if (auto fromMs = Integer(runtime, options, "fromMs")) {
+    query.fromMs = *fromMs;
+  }
+  if (auto toMs = Integer(runtime, options, "toMs")) {
+    query.toMs = *toMs;
+  }
+  if (auto stepMs = Number(runtime, options, "stepMs")) {
+    // Also rejects NaN; too large a step is caught with the bucket count
+    if (!(*stepMs > 0) || std::trunc(*stepMs) != *stepMs) {
+      throw jsi::JSError(runtime, StepError());
+    }
+    query.stepMs = ToInt64(runtime, *stepMs, "stepMs");
+  }
+
+  auto aggregation = options.getProperty(runtime, "aggregation");
+  if (aggregation.isString()) {
+    auto parsed = ParseAggregation(aggregation.asString(runtime).utf8(runtime));
+    if (!parsed) {
+      throw jsi::JSError(runtime, "aggregation must be one of avg, min, max, sum, count, p50, p90, p95, p99 or rate");
+    }
+    query.aggregation = *parsed;
+  }
+  return query;
+}
+
+jsi::Object AnomalyObject(jsi::Runtime &runtime, AnomalyEvent const &event) {
+  jsi::Object object(runtime);
+  object.setProperty(runtime, "metric", jsi::String::createFromUtf8(runtime, AnomalySeriesName(event.series)));
+  object.setProperty(runtime, "phase", jsi::String::createFromAscii(runtime, ToString(event.phase)));
+  object.setProperty(runtime, "severity", jsi::String::createFromAscii(runtime, ToString(event.severity)));
+  object.setProperty(runtime, "startTime", static_cast<double>(event.startMs));
+  object.setProperty(runtime, "value", event.value);
+  object.setProperty(runtime, "expected", event.expected);
+  object.setProperty(runtime, "score", event.score);
+  object.setProperty(runtime, "peakScore", event.peakScore);
+  object.setProperty(runtime, "timestamp", static_cast<double>(event.timeMs));
+  return object;
+}
+
+jsi::Array AnomalyArray(jsi::Runtime &runtime, std::vector<AnomalyEvent> const &events) {
+  jsi::Array array(runtime, events.size());
+  for (size_t i = 0; i < events.size(); ++i) {
+    array.setValueAtIndex(runtime, i, AnomalyObject(runtime, events[i]));
+  }
+  return array;
+}
+
+} // namespace
+
+std::string AnomalySeriesName(uint64_t series) {
+  if (series < kMetricCount) {
+    return ToString(static_cast<Metric>(series));
+  }
+  if (series < kMetricCount + kProcessMetricCount) {
+    return std::string("process.") + ToString(static_cast<ProcessMetric>(series - kMetricCount));
+  }
+  return "series." + std::to_string(series);
+}
+
+void InstallMetricHistory(jsi::Runtime &runtime, std::shared_ptr<MetricHistory const> history, std::shared_ptr<AnomalyMonitor const> anomalies) {
+  auto query = [history](jsi::Runtime &runtime, jsi::Value const &, jsi::Value const *args, size_t count) -> jsi::Value {
+    if (count < 1 || !args[0].isObject()) {
+      throw jsi::JSError(runtime, "history options must be an object");
+    }
+    auto options = args[0].asObject(runtime);
+    bool float64 = Float64(runtime, options);
+
+    auto window = history->Query(ParseQuery(runtime, options));
+
+    jsi::Object result(runtime);
+    auto timestamps = TypedArray(runtime, "Float64Array", std::move(window.timestampsMs));
+    jsi::Object series(runtime);
+    for (auto &entry : window.series) {
+      jsi::Object column(runtime);
+      if (!window.decimated) {
+        column.setProperty(runtime, "timestamps", jsi::Value(runtime, timestamps));
+      } else {
+        column.setProperty(runtime, "timestamps", TypedArray(runtime, "Float64Array", std::move(entry.timestampsMs)));
+      }
+      column.setProperty(runtime, "values", Values(runtime, std::move(entry.values), float64));
+      series.setProperty(runtime, ToString(entry.metric), std::move(column));
+    }
+    result.setProperty(runtime, "timestamps", std::move(timestamps));
+    result.setProperty(runtime, "series", std::move(series));
+    return result;
+  };
+
+  runtime.global().setProperty(runtime, "__deviceAiHistory",
+      jsi::Function::createFromHostFunction(runtime, jsi::PropNameID::forAscii(runtime, "__deviceAiHistory"), 1, std::move(query)));
+
+  auto aggregate = [history](jsi::Runtime &runtime, jsi::Value const &, jsi::Value const *args, size_t count) -> jsi::Value {
+    if (count < 1 || !args[0].isObject()) {
+      throw jsi::JSError(runtime, "query options must be an object");
+    }
+    auto options = args[0].asObject(runtime);
+    bool float64 = Float64(runtime, options);
+
+    auto result = RunQuery(*history, ParseMetricQuery(runtime, options));
+    if (!result) {
+      throw jsi::JSError(runtime, StepError());
+    }
+
+    jsi::Object output(runtime);
+    output.setProperty(runtime, "stepMs", static_cast<double>(result->stepMs));
+    output.setProperty(runtime, "sourceStepMs", static_cast<double>(result->sourceStepMs));
+    output.setProperty(runtime, "timestamps", TypedArray(runtime, "Float64Array", std::move(result->timestampsMs)));
+    jsi::Object series(runtime);
+    for (auto &entry : result->series) {
+      series.setProperty(runtime, ToString(entry.metric), Values(runtime, std::move(entry.values), float64));
+    }
+    output.setProperty(runtime, "series", std::move(series));
+    return output;
+  };
+
+  runtime.global().setProperty(runtime, "__deviceAiQuery",
+      jsi::Function::createFromHostFunction(runtime, jsi::PropNameID::forAscii(runtime, "__deviceAiQuery"), 1, std::move(aggregate)));
+
+  auto anomalyLog = [anomalies](jsi::Runtime &runtime, jsi::Value const &, jsi::Value const *args, size_t count) -> jsi::Value {
+    auto sinceMs = std::numeric_limits<int64_t>::min();
+    if (count >= 1 && args[0].isNumber()) {
+      sinceMs = static_cast<int64_t>(args[0].getNumber());
+    }
+    jsi::Object output(runtime);
+    output.setProperty(runtime, "events", AnomalyArray(runtime, anomalies->Events(sinceMs)));
+    output.setProperty(runtime, "open", AnomalyArray(runtime, anomalies->Open()));
+    return output;
+  };
+
+  runtime.global().setProperty(runtime, "__deviceAiAnomalies",
+      jsi::Function::createFromHostFunction(runtime, jsi::PropNameID::forAscii(runtime, "__deviceAiAnomalies"), 1, std::move(anomalyLog)));
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
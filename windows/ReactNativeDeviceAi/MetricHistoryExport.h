@@ -0,0 +1,53 @@
+#pragma once
+
+#include "pch.h"
+
+#include <JSI/JsiApiContext.h>
+
+#include <AnomalyDetector.h>
+#include <MetricHistory.h>
+#include <MetricQuery.h>
+
+#include <memory>
+#include <string>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// Defines global.__deviceAiHistory(options), which returns a window of the
+// sampler's metric history as typed arrays over JSI ArrayBuffers:
+//
+//   { timestamps: Float64Array,
+//     series: { 'cpu.usage': { timestamps: Float64Array, values: Float32Array }, ... } }
+//
+// options: metrics (names as in getFallbackStats), fromMs/toMs (Unix ms,
+// inclusive), maxPoints and mode ('m4', 'lttb' or 'none') to decimate each
+// series natively, precision ('float32' or 'float64') for the values. A series
+// that was not decimated shares the window's timestamps array. The arrays are
+// filled natively and handed to JS without per-element marshalling.
+//
+// Also defines global.__deviceAiQuery(options), which aggregates the history
+// over fixed time buckets with RunQuery:
+//
+//   { stepMs, sourceStepMs, timestamps: Float64Array,
+//     series: { 'cpu.usage': Float32Array, ... } }
+//
+// options: metrics, fromMs/toMs, stepMs (default a minute), aggregation
+// ('avg', 'min', 'max', 'sum', 'count', 'p50', 'p90', 'p95', 'p99' or 'rate')
+// and precision. Every series shares the bucket timestamps.
+//
+// And global.__deviceAiAnomalies(sinceMs), which returns the anomaly events
+// logged since sinceMs (Unix ms, default all kept) and the anomalies still in
+// progress, shaped like deviceAiAnomaly events:
+//
+//   { events: [{ metric, phase, severity, startTime, timestamp, ... }], open: [...] }
+//
+// All must run on the JS thread.
+void InstallMetricHistory(facebook::jsi::Runtime &runtime, std::shared_ptr<ReactNativeDeviceAiCore::MetricHistory const> history,
+    std::shared_ptr<ReactNativeDeviceAiCore::AnomalyMonitor const> anomalies);
+
+// Metric name of an AnomalyMonitor series: a history metric ('cpu.usage'), or
+// a host process counter ('process.workingSet') for ids from kMetricCount on
+std::string AnomalySeriesName(uint64_t series);
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
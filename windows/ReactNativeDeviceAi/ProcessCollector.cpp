@@ -0,0 +1,54 @@
+#include "pch.h"
+#include "ProcessCollector.h"
+
+#include <psapi.h>
+#include <tlhelp32.h>
+
+namespace winrt::ReactNativeDeviceAiSpecs {
+
+namespace {
+
+std::optional<uint32_t> ReadThreadCount(DWORD processId) noexcept {
+  // file_handle treats INVALID_HANDLE_VALUE, which Toolhelp returns on failure, as empty
+  winrt::file_handle snapshot{CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0)};
+  if (!snapshot) {
+    return std::nullopt;
+  }
+
+  PROCESSENTRY32W entry{};
+  entry.dwSize = sizeof(entry);
+  for (BOOL more = Process32FirstW(snapshot.get(), &entry); more; more = Process32NextW(snapshot.get(), &entry)) {
+    if (entry.th32ProcessID == processId) {
+      return entry.cntThreads;
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace
+
+bool ReadProcessCounters(ReactNativeDeviceAiCore::ProcessCounters &counters, bool withThreadCount) noexcept {
+  auto process = GetCurrentProcess();
+
+  PROCESS_MEMORY_COUNTERS_EX memoryCounters{};
+  memoryCounters.cb = sizeof(memoryCounters);
+  if (!GetProcessMemoryInfo(process, reinterpret_cast<PROCESS_MEMORY_COUNTERS *>(&memoryCounters), sizeof(memoryCounters))) {
+    return false;
+  }
+
+  counters.privateBytes = memoryCounters.PrivateUsage;
+  counters.workingSet = memoryCounters.WorkingSetSize;
+  counters.peakWorkingSet = memoryCounters.PeakWorkingSetSize;
+  counters.pageFaultCount = memoryCounters.PageFaultCount;
+
+  DWORD handleCount = 0;
+  if (GetProcessHandleCount(process, &handleCount)) {
+    counters.handleCount = handleCount;
+  }
+  if (withThreadCount) {
+    counters.threadCount = ReadThreadCount(GetCurrentProcessId());
+  }
+  return true;
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "pch.h"
+
+#include <ProcessTrendTracker.h>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// Reads the host process's own memory, handle and thread usage via
+// GetProcessMemoryInfo, GetProcessHandleCount and a Toolhelp process snapshot.
+// The snapshot lists every process on the system, so the thread count is only
+// read when asked for.
+bool ReadProcessCounters(ReactNativeDeviceAiCore::ProcessCounters &counters, bool withThreadCount = true) noexcept;
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -1,7 +1,6 @@
 #include "pch.h"
 #include "ReactNativeDeviceAi.h"
 
-#pragma comment(lib, "wbemuuid.lib")
 #pragma comment(lib, "pdh.lib")
 #pragma comment(lib, "psapi.lib")
 #pragma comment(lib, "setupapi.lib")
@@ -9,55 +8,342 @@
 
 namespace winrt::ReactNativeDeviceAiSpecs {
 
+ReactNativeDeviceAi::~ReactNativeDeviceAi() noexcept {
+  // Join the native threads before the state they read is torn down
+  m_memoryMonitor.reset();
+  m_sampler.reset();
+  m_asyncScope.WaitIdle();
+}
+
 void ReactNativeDeviceAi::Initialize(React::ReactContext const &reactContext) noexcept {
   m_context = reactContext;
   
   // Initialize COM for WMI calls
   CoInitializeEx(NULL, COINIT_MULTITHREADED);
   
+  // Sampler is created idle; JS starts it explicitly
+  m_sampler = std::make_unique<BackgroundSampler>([this]() { return SampleTick(); });
+  m_memoryMonitor = std::make_unique<MemoryResourceMonitor>(
+      [this](ReactNativeDeviceAiCore::MemoryPressureLevel level) { OnMemoryPressure(level); });
+  
+  // Synchronous reads of the sampled snapshot and its history; skipped when the runtime has no JSI (web debugging)
+  winrt::Microsoft::ReactNative::ExecuteJsi(reactContext, [live = m_live, history = m_history, anomalies = m_anomalies, alerts = m_alerts](facebook::jsi::Runtime &runtime) {
+    LiveSnapshotHostObject::Install(runtime, live);
+    InstallMetricHistory(runtime, history, anomalies);
+    InstallAlertRules(runtime, alerts);
+  });
+  
   // Log initialization
   OutputDebugStringA("ReactNativeDeviceAi initialized successfully!\n");
 }
 
-void ReactNativeDeviceAi::getDeviceInfo(React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType> &&result) noexcept {
+template <typename T, typename Collect>
+ReactNativeDeviceAiCore::FireAndForget ReactNativeDeviceAi::ResolveInBackground(
+    React::ReactPromise<T> result, Collect collect, char const *error, [[maybe_unused]] ReactNativeDeviceAiCore::AsyncScope::Token token) noexcept {
+  co_await ReactNativeDeviceAiCore::ScheduleOn(m_backgroundExecutor);
+  
+  std::optional<T> value;
+  try {
+    value = collect();
+  } catch (...) {
+  }
+  
+  if (value) {
+    result.Resolve(*value);
+  } else {
+    result.Reject(error);
+  }
+}
+
+template <typename T, typename Collect>
+ReactNativeDeviceAiCore::FireAndForget ReactNativeDeviceAi::CompleteInBackground(
+    ReactNativeDeviceAiCore::SingleFlight<T> &flight, Collect collect, [[maybe_unused]] ReactNativeDeviceAiCore::AsyncScope::Token token) noexcept {
+  co_await ReactNativeDeviceAiCore::ScheduleOn(m_backgroundExecutor);
+  flight.Complete(collect());
+}
+
+namespace {
+
+int64_t BudgetMs(std::optional<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_CollectOptions> const &options, int64_t defaultMs) noexcept {
+  if (options && options->budgetMs && *options->budgetMs > 0) {
+    return static_cast<int64_t>(*options->budgetMs);
+  }
+  return defaultMs;
+}
+
+// Copies a deadline-bounded section into its codegen struct. A late section is
+// the collector's previous result, so live fields become last known and the
+// section ages by the time since that run. A source that has never finished
+// leaves every field unknown.
+template <typename Section>
+Section ToSection(ReactNativeDeviceAiCore::SectionResult<Section> result) {
+  if (!result.value) {
+    Section section{};
+    section.state = ReactNativeDeviceAiCore::ToString(ReactNativeDeviceAiCore::ValueState::Unknown);
+    section.stale = true;
+    return section;
+  }
+  
+  Section section = std::move(*result.value);
+  if (result.stale) {
+    if (section.state == ReactNativeDeviceAiCore::ToString(ReactNativeDeviceAiCore::ValueState::Live)) {
+      section.state = ReactNativeDeviceAiCore::ToString(ReactNativeDeviceAiCore::ValueState::LastKnown);
+    }
+    section.stale = true;
+    section.ageMs = section.ageMs.value_or(0.0) + static_cast<double>(result.ageMs);
+  }
+  return section;
+}
+
+ReactNativeDeviceAiCodegen::DeviceAISpecSpec_CollectorStats ToCollectorStats(
+    ReactNativeDeviceAiCore::CollectorStatsSnapshot const &snapshot, ReactNativeDeviceAiCore::BreakerSnapshot const &breaker) {
+  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_CollectorStats stats;
+  stats.runs = static_cast<double>(snapshot.runs);
+  stats.failures = static_cast<double>(snapshot.failures);
+  stats.timeouts = static_cast<double>(snapshot.timeouts);
+  stats.skipped = static_cast<double>(snapshot.skipped);
+  stats.lastDurationMs = snapshot.lastDurationMs;
+  stats.breaker = ReactNativeDeviceAiCore::ToString(breaker.state);
+  stats.consecutiveFailures = static_cast<double>(breaker.consecutiveFailures);
+  stats.breakerOpens = static_cast<double>(breaker.opens);
+  if (breaker.retryInMs) {
+    stats.retryInMs = static_cast<double>(*breaker.retryInMs);
+  }
+  return stats;
+}
+
+} // namespace
+
+template <typename Section>
+uint64_t ReactNativeDeviceAi::StartSection(ReactNativeDeviceAiCore::DeadlineCollector<Section> &collector) noexcept {
+  auto id = collector.Id();
+  return collector.Start(m_backgroundExecutor, [this, id]() { return ReadSection<Section>(id); }, m_asyncScope.Enter());
+}
+
+// One collector's fields through the snapshot assembler. A read with no live
+// field counts as a collector failure, which feeds its circuit breaker.
+template <typename Section>
+std::optional<Section> ReactNativeDeviceAi::ReadSection(ReactNativeDeviceAiCore::Collector collector) noexcept {
+  try {
+    ReactNativeDeviceAiCore::DeviceSnapshot snapshot;
+    if (!m_assembler.Collect(collector, snapshot, ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs())) {
+      return std::nullopt;
+    }
+    Section section{};
+    Marshal(snapshot, section);
+    return section;
+  } catch (...) {
+    return std::nullopt;
+  }
+}
+
+ReactNativeDeviceAiCore::DeviceSnapshot ReactNativeDeviceAi::CollectIdentity() noexcept {
+  ReactNativeDeviceAiCore::DeviceSnapshot snapshot;
+  m_assembler.CollectIdentity(snapshot, ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs());
+  return snapshot;
+}
+
+void ReactNativeDeviceAi::getDeviceInfo(std::optional<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_CollectOptions> options, React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType> &&result) noexcept {
+  auto waiter = [result](std::optional<DeviceInfo> const &deviceInfo) {
+    if (deviceInfo) {
+      result.Resolve(*deviceInfo);
+    } else {
+      result.Reject("Failed to gather device information");
+    }
+  };
+  
+  if (m_deviceInfoFlight.Join(std::move(waiter))) {
+    // Coalesced callers share the leader's budget
+    auto budgetMs = BudgetMs(options, kDefaultBudgetMs);
+    CompleteInBackground(m_deviceInfoFlight, [this, budgetMs]() { return CollectDeviceInfo(budgetMs); }, m_asyncScope.Enter());
+  }
+}
+
+void ReactNativeDeviceAi::getWindowsSystemInfo(std::optional<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_CollectOptions> options, React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType> &&result) noexcept {
+  auto waiter = [result](std::optional<WindowsSystemInfo> const &windowsInfo) {
+    if (windowsInfo) {
+      result.Resolve(*windowsInfo);
+    } else {
+      result.Reject("Failed to gather Windows system information");
+    }
+  };
+  
+  if (m_systemInfoFlight.Join(std::move(waiter))) {
+    auto budgetMs = BudgetMs(options, kDefaultBudgetMs);
+    CompleteInBackground(m_systemInfoFlight, [this, budgetMs]() { return CollectWindowsSystemInfo(budgetMs); }, m_asyncScope.Enter());
+  }
+}
+
+void ReactNativeDeviceAi::setCoalescingWindow(double windowMs) noexcept {
+  auto freshnessMs = static_cast<int64_t>(std::max(0.0, windowMs));
+  m_deviceInfoFlight.SetFreshnessMs(freshnessMs);
+  m_systemInfoFlight.SetFreshnessMs(freshnessMs);
+}
+
+std::optional<ReactNativeDeviceAi::DeviceInfo> ReactNativeDeviceAi::CollectDeviceInfo(int64_t budgetMs) noexcept {
   try {
-    ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType deviceInfo;
+    DeviceInfo deviceInfo;
+    auto startMs = ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs();
+    
+    // Start every source at once so the slowest one bounds the call, not their sum
+    auto memory = StartSection(m_memoryCollector);
+    auto storage = StartSection(m_storageCollector);
+    auto battery = StartSection(m_batteryCollector);
+    auto cpu = StartSection(m_cpuCollector);
+    auto network = StartSection(m_networkCollector);
     
     // Basic platform info
+    auto identity = CollectIdentity();
     deviceInfo.platform = "windows";
-    deviceInfo.osVersion = GetOSVersion();
-    deviceInfo.deviceModel = GetProcessorInfo();
+    deviceInfo.osVersion = Marshalling::Text(identity, ReactNativeDeviceAiCore::TextField::OsVersion);
+    deviceInfo.deviceModel = Marshalling::Text(identity, ReactNativeDeviceAiCore::TextField::Processor);
     
     // Gather system information
-    deviceInfo.memory = GetMemoryInfo();
-    deviceInfo.storage = GetStorageInfo();
-    deviceInfo.battery = GetBatteryInfo();
-    deviceInfo.cpu = GetCpuInfo();
-    deviceInfo.network = GetNetworkInfo();
+    deviceInfo.memory = ToSection(m_memoryCollector.Await(memory, startMs, budgetMs));
+    deviceInfo.storage = ToSection(m_storageCollector.Await(storage, startMs, budgetMs));
+    deviceInfo.battery = ToSection(m_batteryCollector.Await(battery, startMs, budgetMs));
+    deviceInfo.cpu = ToSection(m_cpuCollector.Await(cpu, startMs, budgetMs));
+    deviceInfo.network = ToSection(m_networkCollector.Await(network, startMs, budgetMs));
     
-    result.Resolve(deviceInfo);
+    return deviceInfo;
   } catch (...) {
-    result.Reject("Failed to gather device information");
+    return std::nullopt;
   }
 }
 
-void ReactNativeDeviceAi::getWindowsSystemInfo(React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType> &&result) noexcept {
+std::optional<ReactNativeDeviceAi::WindowsSystemInfo> ReactNativeDeviceAi::CollectWindowsSystemInfo(int64_t budgetMs) noexcept {
   try {
-    ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType windowsInfo;
+    WindowsSystemInfo windowsInfo;
+    auto startMs = ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs();
+    
+    auto performance = StartSection(m_performanceCollector);
+    auto wmi = StartSection(m_wmiCollector);
     
-    windowsInfo.osVersion = GetOSVersion();
-    windowsInfo.buildNumber = GetBuildNumber();
-    windowsInfo.processor = GetProcessorInfo();
-    windowsInfo.architecture = GetSystemArchitecture();
-    windowsInfo.performanceCounters = GetPerformanceCounters();
-    windowsInfo.wmiData = GetWmiData();
+    auto identity = CollectIdentity();
+    windowsInfo.osVersion = Marshalling::Text(identity, ReactNativeDeviceAiCore::TextField::OsVersion);
+    windowsInfo.buildNumber = Marshalling::Text(identity, ReactNativeDeviceAiCore::TextField::BuildNumber);
+    windowsInfo.processor = Marshalling::Text(identity, ReactNativeDeviceAiCore::TextField::Processor);
+    windowsInfo.architecture = Marshalling::Text(identity, ReactNativeDeviceAiCore::TextField::Architecture);
+    windowsInfo.performanceCounters = ToSection(m_performanceCollector.Await(performance, startMs, budgetMs));
+    windowsInfo.wmiData = ToSection(m_wmiCollector.Await(wmi, startMs, budgetMs));
     
-    result.Resolve(windowsInfo);
+    return windowsInfo;
   } catch (...) {
-    result.Reject("Failed to gather Windows system information");
+    return std::nullopt;
   }
 }
 
+ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getCollectorStats_returnType ReactNativeDeviceAi::getCollectorStats() noexcept {
+  using ReactNativeDeviceAiCore::Collector;
+  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getCollectorStats_returnType stats;
+  stats.memory = ToCollectorStats(m_collectorStats.Snapshot(Collector::Memory), m_memoryCollector.Breaker());
+  stats.storage = ToCollectorStats(m_collectorStats.Snapshot(Collector::Storage), m_storageCollector.Breaker());
+  stats.battery = ToCollectorStats(m_collectorStats.Snapshot(Collector::Battery), m_batteryCollector.Breaker());
+  stats.cpu = ToCollectorStats(m_collectorStats.Snapshot(Collector::Cpu), m_cpuCollector.Breaker());
+  stats.network = ToCollectorStats(m_collectorStats.Snapshot(Collector::Network), m_networkCollector.Breaker());
+  stats.performanceCounters = ToCollectorStats(m_collectorStats.Snapshot(Collector::PerformanceCounters), m_performanceCollector.Breaker());
+  stats.wmi = ToCollectorStats(m_collectorStats.Snapshot(Collector::Wmi), m_wmiCollector.Breaker());
+  return stats;
+}
+
+std::vector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_SpanDiagnostics> ReactNativeDeviceAi::getDiagnostics() noexcept {
+  constexpr double kNsPerMs = 1e6;
+  std::vector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_SpanDiagnostics> result;
+  result.reserve(ReactNativeDeviceAiCore::kSpanCount);
+  for (size_t i = 0; i < ReactNativeDeviceAiCore::kSpanCount; ++i) {
+    auto span = static_cast<ReactNativeDeviceAiCore::Span>(i);
+    auto stats = m_spans.Snapshot(span);
+    
+    ReactNativeDeviceAiCodegen::DeviceAISpecSpec_SpanDiagnostics diagnostics;
+    diagnostics.name = ReactNativeDeviceAiCore::ToString(span);
+    diagnostics.calls = static_cast<double>(stats.calls);
+    diagnostics.failures = static_cast<double>(stats.failures);
+    diagnostics.fallbacks = static_cast<double>(stats.fallbacks);
+    diagnostics.p50Ms = static_cast<double>(stats.latency.p50Ns) / kNsPerMs;
+    diagnostics.p90Ms = static_cast<double>(stats.latency.p90Ns) / kNsPerMs;
+    diagnostics.p99Ms = static_cast<double>(stats.latency.p99Ns) / kNsPerMs;
+    diagnostics.maxMs = static_cast<double>(stats.latency.maxNs) / kNsPerMs;
+    diagnostics.meanMs = stats.calls ? static_cast<double>(stats.latency.sumNs) / kNsPerMs / static_cast<double>(stats.calls) : 0.0;
+    result.push_back(std::move(diagnostics));
+  }
+  return result;
+}
+
+void ReactNativeDeviceAi::setTracingEnabled(bool enabled) noexcept {
+  auto &trace = ReactNativeDeviceAiCore::TraceRecorder::Instance();
+  if (enabled && !trace.Enabled()) {
+    // Each tracing session starts from an empty buffer
+    trace.Clear();
+  }
+  trace.SetEnabled(enabled);
+}
+
+void ReactNativeDeviceAi::getTraceEvents(React::ReactPromise<std::string> &&result) noexcept {
+  ResolveInBackground(std::move(result), []() -> std::optional<std::string> {
+    return ReactNativeDeviceAiCore::TraceRecorder::Instance().ToChromeJson();
+  }, "Failed to export trace events", m_asyncScope.Enter());
+}
+
+void ReactNativeDeviceAi::writeTraceFile(std::string path, React::ReactPromise<std::string> &&result) noexcept {
+  ResolveInBackground(std::move(result), [path = std::move(path)]() -> std::optional<std::string> {
+    if (!ReactNativeDeviceAiCore::TraceRecorder::Instance().WriteChromeJson(path)) {
+      return std::nullopt;
+    }
+    return path;
+  }, "Failed to write trace file", m_asyncScope.Enter());
+}
+
+std::vector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_FieldStats> ReactNativeDeviceAi::getFallbackStats() noexcept {
+  std::vector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_FieldStats> result;
+  for (auto const &field : m_assembler.FallbackStats(ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs())) {
+    ReactNativeDeviceAiCodegen::DeviceAISpecSpec_FieldStats stats;
+    stats.field = field.name;
+    if (field.source) {
+      stats.source = field.source;
+    }
+    if (field.lastGoodAgeMs) {
+      stats.lastGoodAgeMs = static_cast<double>(*field.lastGoodAgeMs);
+    }
+    stats.live = static_cast<double>(field.live);
+    stats.lastKnown = static_cast<double>(field.lastKnown);
+    stats.unknown = static_cast<double>(field.unknown);
+    result.push_back(std::move(stats));
+  }
+  return result;
+}
+
+void ReactNativeDeviceAi::getMemoryBreakdown(React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getMemoryBreakdown_returnType> &&result) noexcept {
+  using MemoryBreakdownResult = ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getMemoryBreakdown_returnType;
+  ResolveInBackground(std::move(result), [this]() -> std::optional<MemoryBreakdownResult> {
+    auto breakdown = m_provider.ReadMemoryBreakdown();
+    if (!breakdown) {
+      return std::nullopt;
+    }
+  
+    auto const &counters = breakdown->counters;
+    MemoryBreakdownResult memory;
+    memory.total = static_cast<double>(counters.totalPhys);
+    memory.available = static_cast<double>(counters.availablePhys);
+    memory.commitTotal = static_cast<double>(counters.commitTotal);
+    memory.commitLimit = static_cast<double>(counters.commitLimit);
+    memory.commitPeak = static_cast<double>(counters.commitPeak);
+    memory.commitUsage = breakdown->commitPercent;
+    memory.systemCache = static_cast<double>(counters.systemCache);
+    memory.kernelPaged = static_cast<double>(counters.kernelPaged);
+    memory.kernelNonpaged = static_cast<double>(counters.kernelNonpaged);
+    if (counters.standbyList) {
+      memory.standby = static_cast<double>(*counters.standbyList);
+    }
+    if (counters.modifiedList) {
+      memory.modified = static_cast<double>(*counters.modifiedList);
+    }
+    memory.pageFaultsPerSec = breakdown->pageFaultsPerSec;
+    memory.hardFaultsPerSec = breakdown->hardFaultsPerSec;
+  
+    return memory;
+  }, "Failed to gather memory breakdown", m_asyncScope.Enter());
+}
+
 bool ReactNativeDeviceAi::isNativeModuleAvailable() noexcept {
   return true;
 }
@@ -73,497 +359,364 @@ std::vector<std::string> ReactNativeDeviceAi::getSupportedFeatures() noexcept {
     "storage-info",
     "battery-info",
     "cpu-info",
-    "network-info"
+    "network-info",
+    "memory-breakdown",
+    "memory-pressure-events",
+    "process-profile",
+    "request-coalescing",
+    "collector-deadlines",
+    "collector-circuit-breakers",
+    "latency-diagnostics",
+    "trace-events",
+    "last-known-values",
+    "adaptive-sampling",
+    "live-snapshot",
+    "metric-history",
+    "metric-query",
+    "anomaly-detection",
+    "alert-rules"
   };
 }
 
-// Helper method implementations
+void ReactNativeDeviceAi::startSampling() noexcept {
+  if (m_sampler) {
+    m_sampler->Start();
+  }
+}
 
-ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_memory ReactNativeDeviceAi::GetMemoryInfo() noexcept {
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_memory memInfo;
-  
-  try {
-    MEMORYSTATUSEX memStatus;
-    memStatus.dwLength = sizeof(memStatus);
-    
-    if (GlobalMemoryStatusEx(&memStatus)) {
-      memInfo.total = static_cast<double>(memStatus.ullTotalPhys);
-      memInfo.available = static_cast<double>(memStatus.ullAvailPhys);
-    } else {
-      // Fallback values
-      memInfo.total = 8589934592.0; // 8GB
-      memInfo.available = 4294967296.0; // 4GB
-    }
-  } catch (...) {
-    memInfo.total = 8589934592.0;
-    memInfo.available = 4294967296.0;
+void ReactNativeDeviceAi::stopSampling() noexcept {
+  if (m_sampler) {
+    m_sampler->Stop();
   }
-  
-  return memInfo;
 }
 
-ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_storage ReactNativeDeviceAi::GetStorageInfo() noexcept {
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_storage storageInfo;
-  
-  try {
-    ULARGE_INTEGER freeBytesAvailable, totalNumberOfBytes, totalNumberOfFreeBytes;
-    
-    if (GetDiskFreeSpaceEx(L"C:\\", &freeBytesAvailable, &totalNumberOfBytes, &totalNumberOfFreeBytes)) {
-      storageInfo.total = static_cast<double>(totalNumberOfBytes.QuadPart);
-      storageInfo.available = static_cast<double>(freeBytesAvailable.QuadPart);
-    } else {
-      // Fallback values
-      storageInfo.total = 549755813888.0; // 512GB
-      storageInfo.available = 274877906944.0; // 256GB
-    }
-  } catch (...) {
-    storageInfo.total = 549755813888.0;
-    storageInfo.available = 274877906944.0;
+void ReactNativeDeviceAi::setAppForeground(bool foreground) noexcept {
+  if (m_sampler) {
+    m_sampler->SetForeground(foreground);
   }
-  
-  return storageInfo;
 }
 
-ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_battery ReactNativeDeviceAi::GetBatteryInfo() noexcept {
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_battery batteryInfo;
-  
-  try {
-    using namespace winrt::Windows::System::Power;
-    
-    // Use Windows Battery API through power manager
-    auto batteryStatus = PowerManager::BatteryStatus();
-    
-    // Get battery level from power manager
-    if (batteryStatus != BatteryStatus::NotPresent) {
-      // Try to get battery level through power APIs
-      SYSTEM_POWER_STATUS powerStatus;
-      if (GetSystemPowerStatus(&powerStatus)) {
-        if (powerStatus.BatteryLifePercent != 255) {
-          batteryInfo.level = static_cast<double>(powerStatus.BatteryLifePercent);
-        } else {
-          batteryInfo.level = 85.0; // Default when unknown
-        }
-        
-        batteryInfo.isCharging = (powerStatus.ACLineStatus == 1) && 
-                                (powerStatus.BatteryFlag & 8) == 0; // Not unknown and AC connected
-      } else {
-        batteryInfo.level = 85.0;
-        batteryInfo.isCharging = false;
-      }
-    } else {
-      // Desktop/AC powered system - assume no battery or full charge
-      batteryInfo.level = 100.0;
-      batteryInfo.isCharging = false;
-    }
-  } catch (...) {
-    // Fallback using Win32 API
-    try {
-      SYSTEM_POWER_STATUS powerStatus;
-      if (GetSystemPowerStatus(&powerStatus)) {
-        if (powerStatus.BatteryLifePercent != 255) {
-          batteryInfo.level = static_cast<double>(powerStatus.BatteryLifePercent);
-        } else {
-          batteryInfo.level = 85.0;
-        }
-        batteryInfo.isCharging = powerStatus.ACLineStatus == 1;
-      } else {
-        batteryInfo.level = 85.0;
-        batteryInfo.isCharging = false;
-      }
-    } catch (...) {
-      batteryInfo.level = 85.0;
-      batteryInfo.isCharging = false;
-    }
+ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getSamplerDiagnostics_returnType ReactNativeDeviceAi::getSamplerDiagnostics() noexcept {
+  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getSamplerDiagnostics_returnType diagnostics{};
+  if (!m_sampler) {
+    diagnostics.policy = "unavailable";
+    diagnostics.powerSource = "unknown";
+    return diagnostics;
   }
   
-  return batteryInfo;
+  auto samplerDiagnostics = m_sampler->Diagnostics();
+  diagnostics.running = m_sampler->IsRunning();
+  diagnostics.policy = ReactNativeDeviceAiCore::ToString(samplerDiagnostics.decision.policy);
+  diagnostics.intervalMs = static_cast<double>(samplerDiagnostics.decision.intervalMs);
+  diagnostics.tolerableDelayMs = static_cast<double>(samplerDiagnostics.decision.tolerableDelayMs);
+  diagnostics.wakeupsPerMinute = samplerDiagnostics.wakeupsPerMinute;
+  diagnostics.totalWakeups = static_cast<double>(samplerDiagnostics.totalWakeups);
+  diagnostics.volatility = samplerDiagnostics.volatility;
+  diagnostics.powerSource = ReactNativeDeviceAiCore::ToString(samplerDiagnostics.inputs.powerSource);
+  diagnostics.energySaver = samplerDiagnostics.inputs.energySaver;
+  diagnostics.foreground = samplerDiagnostics.inputs.foreground;
+  return diagnostics;
 }
 
-ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_cpu ReactNativeDeviceAi::GetCpuInfo() noexcept {
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_cpu cpuInfo;
-  
-  try {
-    SYSTEM_INFO sysInfo;
-    GetSystemInfo(&sysInfo);
-    cpuInfo.cores = static_cast<double>(sysInfo.dwNumberOfProcessors);
-    
-    // Get CPU usage using PDH
-    PDH_HQUERY query;
-    PDH_HCOUNTER counter;
-    
-    if (PdhOpenQuery(NULL, 0, &query) == ERROR_SUCCESS) {
-      if (PdhAddEnglishCounter(query, L"\\Processor(_Total)\\% Processor Time", 0, &counter) == ERROR_SUCCESS) {
-        PdhCollectQueryData(query);
-        Sleep(100); // Brief delay for accurate reading
-        PdhCollectQueryData(query);
-        
-        PDH_FMT_COUNTERVALUE value;
-        if (PdhGetFormattedCounterValue(counter, PDH_FMT_DOUBLE, NULL, &value) == ERROR_SUCCESS) {
-          cpuInfo.usage = value.doubleValue;
-        } else {
-          cpuInfo.usage = 25.0; // Default
-        }
-        
-        PdhCloseQuery(query);
-      } else {
-        cpuInfo.usage = 25.0;
-      }
-    } else {
-      cpuInfo.usage = 25.0;
-    }
-  } catch (...) {
-    cpuInfo.cores = 8.0;
-    cpuInfo.usage = 25.0;
+void ReactNativeDeviceAi::startMemoryMonitoring() noexcept {
+  if (m_memoryMonitor) {
+    m_memoryMonitor->Start();
+  }
+}
+
+void ReactNativeDeviceAi::stopMemoryMonitoring() noexcept {
+  if (m_memoryMonitor) {
+    m_memoryMonitor->Stop();
   }
-  
-  return cpuInfo;
 }
 
-ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_network ReactNativeDeviceAi::GetNetworkInfo() noexcept {
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_network networkInfo;
+void ReactNativeDeviceAi::getProcessProfile(React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getProcessProfile_returnType> &&result) noexcept {
+  using ProcessProfile = ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getProcessProfile_returnType;
+  ResolveInBackground(std::move(result), [this]() -> std::optional<ProcessProfile> {
+    ReactNativeDeviceAiCore::ProcessCounters counters;
+    if (!ReadProcessCounters(counters)) {
+      return std::nullopt;
+    }
   
+    auto toTrend = [this](ReactNativeDeviceAiCore::ProcessMetric metric) {
+      auto trend = m_processTrends.Trend(metric);
+      ReactNativeDeviceAiCodegen::DeviceAISpecSpec_ProcessTrend processTrend;
+      processTrend.verdict = ReactNativeDeviceAiCore::ToString(trend.verdict);
+      processTrend.slopePerHour = trend.slopePerHour;
+      processTrend.monotonicFraction = trend.monotonicFraction;
+      processTrend.samples = static_cast<double>(trend.samples);
+      return processTrend;
+    };
+  
+    ProcessProfile profile;
+    profile.privateBytes = static_cast<double>(counters.privateBytes);
+    profile.workingSet = static_cast<double>(counters.workingSet);
+    profile.peakWorkingSet = static_cast<double>(counters.peakWorkingSet);
+    profile.handleCount = static_cast<double>(counters.handleCount);
+    profile.threadCount = static_cast<double>(counters.threadCount.value_or(0));
+    profile.pageFaultsPerSec = m_processTrends.PageFaultsPerSec();
+    profile.trends.privateBytes = toTrend(ReactNativeDeviceAiCore::ProcessMetric::PrivateBytes);
+    profile.trends.workingSet = toTrend(ReactNativeDeviceAiCore::ProcessMetric::WorkingSet);
+    profile.trends.handleCount = toTrend(ReactNativeDeviceAiCore::ProcessMetric::HandleCount);
+    profile.trends.threadCount = toTrend(ReactNativeDeviceAiCore::ProcessMetric::ThreadCount);
+  
+    return profile;
+  }, "Failed to gather process profile", m_asyncScope.Enter());
+}
+
+// Runs on the sampler thread; verdict changes are pushed to JS as deviceAiProcessTrend events
+void ReactNativeDeviceAi::TrackProcessTrends() noexcept {
   try {
-    using namespace winrt::Windows::Networking::Connectivity;
+    auto nowMs = ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs();
+    bool withThreadCount = nowMs >= m_nextThreadCountMs;
+    ReactNativeDeviceAiCore::ProcessCounters counters;
+    if (!ReadProcessCounters(counters, withThreadCount)) {
+      return;
+    }
+    if (withThreadCount) {
+      m_nextThreadCountMs = nowMs + kThreadCountIntervalMs;
+    }
     
-    auto connectionProfile = NetworkInformation::GetInternetConnectionProfile();
-    if (connectionProfile) {
-      networkInfo.isConnected = true;
-      
-      auto networkAdapter = connectionProfile.NetworkAdapter();
-      if (networkAdapter) {
-        auto ianaType = networkAdapter.IanaInterfaceType();
-        
-        switch (ianaType) {
-          case 6:   // Ethernet
-            networkInfo.type = "ethernet";
-            break;
-          case 71:  // WiFi
-            networkInfo.type = "wifi";
-            break;
-          case 244: // WWWLAN (cellular)
-            networkInfo.type = "cellular";
-            break;
-          default:
-            networkInfo.type = "unknown";
-            break;
-        }
-      } else {
-        networkInfo.type = "unknown";
+    auto changes = m_processTrends.Track(counters, nowMs);
+    for (auto const &change : changes) {
+      React::JSValueObject payload;
+      payload["metric"] = std::string(ReactNativeDeviceAiCore::ToString(change.metric));
+      payload["verdict"] = std::string(ReactNativeDeviceAiCore::ToString(change.current.verdict));
+      payload["previousVerdict"] = std::string(ReactNativeDeviceAiCore::ToString(change.previous));
+      payload["slopePerHour"] = change.current.slopePerHour;
+      payload["value"] = change.value;
+      payload["timestamp"] = static_cast<double>(
+          std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+      m_context.EmitJSEvent(L"RCTDeviceEventEmitter", L"deviceAiProcessTrend", std::move(payload));
+    }
+
+    // Series after the history metrics, in ProcessMetric order
+    auto unixMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::vector<ReactNativeDeviceAiCore::AnomalyEvent> anomalies;
+    for (size_t i = 0; i < ReactNativeDeviceAiCore::kProcessMetricCount; ++i) {
+      auto metric = static_cast<ReactNativeDeviceAiCore::ProcessMetric>(i);
+      auto value = ReactNativeDeviceAiCore::ProcessTrendTracker::Value(counters, metric);
+      if (auto event = m_anomalies->Observe(ReactNativeDeviceAiCore::kMetricCount + i, unixMs, value)) {
+        anomalies.push_back(*event);
       }
-    } else {
-      networkInfo.isConnected = false;
-      networkInfo.type = "none";
     }
+    EmitAnomalies(anomalies);
   } catch (...) {
-    networkInfo.isConnected = true;
-    networkInfo.type = "wifi";
+    OutputDebugStringA("ReactNativeDeviceAi failed to track process trends\n");
   }
-  
-  return networkInfo;
 }
 
-ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters ReactNativeDeviceAi::GetPerformanceCounters() noexcept {
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters perfCounters;
-  
+// Runs on the monitor thread; the breakdown is captured at the moment of transition
+void ReactNativeDeviceAi::OnMemoryPressure(ReactNativeDeviceAiCore::MemoryPressureLevel level) noexcept {
   try {
-    PDH_HQUERY query;
-    PDH_HCOUNTER cpuCounter, memCounter, diskCounter;
+    React::JSValueObject payload;
+    payload["level"] = std::string(ReactNativeDeviceAiCore::ToString(level));
+    payload["timestamp"] = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
     
-    if (PdhOpenQuery(NULL, 0, &query) == ERROR_SUCCESS) {
-      PdhAddEnglishCounter(query, L"\\Processor(_Total)\\% Processor Time", 0, &cpuCounter);
-      PdhAddEnglishCounter(query, L"\\Memory\\% Committed Bytes In Use", 0, &memCounter);
-      PdhAddEnglishCounter(query, L"\\PhysicalDisk(_Total)\\% Disk Time", 0, &diskCounter);
-      
-      PdhCollectQueryData(query);
-      Sleep(100);
-      PdhCollectQueryData(query);
-      
-      PDH_FMT_COUNTERVALUE value;
-      
-      // CPU Usage
-      if (PdhGetFormattedCounterValue(cpuCounter, PDH_FMT_DOUBLE, NULL, &value) == ERROR_SUCCESS) {
-        perfCounters.cpuUsage = value.doubleValue;
-      } else {
-        perfCounters.cpuUsage = 25.0;
+    if (auto breakdown = m_provider.ReadMemoryBreakdown()) {
+      auto const &counters = breakdown->counters;
+      React::JSValueObject memory;
+      memory["total"] = static_cast<double>(counters.totalPhys);
+      memory["available"] = static_cast<double>(counters.availablePhys);
+      memory["commitTotal"] = static_cast<double>(counters.commitTotal);
+      memory["commitLimit"] = static_cast<double>(counters.commitLimit);
+      memory["commitUsage"] = breakdown->commitPercent;
+      memory["systemCache"] = static_cast<double>(counters.systemCache);
+      if (counters.standbyList) {
+        memory["standby"] = static_cast<double>(*counters.standbyList);
       }
-      
-      // Memory Usage
-      if (PdhGetFormattedCounterValue(memCounter, PDH_FMT_DOUBLE, NULL, &value) == ERROR_SUCCESS) {
-        perfCounters.memoryUsage = value.doubleValue;
-      } else {
-        perfCounters.memoryUsage = 65.0;
-      }
-      
-      // Disk Usage
-      if (PdhGetFormattedCounterValue(diskCounter, PDH_FMT_DOUBLE, NULL, &value) == ERROR_SUCCESS) {
-        perfCounters.diskUsage = value.doubleValue;
-      } else {
-        perfCounters.diskUsage = 15.0;
+      if (counters.modifiedList) {
+        memory["modified"] = static_cast<double>(*counters.modifiedList);
       }
-      
-      PdhCloseQuery(query);
-    } else {
-      perfCounters.cpuUsage = 25.0;
-      perfCounters.memoryUsage = 65.0;
-      perfCounters.diskUsage = 15.0;
+      memory["pageFaultsPerSec"] = breakdown->pageFaultsPerSec;
+      memory["hardFaultsPerSec"] = breakdown->hardFaultsPerSec;
+      payload["memory"] = std::move(memory);
     }
+    
+    m_context.EmitJSEvent(L"RCTDeviceEventEmitter", L"deviceAiMemoryPressure", std::move(payload));
   } catch (...) {
-    perfCounters.cpuUsage = 25.0;
-    perfCounters.memoryUsage = 65.0;
-    perfCounters.diskUsage = 15.0;
+    OutputDebugStringA("ReactNativeDeviceAi failed to emit memory pressure event\n");
   }
-  
-  return perfCounters;
 }
 
-ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData ReactNativeDeviceAi::GetWmiData() noexcept {
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData wmiData;
+// Runs on the sampler thread. The provider's PDH query stays open between
+// wakeups, so each tick is a single collection with no settling delay.
+double ReactNativeDeviceAi::SampleTick() noexcept {
+  TrackProcessTrends();
+  // One memory breakdown and one PDH collection per tick, shared by the
+  // snapshot's collectors: the fault rates and CPU usage cover the interval
+  // between ticks
+  m_provider.ReadMemoryBreakdown();
+  auto counters = m_provider.CollectCounters();
+  PublishLiveSnapshot();
   
+  // Unknown only when PDH is unavailable
+  return counters.cpuUsage.value_or(std::numeric_limits<double>::quiet_NaN());
+}
+
+// Runs on the sampler thread, the publisher's only writer
+void ReactNativeDeviceAi::PublishLiveSnapshot() noexcept {
   try {
-    HRESULT hres;
-    IWbemLocator *pLoc = NULL;
-    IWbemServices *pSvc = NULL;
+    auto nowMs = ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs();
+    auto snapshot = m_live->Latest();
     
-    // Initialize WMI
-    hres = CoCreateInstance(
-        CLSID_WbemLocator,
-        0,
-        CLSCTX_INPROC_SERVER,
-        IID_IWbemLocator, (LPVOID *)&pLoc);
+    for (auto collector : {ReactNativeDeviceAiCore::Collector::Memory, ReactNativeDeviceAiCore::Collector::Storage,
+             ReactNativeDeviceAiCore::Collector::Battery, ReactNativeDeviceAiCore::Collector::Cpu,
+             ReactNativeDeviceAiCore::Collector::Network, ReactNativeDeviceAiCore::Collector::PerformanceCounters}) {
+      m_assembler.Collect(collector, snapshot, nowMs);
+    }
     
-    if (SUCCEEDED(hres)) {
-      hres = pLoc->ConnectServer(
-          _bstr_t(L"ROOT\\CIMV2"),
-          NULL, NULL, 0, NULL, 0, 0, &pSvc);
-      
-      if (SUCCEEDED(hres)) {
-        // Set security levels
-        CoSetProxyBlanket(
-            pSvc,
-            RPC_C_AUTHN_WINNT,
-            RPC_C_AUTHZ_NONE,
-            NULL,
-            RPC_C_AUTHN_LEVEL_CALL,
-            RPC_C_IMP_LEVEL_IMPERSONATE,
-            NULL,
-            EOAC_NONE);
-        
-        // Query computer system
-        IEnumWbemClassObject* pEnumerator = NULL;
-        hres = pSvc->ExecQuery(
-            bstr_t("WQL"),
-            bstr_t("SELECT * FROM Win32_ComputerSystem"),
-            WBEM_FLAG_FORWARD_ONLY | WBEM_FLAG_RETURN_IMMEDIATELY,
-            NULL,
-            &pEnumerator);
-        
-        if (SUCCEEDED(hres)) {
-          IWbemClassObject *pclsObj = NULL;
-          ULONG uReturn = 0;
-          
-          while (pEnumerator) {
-            HRESULT hr = pEnumerator->Next(WBEM_INFINITE, 1, &pclsObj, &uReturn);
-            if (0 == uReturn) break;
-            
-            VARIANT vtProp;
-            hr = pclsObj->Get(L"Model", 0, &vtProp, 0, 0);
-            if (SUCCEEDED(hr) && vtProp.vt == VT_BSTR) {
-              wmiData.computerSystem = _com_util::ConvertBSTRToString(vtProp.bstrVal);
-            }
-            VariantClear(&vtProp);
-            
-            pclsObj->Release();
-            break;
-          }
-          pEnumerator->Release();
-        }
-        
-        // Query operating system
-        pEnumerator = NULL;
-        hres = pSvc->ExecQuery(
-            bstr_t("WQL"),
-            bstr_t("SELECT * FROM Win32_OperatingSystem"),
-            WBEM_FLAG_FORWARD_ONLY | WBEM_FLAG_RETURN_IMMEDIATELY,
-            NULL,
-            &pEnumerator);
-        
-        if (SUCCEEDED(hres)) {
-          IWbemClassObject *pclsObj = NULL;
-          ULONG uReturn = 0;
-          
-          while (pEnumerator) {
-            HRESULT hr = pEnumerator->Next(WBEM_INFINITE, 1, &pclsObj, &uReturn);
-            if (0 == uReturn) break;
-            
-            VARIANT vtProp;
-            hr = pclsObj->Get(L"Caption", 0, &vtProp, 0, 0);
-            if (SUCCEEDED(hr) && vtProp.vt == VT_BSTR) {
-              wmiData.operatingSystem = _com_util::ConvertBSTRToString(vtProp.bstrVal);
-            }
-            VariantClear(&vtProp);
-            
-            pclsObj->Release();
-            break;
-          }
-          pEnumerator->Release();
-        }
-        
-        // Query processor
-        pEnumerator = NULL;
-        hres = pSvc->ExecQuery(
-            bstr_t("WQL"),
-            bstr_t("SELECT * FROM Win32_Processor"),
-            WBEM_FLAG_FORWARD_ONLY | WBEM_FLAG_RETURN_IMMEDIATELY,
-            NULL,
-            &pEnumerator);
-        
-        if (SUCCEEDED(hres)) {
-          IWbemClassObject *pclsObj = NULL;
-          ULONG uReturn = 0;
-          
-          while (pEnumerator) {
-            HRESULT hr = pEnumerator->Next(WBEM_INFINITE, 1, &pclsObj, &uReturn);
-            if (0 == uReturn) break;
-            
-            VARIANT vtProp;
-            hr = pclsObj->Get(L"Name", 0, &vtProp, 0, 0);
-            if (SUCCEEDED(hr) && vtProp.vt == VT_BSTR) {
-              wmiData.processor = _com_util::ConvertBSTRToString(vtProp.bstrVal);
-            }
-            VariantClear(&vtProp);
-            
-            pclsObj->Release();
-            break;
-          }
-          pEnumerator->Release();
-        }
-        
-        pSvc->Release();
+    // Identity and WMI strings do not change while the app runs, so once read
+    // they are carried over. A failed read is retried on a later wakeup. Read
+    // after the collectors, which share the tick's breakdown and PDH sample.
+    if (nowMs >= m_nextIdentityReadMs) {
+      bool missing = false;
+      for (size_t i = 0; i < ReactNativeDeviceAiCore::kTextFieldCount; ++i) {
+        auto field = static_cast<ReactNativeDeviceAiCore::TextField>(i);
+        missing = missing || (field != ReactNativeDeviceAiCore::TextField::NetworkType &&
+                                 snapshot[field].state == ReactNativeDeviceAiCore::ValueState::Unknown);
+      }
+      if (missing) {
+        m_assembler.CollectIdentity(snapshot, nowMs);
+        m_assembler.Collect(ReactNativeDeviceAiCore::Collector::Wmi, snapshot, nowMs);
+        m_nextIdentityReadMs = nowMs + kIdentityRetryMs;
       }
-      pLoc->Release();
     }
     
-    // Fallback if WMI fails
-    if (wmiData.computerSystem.empty()) {
-      wmiData.computerSystem = "Generic Windows Computer";
-    }
-    if (wmiData.operatingSystem.empty()) {
-      wmiData.operatingSystem = "Microsoft Windows";
+    snapshot.sequence += 1;
+    snapshot.timestampMs = nowMs;
+    m_live->Publish(snapshot);
+    
+    if (!m_journalOpened) {
+      m_journalOpened = true;
+      OpenJournal(m_asyncScope.Enter());
     }
-    if (wmiData.processor.empty()) {
-      wmiData.processor = "Unknown Processor";
+    
+    // Charts plot wall-clock time
+    auto unixMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    auto values = ReactNativeDeviceAiCore::LiveValues(snapshot);
+    AppendRow(unixMs, values);
+    EmitAnomalies(m_anomalies->ObserveRow(unixMs, values));
+    EmitAlerts(m_alerts->Evaluate(unixMs, values));
+  } catch (...) {
+  }
+}
+
+// Runs on the sampler thread
+void ReactNativeDeviceAi::EmitAnomalies(std::vector<ReactNativeDeviceAiCore::AnomalyEvent> const &events) noexcept {
+  try {
+    for (auto const &event : events) {
+      React::JSValueObject payload;
+      payload["metric"] = AnomalySeriesName(event.series);
+      payload["phase"] = std::string(ReactNativeDeviceAiCore::ToString(event.phase));
+      payload["severity"] = std::string(ReactNativeDeviceAiCore::ToString(event.severity));
+      payload["startTime"] = static_cast<double>(event.startMs);
+      payload["value"] = event.value;
+      payload["expected"] = event.expected;
+      payload["score"] = event.score;
+      payload["peakScore"] = event.peakScore;
+      payload["timestamp"] = static_cast<double>(event.timeMs);
+      m_context.EmitJSEvent(L"RCTDeviceEventEmitter", L"deviceAiAnomaly", std::move(payload));
     }
   } catch (...) {
-    wmiData.computerSystem = "Generic Windows Computer";
-    wmiData.operatingSystem = "Microsoft Windows";
-    wmiData.processor = "Unknown Processor";
+    OutputDebugStringA("ReactNativeDeviceAi failed to emit anomaly events\n");
   }
-  
-  return wmiData;
 }
 
-std::string ReactNativeDeviceAi::GetOSVersion() noexcept {
+// Runs on the sampler thread
+void ReactNativeDeviceAi::EmitAlerts(std::vector<ReactNativeDeviceAiCore::AlertEvent> const &events) noexcept {
   try {
-    OSVERSIONINFOEX osInfo;
-    // Use RtlGetVersion instead of deprecated GetVersionEx
-    typedef NTSTATUS(WINAPI* RtlGetVersionPtr)(PRTL_OSVERSIONINFOW);
-    HMODULE hMod = GetModuleHandle(TEXT("ntdll.dll"));
-    if (hMod) {
-      RtlGetVersionPtr fxPtr = (RtlGetVersionPtr)GetProcAddress(hMod, "RtlGetVersion");
-      if (fxPtr) {
-        RTL_OSVERSIONINFOW rovi = { 0 };
-        rovi.dwOSVersionInfoSize = sizeof(rovi);
-        if (fxPtr(&rovi) == 0) {
-          return std::to_string(rovi.dwMajorVersion) + "." + std::to_string(rovi.dwMinorVersion) + 
-                 "." + std::to_string(rovi.dwBuildNumber);
-        }
-      }
+    for (auto const &event : events) {
+      React::JSValueObject payload;
+      payload["id"] = event.id;
+      payload["state"] = std::string(ReactNativeDeviceAiCore::ToString(event.state));
+      payload["value"] = event.value;
+      payload["threshold"] = event.threshold;
+      payload["since"] = static_cast<double>(event.sinceMs);
+      payload["timestamp"] = static_cast<double>(event.timeMs);
+      m_context.EmitJSEvent(L"RCTDeviceEventEmitter", L"deviceAiAlert", std::move(payload));
     }
   } catch (...) {
-    // Fallback
+    OutputDebugStringA("ReactNativeDeviceAi failed to emit alert events\n");
   }
-  
-  return "10.0.22000"; // Windows 11 default
 }
 
-std::string ReactNativeDeviceAi::GetBuildNumber() noexcept {
+// Runs on the thread pool: replaying a week of journal takes about half a
+// second, which the sampler thread doesn't wait for
+ReactNativeDeviceAiCore::FireAndForget ReactNativeDeviceAi::OpenJournal(
+    [[maybe_unused]] ReactNativeDeviceAiCore::AsyncScope::Token token) noexcept {
+  co_await ReactNativeDeviceAiCore::ScheduleOn(m_backgroundExecutor);
+  
+  std::unique_ptr<ReactNativeDeviceAiCore::MetricJournal> journal;
   try {
-    HKEY hKey;
-    if (RegOpenKeyEx(HKEY_LOCAL_MACHINE, 
-                     L"SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion", 
-                     0, KEY_READ, &hKey) == ERROR_SUCCESS) {
-      
-      WCHAR buildNumber[256];
-      DWORD size = sizeof(buildNumber);
-      
-      if (RegQueryValueEx(hKey, L"CurrentBuild", NULL, NULL, 
-                          (LPBYTE)buildNumber, &size) == ERROR_SUCCESS) {
-        RegCloseKey(hKey);
-        
-        int len = WideCharToMultiByte(CP_UTF8, 0, buildNumber, -1, NULL, 0, NULL, NULL);
-        std::string result(len - 1, 0);
-        WideCharToMultiByte(CP_UTF8, 0, buildNumber, -1, &result[0], len, NULL, NULL);
-        return result;
+    auto directory = JournalDirectory();
+    if (!directory.empty()) {
+      journal = ReactNativeDeviceAiCore::MetricJournal::Open(directory);
+      if (journal) {
+        journal->Restore(*m_history);
+      } else {
+        OutputDebugStringA("ReactNativeDeviceAi could not open the metric journal\n");
       }
-      
-      RegCloseKey(hKey);
     }
   } catch (...) {
-    // Fallback
+    journal.reset();
   }
   
-  return "22000";
+  // Rows sampled during the replay are newer than any it restored
+  std::lock_guard lock(m_journalMutex);
+  try {
+    for (auto const &[timeMs, values] : m_pendingRows) {
+      m_history->Append(timeMs, values);
+      if (journal) {
+        journal->Append(timeMs, values);
+      }
+    }
+  } catch (...) {
+  }
+  m_pendingRows = {};
+  m_journal = std::move(journal);
+  m_journalReady = true;
 }
 
-std::string ReactNativeDeviceAi::GetProcessorInfo() noexcept {
+// Runs on the sampler thread
+void ReactNativeDeviceAi::AppendRow(int64_t unixMs, std::span<double const, ReactNativeDeviceAiCore::kMetricCount> values) noexcept {
   try {
-    HKEY hKey;
-    if (RegOpenKeyEx(HKEY_LOCAL_MACHINE, 
-                     L"HARDWARE\\DESCRIPTION\\System\\CentralProcessor\\0", 
-                     0, KEY_READ, &hKey) == ERROR_SUCCESS) {
-      
-      WCHAR processorName[256];
-      DWORD size = sizeof(processorName);
-      
-      if (RegQueryValueEx(hKey, L"ProcessorNameString", NULL, NULL, 
-                          (LPBYTE)processorName, &size) == ERROR_SUCCESS) {
-        RegCloseKey(hKey);
-        
-        int len = WideCharToMultiByte(CP_UTF8, 0, processorName, -1, NULL, 0, NULL, NULL);
-        std::string result(len - 1, 0);
-        WideCharToMultiByte(CP_UTF8, 0, processorName, -1, &result[0], len, NULL, NULL);
-        return result;
+    {
+      std::lock_guard lock(m_journalMutex);
+      if (!m_journalReady) {
+        if (m_pendingRows.size() < kMaxPendingRows) {
+          auto &row = m_pendingRows.emplace_back();
+          row.first = unixMs;
+          std::copy(values.begin(), values.end(), row.second.begin());
+        }
+        return;
       }
-      
-      RegCloseKey(hKey);
+    }
+    m_history->Append(unixMs, values);
+    if (m_journal) {
+      m_journal->Append(unixMs, values);
     }
   } catch (...) {
-    // Fallback
   }
-  
-  return "Unknown Processor";
 }
 
-std::string ReactNativeDeviceAi::GetSystemArchitecture() noexcept {
+std::filesystem::path ReactNativeDeviceAi::JournalDirectory() noexcept {
   try {
-    SYSTEM_INFO sysInfo;
-    GetNativeSystemInfo(&sysInfo);
-    
-    switch (sysInfo.wProcessorArchitecture) {
-      case PROCESSOR_ARCHITECTURE_AMD64:
-        return "x64";
-      case PROCESSOR_ARCHITECTURE_ARM64:
-        return "ARM64";
-      case PROCESSOR_ARCHITECTURE_INTEL:
-        return "x86";
-      case PROCESSOR_ARCHITECTURE_ARM:
-        return "ARM";
-      default:
-        return "Unknown";
-    }
+    auto local = winrt::Windows::Storage::ApplicationData::Current().LocalFolder().Path();
+    return std::filesystem::path(std::wstring(local)) / L"DeviceAI" / L"journal";
   } catch (...) {
-    return "x64";
   }
+  
+  // Unpackaged apps have no ApplicationData
+  wchar_t *localAppData = nullptr;
+  size_t length = 0;
+  if (_wdupenv_s(&localAppData, &length, L"LOCALAPPDATA") != 0 || !localAppData) {
+    return {};
+  }
+  std::filesystem::path directory(localAppData);
+  free(localAppData);
+  return directory / L"DeviceAI" / L"journal";
 }
 
 } // namespace winrt::ReactNativeDeviceAiSpecs
@@ -12,18 +12,47 @@
 
 #include "NativeModules.h"
 
+#include "AlertRulesExport.h"
+#include "BackgroundSampler.h"
+#include "LiveSnapshotHostObject.h"
+#include "MemoryCollector.h"
+#include "MemoryResourceMonitor.h"
+#include "MetricHistoryExport.h"
+#include "ProcessCollector.h"
+#include "SnapshotMarshalling.h"
+#include "ThreadPoolExecutor.h"
+#include "Win32PlatformProvider.h"
+
+#include <AlertEngine.h>
+#include <AnomalyDetector.h>
+#include <CollectorDeadline.h>
+#include <DeviceSnapshot.h>
+#include <MetricHistory.h>
+#include <MetricJournal.h>
+#include <SingleFlight.h>
+#include <SnapshotAssembler.h>
+#include <SnapshotPublisher.h>
+#include <SpanRecorder.h>
+#include <TraceRecorder.h>
+#include <Task.h>
+
 // Additional Windows headers for system information
 #include <sysinfoapi.h>
-#include <comdef.h>
-#include <Wbemidl.h>
 #include <pdh.h>
 #include <psapi.h>
 #include <setupapi.h>
 #include <powrprof.h>
 #include <winternl.h>
+#include <winrt/Windows.Storage.h>
 #include <winrt/Windows.System.h>
-#include <winrt/Windows.System.Power.h>
-#include <winrt/Windows.Networking.Connectivity.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -37,14 +66,19 @@ struct ReactNativeDeviceAi
 {
   using ModuleSpec = ReactNativeDeviceAiCodegen::DeviceAISpecSpec;
 
+  ~ReactNativeDeviceAi() noexcept;
+
   REACT_INIT(Initialize)
   void Initialize(React::ReactContext const &reactContext) noexcept;
 
   REACT_METHOD(getDeviceInfo)
-  void getDeviceInfo(React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType> &&result) noexcept;
+  void getDeviceInfo(std::optional<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_CollectOptions> options, React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType> &&result) noexcept;
 
   REACT_METHOD(getWindowsSystemInfo)
-  void getWindowsSystemInfo(React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType> &&result) noexcept;
+  void getWindowsSystemInfo(std::optional<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_CollectOptions> options, React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType> &&result) noexcept;
+
+  REACT_METHOD(getMemoryBreakdown)
+  void getMemoryBreakdown(React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getMemoryBreakdown_returnType> &&result) noexcept;
 
   REACT_SYNC_METHOD(isNativeModuleAvailable)
   bool isNativeModuleAvailable() noexcept;
@@ -52,21 +86,161 @@ struct ReactNativeDeviceAi
   REACT_SYNC_METHOD(getSupportedFeatures)
   std::vector<std::string> getSupportedFeatures() noexcept;
 
+  REACT_METHOD(startSampling)
+  void startSampling() noexcept;
+
+  REACT_METHOD(stopSampling)
+  void stopSampling() noexcept;
+
+  REACT_METHOD(setAppForeground)
+  void setAppForeground(bool foreground) noexcept;
+
+  REACT_SYNC_METHOD(getSamplerDiagnostics)
+  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getSamplerDiagnostics_returnType getSamplerDiagnostics() noexcept;
+
+  REACT_METHOD(startMemoryMonitoring)
+  void startMemoryMonitoring() noexcept;
+
+  REACT_METHOD(stopMemoryMonitoring)
+  void stopMemoryMonitoring() noexcept;
+
+  REACT_METHOD(getProcessProfile)
+  void getProcessProfile(React::ReactPromise<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getProcessProfile_returnType> &&result) noexcept;
+
+  REACT_METHOD(setCoalescingWindow)
+  void setCoalescingWindow(double windowMs) noexcept;
+
+  REACT_SYNC_METHOD(getCollectorStats)
+  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getCollectorStats_returnType getCollectorStats() noexcept;
+
+  REACT_SYNC_METHOD(getFallbackStats)
+  std::vector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_FieldStats> getFallbackStats() noexcept;
+
+  REACT_SYNC_METHOD(getDiagnostics)
+  std::vector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_SpanDiagnostics> getDiagnostics() noexcept;
+
+  REACT_METHOD(setTracingEnabled)
+  void setTracingEnabled(bool enabled) noexcept;
+
+  REACT_METHOD(getTraceEvents)
+  void getTraceEvents(React::ReactPromise<std::string> &&result) noexcept;
+
+  REACT_METHOD(writeTraceFile)
+  void writeTraceFile(std::string path, React::ReactPromise<std::string> &&result) noexcept;
+
 private:
   React::ReactContext m_context;
-  
-  // Helper methods for system information gathering
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_memory GetMemoryInfo() noexcept;
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_storage GetStorageInfo() noexcept;
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_battery GetBatteryInfo() noexcept;
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_cpu GetCpuInfo() noexcept;
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_network GetNetworkInfo() noexcept;
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters GetPerformanceCounters() noexcept;
-  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData GetWmiData() noexcept;
-  std::string GetOSVersion() noexcept;
-  std::string GetBuildNumber() noexcept;
-  std::string GetProcessorInfo() noexcept;
-  std::string GetSystemArchitecture() noexcept;
+
+  // Promise methods run as coroutines resumed on the thread pool so the RNW queue
+  // thread is released at once; the scope lets the destructor wait for them
+  ThreadPoolExecutor m_backgroundExecutor;
+  ReactNativeDeviceAiCore::AsyncScope m_asyncScope;
+  template <typename T, typename Collect>
+  ReactNativeDeviceAiCore::FireAndForget ResolveInBackground(
+      React::ReactPromise<T> result, Collect collect, char const *error, ReactNativeDeviceAiCore::AsyncScope::Token token) noexcept;
+  template <typename T, typename Collect>
+  ReactNativeDeviceAiCore::FireAndForget CompleteInBackground(
+      ReactNativeDeviceAiCore::SingleFlight<T> &flight, Collect collect, ReactNativeDeviceAiCore::AsyncScope::Token token) noexcept;
+
+  // Concurrent JS callers share one in-flight WMI/PDH collection per method
+  using DeviceInfo = ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType;
+  using WindowsSystemInfo = ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType;
+  ReactNativeDeviceAiCore::SingleFlight<DeviceInfo> m_deviceInfoFlight;
+  ReactNativeDeviceAiCore::SingleFlight<WindowsSystemInfo> m_systemInfoFlight;
+  std::optional<DeviceInfo> CollectDeviceInfo(int64_t budgetMs) noexcept;
+  std::optional<WindowsSystemInfo> CollectWindowsSystemInfo(int64_t budgetMs) noexcept;
+
+  // Each data source runs under its own deadline, capped by the caller's overall
+  // budget; a late section resolves with its last good value marked stale. A
+  // source that keeps failing is skipped by its circuit breaker until a probe
+  // after the back-off succeeds
+  static constexpr int64_t kDefaultBudgetMs = 2000;
+  ReactNativeDeviceAiCore::CollectorStats m_collectorStats;
+  ReactNativeDeviceAiCore::DeadlineCollector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_memory> m_memoryCollector{
+      ReactNativeDeviceAiCore::Collector::Memory, 250, m_collectorStats};
+  ReactNativeDeviceAiCore::DeadlineCollector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_storage> m_storageCollector{
+      ReactNativeDeviceAiCore::Collector::Storage, 500, m_collectorStats};
+  ReactNativeDeviceAiCore::DeadlineCollector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_battery> m_batteryCollector{
+      ReactNativeDeviceAiCore::Collector::Battery, 500, m_collectorStats};
+  ReactNativeDeviceAiCore::DeadlineCollector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_cpu> m_cpuCollector{
+      ReactNativeDeviceAiCore::Collector::Cpu, 1000, m_collectorStats};
+  ReactNativeDeviceAiCore::DeadlineCollector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_network> m_networkCollector{
+      ReactNativeDeviceAiCore::Collector::Network, 500, m_collectorStats};
+  ReactNativeDeviceAiCore::DeadlineCollector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters> m_performanceCollector{
+      ReactNativeDeviceAiCore::Collector::PerformanceCounters, 1000, m_collectorStats};
+  ReactNativeDeviceAiCore::DeadlineCollector<ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData> m_wmiCollector{
+      ReactNativeDeviceAiCore::Collector::Wmi, 1500, m_collectorStats};
+  template <typename Section>
+  uint64_t StartSection(ReactNativeDeviceAiCore::DeadlineCollector<Section> &collector) noexcept;
+  template <typename Section>
+  std::optional<Section> ReadSection(ReactNativeDeviceAiCore::Collector collector) noexcept;
+
+  // Latency histograms and call/failure/fallback counts for every collector and
+  // the PDH, WMI and registry calls inside them
+  ReactNativeDeviceAiCore::SpanRecorder m_spans;
+
+  // Raw Win32 reads, turned into sections by the same snapshot assembly the
+  // core tools and benchmarks use. It keeps every field's last good value: a
+  // failed read answers with it and is counted, and a field that was never
+  // read successfully is reported as unknown
+  Win32PlatformProvider m_provider{m_spans};
+  ReactNativeDeviceAiCore::SnapshotAssembler m_assembler{m_provider, m_spans};
+  ReactNativeDeviceAiCore::DeviceSnapshot CollectIdentity() noexcept;
+
+  // Background sampler; each wakeup reads the provider's persistent PDH query
+  std::unique_ptr<BackgroundSampler> m_sampler;
+  double SampleTick() noexcept;
+
+  // Snapshot refreshed on every sampler wakeup and read synchronously from JS
+  // through global.__deviceAiLive. Shared with the host object, which the JS
+  // runtime may keep alive after the module is gone
+  std::shared_ptr<ReactNativeDeviceAiCore::SnapshotPublisher> m_live = std::make_shared<ReactNativeDeviceAiCore::SnapshotPublisher>();
+  // Every published snapshot, kept for charting through global.__deviceAiHistory
+  std::shared_ptr<ReactNativeDeviceAiCore::MetricHistory> m_history = std::make_shared<ReactNativeDeviceAiCore::MetricHistory>();
+  void PublishLiveSnapshot() noexcept;
+  // Identity and WMI strings are read until every one of them has been read
+  // once, at most this often since each read is a slow WMI round trip
+  static constexpr int64_t kIdentityRetryMs = 30 * 1000;
+  int64_t m_nextIdentityReadMs = 0;
+
+  // The same rows on disk under the app's local folder. The first sampler
+  // tick has it opened and replayed into m_history on the thread pool; rows
+  // sampled until then wait in m_pendingRows and go in after the replay. Once
+  // m_journalReady is set, the journal is only touched from the sampler thread.
+  std::mutex m_journalMutex;
+  std::unique_ptr<ReactNativeDeviceAiCore::MetricJournal> m_journal;
+  bool m_journalReady = false;
+  std::vector<std::pair<int64_t, std::array<double, ReactNativeDeviceAiCore::kMetricCount>>> m_pendingRows;
+  static constexpr size_t kMaxPendingRows = 3600;
+  // Sampler thread only
+  bool m_journalOpened = false;
+  ReactNativeDeviceAiCore::FireAndForget OpenJournal(ReactNativeDeviceAiCore::AsyncScope::Token token) noexcept;
+  void AppendRow(int64_t unixMs, std::span<double const, ReactNativeDeviceAiCore::kMetricCount> values) noexcept;
+  static std::filesystem::path JournalDirectory() noexcept;
+
+  // Pushes low-memory transitions to JS as deviceAiMemoryPressure events
+  std::unique_ptr<MemoryResourceMonitor> m_memoryMonitor;
+  void OnMemoryPressure(ReactNativeDeviceAiCore::MemoryPressureLevel level) noexcept;
+
+  // Self-profiling of the host process; trends advance on sampler ticks
+  ReactNativeDeviceAiCore::ProcessTrendTracker m_processTrends;
+  void TrackProcessTrends() noexcept;
+  // The thread count takes a snapshot of every process, so ticks read it at
+  // most this often and its trend is fed only then
+  static constexpr int64_t kThreadCountIntervalMs = 60 * 1000;
+  int64_t m_nextThreadCountMs = 0;
+
+  // Every history metric and host process counter scored on sampler ticks
+  // against its daily baseline; episodes are pushed to JS as deviceAiAnomaly
+  // events and logged for global.__deviceAiAnomalies
+  std::shared_ptr<ReactNativeDeviceAiCore::AnomalyMonitor> m_anomalies =
+      std::make_shared<ReactNativeDeviceAiCore::AnomalyMonitor>(ReactNativeDeviceAiCore::AnomalyConfig{ReactNativeDeviceAiCore::AnomalyMethod::Seasonal});
+  void EmitAnomalies(std::vector<ReactNativeDeviceAiCore::AnomalyEvent> const &events) noexcept;
+
+  // Threshold rules set from JS through global.__deviceAiSetAlertRules and
+  // evaluated on sampler ticks; transitions are pushed as deviceAiAlert events
+  std::shared_ptr<ReactNativeDeviceAiCore::AlertEngine> m_alerts = std::make_shared<ReactNativeDeviceAiCore::AlertEngine>();
+  void EmitAlerts(std::vector<ReactNativeDeviceAiCore::AlertEvent> const &events) noexcept;
 };
 
 } // namespace winrt::ReactNativeDeviceAiSpecs
\ No newline at end of file
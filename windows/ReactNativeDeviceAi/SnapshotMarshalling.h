@@ -0,0 +1,147 @@
+#pragma once
+
+// Plain standard C++ on purpose: the core benchmarks include this from Linux
+// to measure marshalling into the real codegen structs.
+#include "codegen/NativeDeviceAISpecDataTypes.g.h"
+
+#include <DeviceSnapshot.h>
+
+#include <optional>
+#include <string>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// Copies of collected snapshot fields into the codegen return types, which RNW
+// then serializes for JS. Unknown fields stay unset.
+namespace Marshalling
+{
+
+inline std::optional<double> Number(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCore::Metric metric) {
+  auto const &value = snapshot[metric];
+  if (value.state == ReactNativeDeviceAiCore::ValueState::Unknown) {
+    return std::nullopt;
+  }
+  return value.value;
+}
+
+inline std::optional<bool> Flag(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCore::Metric metric) {
+  auto value = Number(snapshot, metric);
+  if (!value) {
+    return std::nullopt;
+  }
+  return *value != 0.0;
+}
+
+inline std::optional<std::string> Text(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCore::TextField field) {
+  auto const &text = snapshot[field];
+  if (text.state == ReactNativeDeviceAiCore::ValueState::Unknown) {
+    return std::nullopt;
+  }
+  return std::string(text.View());
+}
+
+// Section state, stale flag and, when any field fell back to a last-known
+// value, the age of the oldest one
+template <typename Section>
+void ApplySection(Section &section, ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCore::Collector collector) {
+  using ReactNativeDeviceAiCore::ValueState;
+  auto const &summary = snapshot.Section(collector);
+  section.state = ReactNativeDeviceAiCore::ToString(summary.state);
+  section.stale = summary.state != ValueState::Live;
+
+  bool anyLastKnown = false;
+  for (auto metric : ReactNativeDeviceAiCore::MetricsOf(collector)) {
+    anyLastKnown = anyLastKnown || snapshot[metric].state == ValueState::LastKnown;
+  }
+  for (auto field : ReactNativeDeviceAiCore::TextsOf(collector)) {
+    anyLastKnown = anyLastKnown || snapshot[field].state == ValueState::LastKnown;
+  }
+  if (anyLastKnown) {
+    section.ageMs = static_cast<double>(summary.ageMs);
+  } else {
+    section.ageMs.reset();
+  }
+}
+
+} // namespace Marshalling
+
+inline void Marshal(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_memory &memory) {
+  using namespace Marshalling;
+  memory.total = Number(snapshot, ReactNativeDeviceAiCore::Metric::MemoryTotal);
+  memory.available = Number(snapshot, ReactNativeDeviceAiCore::Metric::MemoryAvailable);
+  ApplySection(memory, snapshot, ReactNativeDeviceAiCore::Collector::Memory);
+}
+
+inline void Marshal(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_storage &storage) {
+  using namespace Marshalling;
+  storage.total = Number(snapshot, ReactNativeDeviceAiCore::Metric::StorageTotal);
+  storage.available = Number(snapshot, ReactNativeDeviceAiCore::Metric::StorageAvailable);
+  ApplySection(storage, snapshot, ReactNativeDeviceAiCore::Collector::Storage);
+}
+
+inline void Marshal(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_battery &battery) {
+  using namespace Marshalling;
+  battery.level = Number(snapshot, ReactNativeDeviceAiCore::Metric::BatteryLevel);
+  battery.isCharging = Flag(snapshot, ReactNativeDeviceAiCore::Metric::BatteryCharging);
+  ApplySection(battery, snapshot, ReactNativeDeviceAiCore::Collector::Battery);
+}
+
+inline void Marshal(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_cpu &cpu) {
+  using namespace Marshalling;
+  cpu.usage = Number(snapshot, ReactNativeDeviceAiCore::Metric::CpuUsage);
+  cpu.cores = Number(snapshot, ReactNativeDeviceAiCore::Metric::CpuCores);
+  ApplySection(cpu, snapshot, ReactNativeDeviceAiCore::Collector::Cpu);
+}
+
+inline void Marshal(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType_network &network) {
+  using namespace Marshalling;
+  network.type = Text(snapshot, ReactNativeDeviceAiCore::TextField::NetworkType);
+  network.isConnected = Flag(snapshot, ReactNativeDeviceAiCore::Metric::NetworkConnected);
+  ApplySection(network, snapshot, ReactNativeDeviceAiCore::Collector::Network);
+}
+
+inline void Marshal(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot,
+    ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters &counters) {
+  using namespace Marshalling;
+  counters.cpuUsage = Number(snapshot, ReactNativeDeviceAiCore::Metric::CounterCpuUsage);
+  counters.memoryUsage = Number(snapshot, ReactNativeDeviceAiCore::Metric::CounterMemoryUsage);
+  counters.diskUsage = Number(snapshot, ReactNativeDeviceAiCore::Metric::CounterDiskUsage);
+  ApplySection(counters, snapshot, ReactNativeDeviceAiCore::Collector::PerformanceCounters);
+}
+
+inline void Marshal(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot, ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData &wmi) {
+  using namespace Marshalling;
+  wmi.computerSystem = Text(snapshot, ReactNativeDeviceAiCore::TextField::WmiComputerSystem);
+  wmi.operatingSystem = Text(snapshot, ReactNativeDeviceAiCore::TextField::WmiOperatingSystem);
+  wmi.processor = Text(snapshot, ReactNativeDeviceAiCore::TextField::WmiProcessor);
+  ApplySection(wmi, snapshot, ReactNativeDeviceAiCore::Collector::Wmi);
+}
+
+inline ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType ToDeviceInfo(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot) {
+  using namespace Marshalling;
+  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getDeviceInfo_returnType info;
+  info.platform = "windows";
+  info.osVersion = Text(snapshot, ReactNativeDeviceAiCore::TextField::OsVersion);
+  info.deviceModel = Text(snapshot, ReactNativeDeviceAiCore::TextField::Processor);
+  Marshal(snapshot, info.memory);
+  Marshal(snapshot, info.storage);
+  Marshal(snapshot, info.battery);
+  Marshal(snapshot, info.cpu);
+  Marshal(snapshot, info.network);
+  return info;
+}
+
+inline ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType ToWindowsSystemInfo(ReactNativeDeviceAiCore::DeviceSnapshot const &snapshot) {
+  using namespace Marshalling;
+  ReactNativeDeviceAiCodegen::DeviceAISpecSpec_getWindowsSystemInfo_returnType info;
+  info.osVersion = Text(snapshot, ReactNativeDeviceAiCore::TextField::OsVersion);
+  info.buildNumber = Text(snapshot, ReactNativeDeviceAiCore::TextField::BuildNumber);
+  info.processor = Text(snapshot, ReactNativeDeviceAiCore::TextField::Processor);
+  info.architecture = Text(snapshot, ReactNativeDeviceAiCore::TextField::Architecture);
+  Marshal(snapshot, info.performanceCounters);
+  Marshal(snapshot, info.wmiData);
+  return info;
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,28 @@
+#include "pch.h"
+#include "ThreadPoolExecutor.h"
+
+namespace winrt::ReactNativeDeviceAiSpecs {
+
+namespace {
+
+void ResumeWithCom(std::coroutine_handle<> handle) noexcept {
+  HRESULT hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+  handle.resume();
+  if (SUCCEEDED(hr)) {
+    CoUninitialize();
+  }
+}
+
+void CALLBACK ResumeCallback(PTP_CALLBACK_INSTANCE, void *context) noexcept {
+  ResumeWithCom(std::coroutine_handle<>::from_address(context));
+}
+
+} // namespace
+
+void ThreadPoolExecutor::Post(std::coroutine_handle<> handle) noexcept {
+  if (!TrySubmitThreadpoolCallback(ResumeCallback, handle.address(), nullptr)) {
+    ResumeWithCom(handle);
+  }
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "pch.h"
+
+#include <Task.h>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// Resumes coroutines on the Windows thread pool with COM initialized for WMI,
+// so method bodies release the RNW queue thread that invoked them. Falls back
+// to resuming inline if the pool rejects the work item.
+class ThreadPoolExecutor final : public ReactNativeDeviceAiCore::Executor
+{
+public:
+  void Post(std::coroutine_handle<> handle) noexcept override;
+};
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,416 @@
+#include "pch.h"
+#include "Win32PlatformProvider.h"
+
+#include "MemoryCollector.h"
+
+#include <Clock.h>
+#include <StringConversion.h>
+
+#include <comdef.h>
+#include <Wbemidl.h>
+#include <pdh.h>
+#include <winternl.h>
+#include <winrt/Windows.System.Power.h>
+#include <winrt/Windows.Networking.Connectivity.h>
+
+#pragma comment(lib, "wbemuuid.lib")
+#pragma comment(lib, "pdh.lib")
+
+namespace winrt::ReactNativeDeviceAiSpecs {
+
+namespace {
+
+// String property of the first row a WQL query returns; empty when the query
+// fails, returns no rows or the property is not a string.
+std::string QueryWmiString(IWbemServices *services, char const *wql, wchar_t const *property) {
+  std::string result;
+  IEnumWbemClassObject *pEnumerator = NULL;
+  HRESULT hres = services->ExecQuery(
+      bstr_t("WQL"),
+      bstr_t(wql),
+      WBEM_FLAG_FORWARD_ONLY | WBEM_FLAG_RETURN_IMMEDIATELY,
+      NULL,
+      &pEnumerator);
+  if (FAILED(hres)) {
+    return result;
+  }
+
+  IWbemClassObject *pclsObj = NULL;
+  ULONG uReturn = 0;
+  if (SUCCEEDED(pEnumerator->Next(WBEM_INFINITE, 1, &pclsObj, &uReturn)) && uReturn != 0) {
+    VARIANT vtProp;
+    HRESULT hr = pclsObj->Get(property, 0, &vtProp, 0, 0);
+    if (SUCCEEDED(hr) && vtProp.vt == VT_BSTR) {
+      result = ReactNativeDeviceAiCore::WideToUtf8({vtProp.bstrVal, SysStringLen(vtProp.bstrVal)});
+    }
+    VariantClear(&vtProp);
+    pclsObj->Release();
+  }
+  pEnumerator->Release();
+  return result;
+}
+
+} // namespace
+
+Win32PlatformProvider::Win32PlatformProvider(ReactNativeDeviceAiCore::SpanRecorder &spans) noexcept : m_spans(spans) {
+  // Prime the rate counters so the first reads measure from here
+  std::lock_guard<std::mutex> lock(m_pdhMutex);
+  if (OpenQueryLocked() && PdhCollectQueryData(m_pdhQuery) == ERROR_SUCCESS) {
+    m_lastCountersMs = ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs();
+  }
+}
+
+Win32PlatformProvider::~Win32PlatformProvider() {
+  if (m_pdhQuery) {
+    PdhCloseQuery(m_pdhQuery);
+  }
+}
+
+std::optional<ReactNativeDeviceAiCore::MemoryBreakdown> Win32PlatformProvider::ReadMemoryBreakdown() noexcept {
+  ReactNativeDeviceAiCore::MemoryCounters counters;
+  if (!ReadMemoryCounters(counters)) {
+    return std::nullopt;
+  }
+
+  auto nowMs = ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs();
+  std::lock_guard<std::mutex> lock(m_memoryMutex);
+  m_lastBreakdown = m_faultRates.Update(counters, nowMs);
+  m_lastBreakdownMs = nowMs;
+  return m_lastBreakdown;
+}
+
+std::optional<ReactNativeDeviceAiCore::MemoryBreakdown> Win32PlatformProvider::RecentMemoryBreakdown() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(m_memoryMutex);
+    if (m_lastBreakdown && ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs() - m_lastBreakdownMs < kReuseWindowMs) {
+      return m_lastBreakdown;
+    }
+  }
+  return ReadMemoryBreakdown();
+}
+
+Win32PlatformProvider::CounterSample Win32PlatformProvider::CollectCounters() noexcept {
+  auto nowMs = ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs();
+  std::lock_guard<std::mutex> lock(m_pdhMutex);
+  if (m_lastCountersMs != 0 && nowMs - m_lastCountersMs < kReuseWindowMs) {
+    return m_lastCounters;
+  }
+  return CollectLocked(nowMs);
+}
+
+Win32PlatformProvider::CounterSample Win32PlatformProvider::RecentCounters() noexcept {
+  auto nowMs = ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs();
+  std::lock_guard<std::mutex> lock(m_pdhMutex);
+  if (m_lastCountersMs != 0 && nowMs - m_lastCountersMs < kReuseWindowMs) {
+    return m_lastCounters;
+  }
+  if (m_lastCountersMs != 0 && nowMs - m_lastCountersMs <= kMaxCounterIntervalMs) {
+    return CollectLocked(nowMs);
+  }
+
+  // Without a recent collection, e.g. on demand with the sampler stopped,
+  // usage since then is stale: measure a short interval from now instead
+  CollectLocked(nowMs);
+  Sleep(kSettleMs);
+  return CollectLocked(ReactNativeDeviceAiCore::SteadyClock::Instance().NowMs());
+}
+
+bool Win32PlatformProvider::OpenQueryLocked() noexcept {
+  if (m_pdhQuery) {
+    return true;
+  }
+  if (PdhOpenQuery(NULL, 0, &m_pdhQuery) != ERROR_SUCCESS) {
+    m_pdhQuery = nullptr;
+    return false;
+  }
+  if (PdhAddEnglishCounter(m_pdhQuery, L"\\Processor(_Total)\\% Processor Time", 0, &m_cpuCounter) != ERROR_SUCCESS) {
+    m_cpuCounter = nullptr;
+  }
+  if (PdhAddEnglishCounter(m_pdhQuery, L"\\PhysicalDisk(_Total)\\% Disk Time", 0, &m_diskCounter) != ERROR_SUCCESS) {
+    m_diskCounter = nullptr;
+  }
+  return true;
+}
+
+Win32PlatformProvider::CounterSample Win32PlatformProvider::CollectLocked(int64_t nowMs) noexcept {
+  ReactNativeDeviceAiCore::ScopedSpan pdhSpan(m_spans, ReactNativeDeviceAiCore::Span::PdhQuery);
+  // A query that failed to open when the provider was built is retried; its
+  // first collection then only primes it
+  bool primed = m_pdhQuery != nullptr && m_lastCountersMs != 0;
+  m_lastCounters = {};
+  if (!OpenQueryLocked() || PdhCollectQueryData(m_pdhQuery) != ERROR_SUCCESS) {
+    pdhSpan.Fail();
+    return m_lastCounters;
+  }
+  m_lastCountersMs = nowMs;
+
+  PDH_FMT_COUNTERVALUE value;
+  if (m_cpuCounter && PdhGetFormattedCounterValue(m_cpuCounter, PDH_FMT_DOUBLE, NULL, &value) == ERROR_SUCCESS) {
+    m_lastCounters.cpuUsage = value.doubleValue;
+  }
+  if (m_diskCounter && PdhGetFormattedCounterValue(m_diskCounter, PDH_FMT_DOUBLE, NULL, &value) == ERROR_SUCCESS) {
+    m_lastCounters.diskUsage = value.doubleValue;
+  }
+  if (primed && (!m_lastCounters.cpuUsage || !m_lastCounters.diskUsage)) {
+    pdhSpan.Fail();
+  }
+  return m_lastCounters;
+}
+
+ReactNativeDeviceAiCore::MemoryReading Win32PlatformProvider::ReadMemory() {
+  ReactNativeDeviceAiCore::MemoryReading reading;
+  reading.total.source = "GetPerformanceInfo";
+  reading.available.source = "GetPerformanceInfo";
+  if (auto breakdown = RecentMemoryBreakdown()) {
+    reading.total.value = static_cast<double>(breakdown->counters.totalPhys);
+    reading.available.value = static_cast<double>(breakdown->counters.availablePhys);
+  }
+  return reading;
+}
+
+ReactNativeDeviceAiCore::StorageReading Win32PlatformProvider::ReadStorage() {
+  ReactNativeDeviceAiCore::StorageReading reading;
+  reading.total.source = "GetDiskFreeSpaceEx";
+  reading.available.source = "GetDiskFreeSpaceEx";
+
+  ULARGE_INTEGER freeBytesAvailable, totalNumberOfBytes, totalNumberOfFreeBytes;
+  if (GetDiskFreeSpaceEx(L"C:\\", &freeBytesAvailable, &totalNumberOfBytes, &totalNumberOfFreeBytes)) {
+    reading.total.value = static_cast<double>(totalNumberOfBytes.QuadPart);
+    reading.available.value = static_cast<double>(freeBytesAvailable.QuadPart);
+  }
+  return reading;
+}
+
+ReactNativeDeviceAiCore::BatteryReading Win32PlatformProvider::ReadBattery() {
+  ReactNativeDeviceAiCore::BatteryReading reading;
+  char const *source = "GetSystemPowerStatus";
+  try {
+    using namespace winrt::Windows::System::Power;
+
+    // Use Windows Battery API through power manager
+    auto batteryStatus = PowerManager::BatteryStatus();
+
+    if (batteryStatus != BatteryStatus::NotPresent) {
+      SYSTEM_POWER_STATUS powerStatus;
+      if (GetSystemPowerStatus(&powerStatus)) {
+        // 255 means the battery level is unknown
+        if (powerStatus.BatteryLifePercent != 255) {
+          reading.level.value = static_cast<double>(powerStatus.BatteryLifePercent);
+        }
+
+        reading.charging.value = (powerStatus.ACLineStatus == 1) &&
+                                 (powerStatus.BatteryFlag & 8) == 0; // Not unknown and AC connected
+      }
+    } else {
+      // Desktop/AC powered system - no battery, reported as full and not charging
+      reading.level.value = 100.0;
+      reading.charging.value = false;
+      source = "PowerManager";
+    }
+  } catch (...) {
+    // Fallback using Win32 API
+    SYSTEM_POWER_STATUS powerStatus;
+    if (GetSystemPowerStatus(&powerStatus)) {
+      if (powerStatus.BatteryLifePercent != 255) {
+        reading.level.value = static_cast<double>(powerStatus.BatteryLifePercent);
+      }
+      reading.charging.value = powerStatus.ACLineStatus == 1;
+    }
+  }
+
+  reading.level.source = source;
+  reading.charging.source = source;
+  return reading;
+}
+
+ReactNativeDeviceAiCore::CpuReading Win32PlatformProvider::ReadCpu() {
+  ReactNativeDeviceAiCore::CpuReading reading;
+  reading.usage.source = "PDH";
+  reading.cores.source = "GetSystemInfo";
+
+  SYSTEM_INFO sysInfo;
+  GetSystemInfo(&sysInfo);
+  reading.cores.value = static_cast<double>(sysInfo.dwNumberOfProcessors);
+
+  reading.usage.value = RecentCounters().cpuUsage;
+  return reading;
+}
+
+ReactNativeDeviceAiCore::NetworkReading Win32PlatformProvider::ReadNetwork() {
+  ReactNativeDeviceAiCore::NetworkReading reading;
+  reading.type.source = "NetworkInformation";
+  reading.connected.source = "NetworkInformation";
+
+  using namespace winrt::Windows::Networking::Connectivity;
+
+  auto connectionProfile = NetworkInformation::GetInternetConnectionProfile();
+  if (connectionProfile) {
+    reading.connected.value = true;
+    reading.type.value = "unknown";
+
+    auto networkAdapter = connectionProfile.NetworkAdapter();
+    if (networkAdapter) {
+      switch (networkAdapter.IanaInterfaceType()) {
+        case 6:   // Ethernet
+          reading.type.value = "ethernet";
+          break;
+        case 71:  // WiFi
+          reading.type.value = "wifi";
+          break;
+        case 244: // WWWLAN (cellular)
+          reading.type.value = "cellular";
+          break;
+      }
+    }
+  } else {
+    reading.connected.value = false;
+    reading.type.value = "none";
+  }
+  return reading;
+}
+
+ReactNativeDeviceAiCore::CounterReading Win32PlatformProvider::ReadPerformanceCounters() {
+  ReactNativeDeviceAiCore::CounterReading reading;
+  reading.cpuUsage.source = "PDH";
+  reading.memoryUsage.source = "GetPerformanceInfo";
+  reading.diskUsage.source = "PDH";
+
+  // Commit usage comes from the memory counters rather than a second PDH counter
+  if (auto memoryBreakdown = RecentMemoryBreakdown()) {
+    reading.memoryUsage.value = memoryBreakdown->commitPercent;
+  }
+
+  auto counters = RecentCounters();
+  reading.cpuUsage.value = counters.cpuUsage;
+  reading.diskUsage.value = counters.diskUsage;
+  return reading;
+}
+
+ReactNativeDeviceAiCore::WmiReading Win32PlatformProvider::ReadWmi() {
+  ReactNativeDeviceAiCore::WmiReading reading;
+  reading.computerSystem.source = "WMI";
+  reading.operatingSystem.source = "WMI";
+  reading.processor.source = "WMI";
+
+  HRESULT hres;
+  IWbemLocator *pLoc = NULL;
+  IWbemServices *pSvc = NULL;
+
+  // Initialize WMI
+  {
+    ReactNativeDeviceAiCore::ScopedSpan connectSpan(m_spans, ReactNativeDeviceAiCore::Span::WmiConnect);
+    hres = CoCreateInstance(
+        CLSID_WbemLocator,
+        0,
+        CLSCTX_INPROC_SERVER,
+        IID_IWbemLocator, (LPVOID *)&pLoc);
+    if (SUCCEEDED(hres)) {
+      hres = pLoc->ConnectServer(
+          _bstr_t(L"ROOT\\CIMV2"),
+          NULL, NULL, 0, NULL, 0, 0, &pSvc);
+    }
+    if (FAILED(hres)) {
+      connectSpan.Fail();
+    }
+  }
+
+  if (SUCCEEDED(hres)) {
+    // Set security levels
+    CoSetProxyBlanket(
+        pSvc,
+        RPC_C_AUTHN_WINNT,
+        RPC_C_AUTHZ_NONE,
+        NULL,
+        RPC_C_AUTHN_LEVEL_CALL,
+        RPC_C_IMP_LEVEL_IMPERSONATE,
+        NULL,
+        EOAC_NONE);
+
+    // An empty answer counts as a failed read
+    auto query = [&](ReactNativeDeviceAiCore::Span id, char const *wql, wchar_t const *property) {
+      ReactNativeDeviceAiCore::ScopedSpan querySpan(m_spans, id);
+      auto value = QueryWmiString(pSvc, wql, property);
+      if (value.empty()) {
+        querySpan.Fail();
+      }
+      return value;
+    };
+    reading.computerSystem.value = query(ReactNativeDeviceAiCore::Span::WmiComputerSystem, "SELECT * FROM Win32_ComputerSystem", L"Model");
+    reading.operatingSystem.value = query(ReactNativeDeviceAiCore::Span::WmiOperatingSystem, "SELECT * FROM Win32_OperatingSystem", L"Caption");
+    reading.processor.value = query(ReactNativeDeviceAiCore::Span::WmiProcessor, "SELECT * FROM Win32_Processor", L"Name");
+
+    pSvc->Release();
+  }
+  if (pLoc) {
+    pLoc->Release();
+  }
+  return reading;
+}
+
+ReactNativeDeviceAiCore::IdentityReading Win32PlatformProvider::ReadIdentity() {
+  ReactNativeDeviceAiCore::IdentityReading reading;
+  reading.osVersion = {ReadOSVersion(), "RtlGetVersion"};
+  reading.buildNumber = {ReadRegistryString(L"SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion", L"CurrentBuild"), "Registry"};
+  reading.processor = {ReadRegistryString(L"HARDWARE\\DESCRIPTION\\System\\CentralProcessor\\0", L"ProcessorNameString"), "Registry"};
+  reading.architecture = {ReadArchitecture(), "GetNativeSystemInfo"};
+  return reading;
+}
+
+std::optional<std::string> Win32PlatformProvider::ReadOSVersion() {
+  // Use RtlGetVersion instead of deprecated GetVersionEx
+  typedef NTSTATUS(WINAPI* RtlGetVersionPtr)(PRTL_OSVERSIONINFOW);
+  HMODULE hMod = GetModuleHandle(TEXT("ntdll.dll"));
+  if (hMod) {
+    RtlGetVersionPtr fxPtr = (RtlGetVersionPtr)GetProcAddress(hMod, "RtlGetVersion");
+    if (fxPtr) {
+      RTL_OSVERSIONINFOW rovi = { 0 };
+      rovi.dwOSVersionInfoSize = sizeof(rovi);
+      if (fxPtr(&rovi) == 0) {
+        return std::to_string(rovi.dwMajorVersion) + "." + std::to_string(rovi.dwMinorVersion) +
+               "." + std::to_string(rovi.dwBuildNumber);
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string> Win32PlatformProvider::ReadRegistryString(wchar_t const *key, wchar_t const *value) {
+  ReactNativeDeviceAiCore::ScopedSpan span(m_spans, ReactNativeDeviceAiCore::Span::RegistryRead);
+  HKEY hKey;
+  if (RegOpenKeyEx(HKEY_LOCAL_MACHINE, key, 0, KEY_READ, &hKey) == ERROR_SUCCESS) {
+    WCHAR data[256];
+    DWORD size = sizeof(data);
+
+    if (RegQueryValueEx(hKey, value, NULL, NULL, (LPBYTE)data, &size) == ERROR_SUCCESS) {
+      RegCloseKey(hKey);
+
+      // REG_SZ data is not guaranteed to be null-terminated
+      return ReactNativeDeviceAiCore::WideToUtf8({data, wcsnlen(data, size / sizeof(WCHAR))});
+    }
+
+    RegCloseKey(hKey);
+  }
+
+  span.Fail();
+  return std::nullopt;
+}
+
+std::optional<std::string> Win32PlatformProvider::ReadArchitecture() {
+  SYSTEM_INFO sysInfo;
+  GetNativeSystemInfo(&sysInfo);
+
+  switch (sysInfo.wProcessorArchitecture) {
+    case PROCESSOR_ARCHITECTURE_AMD64:
+      return "x64";
+    case PROCESSOR_ARCHITECTURE_ARM64:
+      return "ARM64";
+    case PROCESSOR_ARCHITECTURE_INTEL:
+      return "x86";
+    case PROCESSOR_ARCHITECTURE_ARM:
+      return "ARM";
+    default:
+      return std::nullopt;
+  }
+}
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "pch.h"
+
+#include <MemoryBreakdown.h>
+#include <PlatformProvider.h>
+#include <SpanRecorder.h>
+
+#include <pdh.h>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace winrt::ReactNativeDeviceAiSpecs
+{
+
+// Win32 and WinRT reads behind each collector: GetPerformanceInfo,
+// GetDiskFreeSpaceEx, PowerManager/GetSystemPowerStatus, PDH, the internet
+// connection profile, WMI, RtlGetVersion and the registry. The PDH, WMI and
+// registry calls inside a read are timed as their own spans.
+//
+// The PDH query is opened and primed when the provider is built and stays
+// open, so a read is a single collection with no settling delay. Reads within
+// kReuseWindowMs of the previous one share its PDH collection and memory
+// breakdown, so the collectors of one sampler tick see one sample and the
+// fault rates cover the whole interval between ticks. An on-demand read more
+// than kMaxCounterIntervalMs after the last collection takes a fresh pair
+// kSettleMs apart rather than averaging over the whole gap.
+class Win32PlatformProvider final : public ReactNativeDeviceAiCore::PlatformProvider {
+public:
+  static constexpr int64_t kReuseWindowMs = 200;
+  static constexpr int64_t kMaxCounterIntervalMs = 1000;
+  static constexpr DWORD kSettleMs = 100;
+
+  struct CounterSample {
+    std::optional<double> cpuUsage;
+    std::optional<double> diskUsage;
+  };
+
+  explicit Win32PlatformProvider(ReactNativeDeviceAiCore::SpanRecorder &spans) noexcept;
+  ~Win32PlatformProvider();
+
+  Win32PlatformProvider(Win32PlatformProvider const &) = delete;
+  Win32PlatformProvider &operator=(Win32PlatformProvider const &) = delete;
+
+  const char *Name() const noexcept override {
+    return "win32";
+  }
+
+  ReactNativeDeviceAiCore::MemoryReading ReadMemory() override;
+  ReactNativeDeviceAiCore::StorageReading ReadStorage() override;
+  ReactNativeDeviceAiCore::BatteryReading ReadBattery() override;
+  ReactNativeDeviceAiCore::CpuReading ReadCpu() override;
+  ReactNativeDeviceAiCore::NetworkReading ReadNetwork() override;
+  ReactNativeDeviceAiCore::CounterReading ReadPerformanceCounters() override;
+  ReactNativeDeviceAiCore::WmiReading ReadWmi() override;
+  ReactNativeDeviceAiCore::IdentityReading ReadIdentity() override;
+
+  // Full memory counters with fault rates, always read anew. Rates are derived
+  // from consecutive calls by any caller; the sampler makes one per tick.
+  std::optional<ReactNativeDeviceAiCore::MemoryBreakdown> ReadMemoryBreakdown() noexcept;
+
+  // CPU and disk time over the interval since the previous collection,
+  // unless that was within kReuseWindowMs. For the sampler, whose ticks set
+  // the interval; both are unknown when the query could not be primed.
+  CounterSample CollectCounters() noexcept;
+
+private:
+  // The last breakdown when it is recent enough, otherwise a new one
+  std::optional<ReactNativeDeviceAiCore::MemoryBreakdown> RecentMemoryBreakdown() noexcept;
+  // CollectCounters for on-demand reads, with a settled pair after a long gap
+  CounterSample RecentCounters() noexcept;
+  // The m_pdhMutex must be held for these
+  bool OpenQueryLocked() noexcept;
+  CounterSample CollectLocked(int64_t nowMs) noexcept;
+
+  std::optional<std::string> ReadOSVersion();
+  std::optional<std::string> ReadRegistryString(wchar_t const *key, wchar_t const *value);
+  std::optional<std::string> ReadArchitecture();
+
+  ReactNativeDeviceAiCore::SpanRecorder &m_spans;
+
+  std::mutex m_memoryMutex;
+  ReactNativeDeviceAiCore::FaultRateTracker m_faultRates;
+  std::optional<ReactNativeDeviceAiCore::MemoryBreakdown> m_lastBreakdown;
+  int64_t m_lastBreakdownMs = 0;
+
+  std::mutex m_pdhMutex;
+  PDH_HQUERY m_pdhQuery = nullptr;
+  PDH_HCOUNTER m_cpuCounter = nullptr;
+  PDH_HCOUNTER m_diskCounter = nullptr;
+  CounterSample m_lastCounters;
+  // 0 until the query has been collected
+  int64_t m_lastCountersMs = 0;
+};
+
+} // namespace winrt::ReactNativeDeviceAiSpecs
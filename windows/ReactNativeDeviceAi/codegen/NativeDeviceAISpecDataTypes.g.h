@@ -17,34 +17,49 @@
 namespace ReactNativeDeviceAiCodegen {
 
 struct DeviceAISpecSpec_getDeviceInfo_returnType_memory {
-    double total;
-    double available;
+    std::optional<double> total;
+    std::optional<double> available;
+    std::string state;
+    bool stale;
+    std::optional<double> ageMs;
 };
 
 struct DeviceAISpecSpec_getDeviceInfo_returnType_storage {
-    double total;
-    double available;
+    std::optional<double> total;
+    std::optional<double> available;
+    std::string state;
+    bool stale;
+    std::optional<double> ageMs;
 };
 
 struct DeviceAISpecSpec_getDeviceInfo_returnType_battery {
-    double level;
-    bool isCharging;
+    std::optional<double> level;
+    std::optional<bool> isCharging;
+    std::string state;
+    bool stale;
+    std::optional<double> ageMs;
 };
 
 struct DeviceAISpecSpec_getDeviceInfo_returnType_cpu {
-    double usage;
-    double cores;
+    std::optional<double> usage;
+    std::optional<double> cores;
+    std::string state;
+    bool stale;
+    std::optional<double> ageMs;
 };
 
 struct DeviceAISpecSpec_getDeviceInfo_returnType_network {
-    std::string type;
-    bool isConnected;
+    std::optional<std::string> type;
+    std::optional<bool> isConnected;
+    std::string state;
+    bool stale;
+    std::optional<double> ageMs;
 };
 
 struct DeviceAISpecSpec_getDeviceInfo_returnType {
     std::string platform;
-    std::string osVersion;
-    std::string deviceModel;
+    std::optional<std::string> osVersion;
+    std::optional<std::string> deviceModel;
     DeviceAISpecSpec_getDeviceInfo_returnType_memory memory;
     DeviceAISpecSpec_getDeviceInfo_returnType_storage storage;
     DeviceAISpecSpec_getDeviceInfo_returnType_battery battery;
@@ -53,24 +68,130 @@ struct DeviceAISpecSpec_getDeviceInfo_returnType {
 };
 
 struct DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters {
-    double cpuUsage;
-    double memoryUsage;
-    double diskUsage;
+    std::optional<double> cpuUsage;
+    std::optional<double> memoryUsage;
+    std::optional<double> diskUsage;
+    std::string state;
+    bool stale;
+    std::optional<double> ageMs;
 };
 
 struct DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData {
-    std::string computerSystem;
-    std::string operatingSystem;
-    std::string processor;
+    std::optional<std::string> computerSystem;
+    std::optional<std::string> operatingSystem;
+    std::optional<std::string> processor;
+    std::string state;
+    bool stale;
+    std::optional<double> ageMs;
 };
 
 struct DeviceAISpecSpec_getWindowsSystemInfo_returnType {
-    std::string osVersion;
-    std::string buildNumber;
-    std::string processor;
-    std::string architecture;
+    std::optional<std::string> osVersion;
+    std::optional<std::string> buildNumber;
+    std::optional<std::string> processor;
+    std::optional<std::string> architecture;
     DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters performanceCounters;
     DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData wmiData;
 };
 
+struct DeviceAISpecSpec_getSamplerDiagnostics_returnType {
+    bool running;
+    std::string policy;
+    double intervalMs;
+    double tolerableDelayMs;
+    double wakeupsPerMinute;
+    double totalWakeups;
+    double volatility;
+    std::string powerSource;
+    bool energySaver;
+    bool foreground;
+};
+
+struct DeviceAISpecSpec_getMemoryBreakdown_returnType {
+    double total;
+    double available;
+    double commitTotal;
+    double commitLimit;
+    double commitPeak;
+    double commitUsage;
+    double systemCache;
+    double kernelPaged;
+    double kernelNonpaged;
+    std::optional<double> standby;
+    std::optional<double> modified;
+    double pageFaultsPerSec;
+    double hardFaultsPerSec;
+};
+
+struct DeviceAISpecSpec_ProcessTrend {
+    std::string verdict;
+    double slopePerHour;
+    double monotonicFraction;
+    double samples;
+};
+
+struct DeviceAISpecSpec_getProcessProfile_returnType_trends {
+    DeviceAISpecSpec_ProcessTrend privateBytes;
+    DeviceAISpecSpec_ProcessTrend workingSet;
+    DeviceAISpecSpec_ProcessTrend handleCount;
+    DeviceAISpecSpec_ProcessTrend threadCount;
+};
+
+struct DeviceAISpecSpec_getProcessProfile_returnType {
+    double privateBytes;
+    double workingSet;
+    double peakWorkingSet;
+    double handleCount;
+    double threadCount;
+    double pageFaultsPerSec;
+    DeviceAISpecSpec_getProcessProfile_returnType_trends trends;
+};
+
+struct DeviceAISpecSpec_CollectOptions {
+    std::optional<double> budgetMs;
+};
+
+struct DeviceAISpecSpec_CollectorStats {
+    double runs;
+    double failures;
+    double timeouts;
+    double skipped;
+    double lastDurationMs;
+    std::string breaker;
+    double consecutiveFailures;
+    double breakerOpens;
+    std::optional<double> retryInMs;
+};
+
+struct DeviceAISpecSpec_getCollectorStats_returnType {
+    DeviceAISpecSpec_CollectorStats memory;
+    DeviceAISpecSpec_CollectorStats storage;
+    DeviceAISpecSpec_CollectorStats battery;
+    DeviceAISpecSpec_CollectorStats cpu;
+    DeviceAISpecSpec_CollectorStats network;
+    DeviceAISpecSpec_CollectorStats performanceCounters;
+    DeviceAISpecSpec_CollectorStats wmi;
+};
+
+struct DeviceAISpecSpec_FieldStats {
+    std::string field;
+    std::optional<std::string> source;
+    std::optional<double> lastGoodAgeMs;
+    double live;
+    double lastKnown;
+    double unknown;
+};
+
+struct DeviceAISpecSpec_SpanDiagnostics {
+    std::string name;
+    double calls;
+    double failures;
+    double fallbacks;
+    double p50Ms;
+    double p90Ms;
+    double p99Ms;
+    double maxMs;
+    double meanMs;
+};
+
 } // namespace ReactNativeDeviceAiCodegen
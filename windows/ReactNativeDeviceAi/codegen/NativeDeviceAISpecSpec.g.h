@@ -19,6 +19,9 @@ inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_ge
     winrt::Microsoft::ReactNative::FieldMap fieldMap {
         {L"total", &DeviceAISpecSpec_getDeviceInfo_returnType_memory::total},
         {L"available", &DeviceAISpecSpec_getDeviceInfo_returnType_memory::available},
+        {L"state", &DeviceAISpecSpec_getDeviceInfo_returnType_memory::state},
+        {L"stale", &DeviceAISpecSpec_getDeviceInfo_returnType_memory::stale},
+        {L"ageMs", &DeviceAISpecSpec_getDeviceInfo_returnType_memory::ageMs},
     };
     return fieldMap;
 }
@@ -27,6 +30,9 @@ inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_ge
     winrt::Microsoft::ReactNative::FieldMap fieldMap {
         {L"total", &DeviceAISpecSpec_getDeviceInfo_returnType_storage::total},
         {L"available", &DeviceAISpecSpec_getDeviceInfo_returnType_storage::available},
+        {L"state", &DeviceAISpecSpec_getDeviceInfo_returnType_storage::state},
+        {L"stale", &DeviceAISpecSpec_getDeviceInfo_returnType_storage::stale},
+        {L"ageMs", &DeviceAISpecSpec_getDeviceInfo_returnType_storage::ageMs},
     };
     return fieldMap;
 }
@@ -35,6 +41,9 @@ inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_ge
     winrt::Microsoft::ReactNative::FieldMap fieldMap {
         {L"level", &DeviceAISpecSpec_getDeviceInfo_returnType_battery::level},
         {L"isCharging", &DeviceAISpecSpec_getDeviceInfo_returnType_battery::isCharging},
+        {L"state", &DeviceAISpecSpec_getDeviceInfo_returnType_battery::state},
+        {L"stale", &DeviceAISpecSpec_getDeviceInfo_returnType_battery::stale},
+        {L"ageMs", &DeviceAISpecSpec_getDeviceInfo_returnType_battery::ageMs},
     };
     return fieldMap;
 }
@@ -43,6 +52,9 @@ inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_ge
     winrt::Microsoft::ReactNative::FieldMap fieldMap {
         {L"usage", &DeviceAISpecSpec_getDeviceInfo_returnType_cpu::usage},
         {L"cores", &DeviceAISpecSpec_getDeviceInfo_returnType_cpu::cores},
+        {L"state", &DeviceAISpecSpec_getDeviceInfo_returnType_cpu::state},
+        {L"stale", &DeviceAISpecSpec_getDeviceInfo_returnType_cpu::stale},
+        {L"ageMs", &DeviceAISpecSpec_getDeviceInfo_returnType_cpu::ageMs},
     };
     return fieldMap;
 }
@@ -51,6 +63,9 @@ inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_ge
     winrt::Microsoft::ReactNative::FieldMap fieldMap {
         {L"type", &DeviceAISpecSpec_getDeviceInfo_returnType_network::type},
         {L"isConnected", &DeviceAISpecSpec_getDeviceInfo_returnType_network::isConnected},
+        {L"state", &DeviceAISpecSpec_getDeviceInfo_returnType_network::state},
+        {L"stale", &DeviceAISpecSpec_getDeviceInfo_returnType_network::stale},
+        {L"ageMs", &DeviceAISpecSpec_getDeviceInfo_returnType_network::ageMs},
     };
     return fieldMap;
 }
@@ -74,6 +89,9 @@ inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_ge
         {L"cpuUsage", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters::cpuUsage},
         {L"memoryUsage", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters::memoryUsage},
         {L"diskUsage", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters::diskUsage},
+        {L"state", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters::state},
+        {L"stale", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters::stale},
+        {L"ageMs", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_performanceCounters::ageMs},
     };
     return fieldMap;
 }
@@ -83,6 +101,9 @@ inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_ge
         {L"computerSystem", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData::computerSystem},
         {L"operatingSystem", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData::operatingSystem},
         {L"processor", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData::processor},
+        {L"state", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData::state},
+        {L"stale", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData::stale},
+        {L"ageMs", &DeviceAISpecSpec_getWindowsSystemInfo_returnType_wmiData::ageMs},
     };
     return fieldMap;
 }
@@ -99,12 +120,157 @@ inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_ge
     return fieldMap;
 }
 
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_getSamplerDiagnostics_returnType*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"running", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::running},
+        {L"policy", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::policy},
+        {L"intervalMs", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::intervalMs},
+        {L"tolerableDelayMs", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::tolerableDelayMs},
+        {L"wakeupsPerMinute", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::wakeupsPerMinute},
+        {L"totalWakeups", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::totalWakeups},
+        {L"volatility", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::volatility},
+        {L"powerSource", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::powerSource},
+        {L"energySaver", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::energySaver},
+        {L"foreground", &DeviceAISpecSpec_getSamplerDiagnostics_returnType::foreground},
+    };
+    return fieldMap;
+}
+
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_getMemoryBreakdown_returnType*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"total", &DeviceAISpecSpec_getMemoryBreakdown_returnType::total},
+        {L"available", &DeviceAISpecSpec_getMemoryBreakdown_returnType::available},
+        {L"commitTotal", &DeviceAISpecSpec_getMemoryBreakdown_returnType::commitTotal},
+        {L"commitLimit", &DeviceAISpecSpec_getMemoryBreakdown_returnType::commitLimit},
+        {L"commitPeak", &DeviceAISpecSpec_getMemoryBreakdown_returnType::commitPeak},
+        {L"commitUsage", &DeviceAISpecSpec_getMemoryBreakdown_returnType::commitUsage},
+        {L"systemCache", &DeviceAISpecSpec_getMemoryBreakdown_returnType::systemCache},
+        {L"kernelPaged", &DeviceAISpecSpec_getMemoryBreakdown_returnType::kernelPaged},
+        {L"kernelNonpaged", &DeviceAISpecSpec_getMemoryBreakdown_returnType::kernelNonpaged},
+        {L"standby", &DeviceAISpecSpec_getMemoryBreakdown_returnType::standby},
+        {L"modified", &DeviceAISpecSpec_getMemoryBreakdown_returnType::modified},
+        {L"pageFaultsPerSec", &DeviceAISpecSpec_getMemoryBreakdown_returnType::pageFaultsPerSec},
+        {L"hardFaultsPerSec", &DeviceAISpecSpec_getMemoryBreakdown_returnType::hardFaultsPerSec},
+    };
+    return fieldMap;
+}
+
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_ProcessTrend*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"verdict", &DeviceAISpecSpec_ProcessTrend::verdict},
+        {L"slopePerHour", &DeviceAISpecSpec_ProcessTrend::slopePerHour},
+        {L"monotonicFraction", &DeviceAISpecSpec_ProcessTrend::monotonicFraction},
+        {L"samples", &DeviceAISpecSpec_ProcessTrend::samples},
+    };
+    return fieldMap;
+}
+
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_getProcessProfile_returnType_trends*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"privateBytes", &DeviceAISpecSpec_getProcessProfile_returnType_trends::privateBytes},
+        {L"workingSet", &DeviceAISpecSpec_getProcessProfile_returnType_trends::workingSet},
+        {L"handleCount", &DeviceAISpecSpec_getProcessProfile_returnType_trends::handleCount},
+        {L"threadCount", &DeviceAISpecSpec_getProcessProfile_returnType_trends::threadCount},
+    };
+    return fieldMap;
+}
+
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_getProcessProfile_returnType*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"privateBytes", &DeviceAISpecSpec_getProcessProfile_returnType::privateBytes},
+        {L"workingSet", &DeviceAISpecSpec_getProcessProfile_returnType::workingSet},
+        {L"peakWorkingSet", &DeviceAISpecSpec_getProcessProfile_returnType::peakWorkingSet},
+        {L"handleCount", &DeviceAISpecSpec_getProcessProfile_returnType::handleCount},
+        {L"threadCount", &DeviceAISpecSpec_getProcessProfile_returnType::threadCount},
+        {L"pageFaultsPerSec", &DeviceAISpecSpec_getProcessProfile_returnType::pageFaultsPerSec},
+        {L"trends", &DeviceAISpecSpec_getProcessProfile_returnType::trends},
+    };
+    return fieldMap;
+}
+
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_CollectOptions*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"budgetMs", &DeviceAISpecSpec_CollectOptions::budgetMs},
+    };
+    return fieldMap;
+}
+
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_CollectorStats*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"runs", &DeviceAISpecSpec_CollectorStats::runs},
+        {L"failures", &DeviceAISpecSpec_CollectorStats::failures},
+        {L"timeouts", &DeviceAISpecSpec_CollectorStats::timeouts},
+        {L"skipped", &DeviceAISpecSpec_CollectorStats::skipped},
+        {L"lastDurationMs", &DeviceAISpecSpec_CollectorStats::lastDurationMs},
+        {L"breaker", &DeviceAISpecSpec_CollectorStats::breaker},
+        {L"consecutiveFailures", &DeviceAISpecSpec_CollectorStats::consecutiveFailures},
+        {L"breakerOpens", &DeviceAISpecSpec_CollectorStats::breakerOpens},
+        {L"retryInMs", &DeviceAISpecSpec_CollectorStats::retryInMs},
+    };
+    return fieldMap;
+}
+
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_getCollectorStats_returnType*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"memory", &DeviceAISpecSpec_getCollectorStats_returnType::memory},
+        {L"storage", &DeviceAISpecSpec_getCollectorStats_returnType::storage},
+        {L"battery", &DeviceAISpecSpec_getCollectorStats_returnType::battery},
+        {L"cpu", &DeviceAISpecSpec_getCollectorStats_returnType::cpu},
+        {L"network", &DeviceAISpecSpec_getCollectorStats_returnType::network},
+        {L"performanceCounters", &DeviceAISpecSpec_getCollectorStats_returnType::performanceCounters},
+        {L"wmi", &DeviceAISpecSpec_getCollectorStats_returnType::wmi},
+    };
+    return fieldMap;
+}
+
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_FieldStats*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"field", &DeviceAISpecSpec_FieldStats::field},
+        {L"source", &DeviceAISpecSpec_FieldStats::source},
+        {L"lastGoodAgeMs", &DeviceAISpecSpec_FieldStats::lastGoodAgeMs},
+        {L"live", &DeviceAISpecSpec_FieldStats::live},
+        {L"lastKnown", &DeviceAISpecSpec_FieldStats::lastKnown},
+        {L"unknown", &DeviceAISpecSpec_FieldStats::unknown},
+    };
+    return fieldMap;
+}
+
+inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(DeviceAISpecSpec_SpanDiagnostics*) noexcept {
+    winrt::Microsoft::ReactNative::FieldMap fieldMap {
+        {L"name", &DeviceAISpecSpec_SpanDiagnostics::name},
+        {L"calls", &DeviceAISpecSpec_SpanDiagnostics::calls},
+        {L"failures", &DeviceAISpecSpec_SpanDiagnostics::failures},
+        {L"fallbacks", &DeviceAISpecSpec_SpanDiagnostics::fallbacks},
+        {L"p50Ms", &DeviceAISpecSpec_SpanDiagnostics::p50Ms},
+        {L"p90Ms", &DeviceAISpecSpec_SpanDiagnostics::p90Ms},
+        {L"p99Ms", &DeviceAISpecSpec_SpanDiagnostics::p99Ms},
+        {L"maxMs", &DeviceAISpecSpec_SpanDiagnostics::maxMs},
+        {L"meanMs", &DeviceAISpecSpec_SpanDiagnostics::meanMs},
+    };
+    return fieldMap;
+}
+
 struct DeviceAISpecSpec : winrt::Microsoft::ReactNative::TurboModuleSpec {
   static constexpr auto methods = std::tuple{
-      Method<void(Promise<DeviceAISpecSpec_getDeviceInfo_returnType>) noexcept>{0, L"getDeviceInfo"},
-      Method<void(Promise<DeviceAISpecSpec_getWindowsSystemInfo_returnType>) noexcept>{1, L"getWindowsSystemInfo"},
+      Method<void(std::optional<DeviceAISpecSpec_CollectOptions>, Promise<DeviceAISpecSpec_getDeviceInfo_returnType>) noexcept>{0, L"getDeviceInfo"},
+      Method<void(std::optional<DeviceAISpecSpec_CollectOptions>, Promise<DeviceAISpecSpec_getWindowsSystemInfo_returnType>) noexcept>{1, L"getWindowsSystemInfo"},
       SyncMethod<bool() noexcept>{2, L"isNativeModuleAvailable"},
       SyncMethod<std::vector<std::string>() noexcept>{3, L"getSupportedFeatures"},
+      Method<void() noexcept>{4, L"startSampling"},
+      Method<void() noexcept>{5, L"stopSampling"},
+      Method<void(bool) noexcept>{6, L"setAppForeground"},
+      SyncMethod<DeviceAISpecSpec_getSamplerDiagnostics_returnType() noexcept>{7, L"getSamplerDiagnostics"},
+      Method<void(Promise<DeviceAISpecSpec_getMemoryBreakdown_returnType>) noexcept>{8, L"getMemoryBreakdown"},
+      Method<void() noexcept>{9, L"startMemoryMonitoring"},
+      Method<void() noexcept>{10, L"stopMemoryMonitoring"},
+      Method<void(Promise<DeviceAISpecSpec_getProcessProfile_returnType>) noexcept>{11, L"getProcessProfile"},
+      Method<void(double) noexcept>{12, L"setCoalescingWindow"},
+      SyncMethod<DeviceAISpecSpec_getCollectorStats_returnType() noexcept>{13, L"getCollectorStats"},
+      SyncMethod<std::vector<DeviceAISpecSpec_FieldStats>() noexcept>{14, L"getFallbackStats"},
+      SyncMethod<std::vector<DeviceAISpecSpec_SpanDiagnostics>() noexcept>{15, L"getDiagnostics"},
+      Method<void(bool) noexcept>{16, L"setTracingEnabled"},
+      Method<void(Promise<std::string>) noexcept>{17, L"getTraceEvents"},
+      Method<void(std::string, Promise<std::string>) noexcept>{18, L"writeTraceFile"},
   };
 
   template <class TModule>
@@ -114,13 +280,13 @@ struct DeviceAISpecSpec : winrt::Microsoft::ReactNative::TurboModuleSpec {
     REACT_SHOW_METHOD_SPEC_ERRORS(
           0,
           "getDeviceInfo",
-          "    REACT_METHOD(getDeviceInfo) void getDeviceInfo(::React::ReactPromise<DeviceAISpecSpec_getDeviceInfo_returnType> &&result) noexcept { /* implementation */ }\n"
-          "    REACT_METHOD(getDeviceInfo) static void getDeviceInfo(::React::ReactPromise<DeviceAISpecSpec_getDeviceInfo_returnType> &&result) noexcept { /* implementation */ }\n");
+          "    REACT_METHOD(getDeviceInfo) void getDeviceInfo(std::optional<DeviceAISpecSpec_CollectOptions> options, ::React::ReactPromise<DeviceAISpecSpec_getDeviceInfo_returnType> &&result) noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(getDeviceInfo) static void getDeviceInfo(std::optional<DeviceAISpecSpec_CollectOptions> options, ::React::ReactPromise<DeviceAISpecSpec_getDeviceInfo_returnType> &&result) noexcept { /* implementation */ }\n");
     REACT_SHOW_METHOD_SPEC_ERRORS(
           1,
           "getWindowsSystemInfo",
-          "    REACT_METHOD(getWindowsSystemInfo) void getWindowsSystemInfo(::React::ReactPromise<DeviceAISpecSpec_getWindowsSystemInfo_returnType> &&result) noexcept { /* implementation */ }\n"
-          "    REACT_METHOD(getWindowsSystemInfo) static void getWindowsSystemInfo(::React::ReactPromise<DeviceAISpecSpec_getWindowsSystemInfo_returnType> &&result) noexcept { /* implementation */ }\n");
+          "    REACT_METHOD(getWindowsSystemInfo) void getWindowsSystemInfo(std::optional<DeviceAISpecSpec_CollectOptions> options, ::React::ReactPromise<DeviceAISpecSpec_getWindowsSystemInfo_returnType> &&result) noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(getWindowsSystemInfo) static void getWindowsSystemInfo(std::optional<DeviceAISpecSpec_CollectOptions> options, ::React::ReactPromise<DeviceAISpecSpec_getWindowsSystemInfo_returnType> &&result) noexcept { /* implementation */ }\n");
     REACT_SHOW_METHOD_SPEC_ERRORS(
           2,
           "isNativeModuleAvailable",
@@ -131,6 +297,81 @@ struct DeviceAISpecSpec : winrt::Microsoft::ReactNative::TurboModuleSpec {
           "getSupportedFeatures",
           "    REACT_SYNC_METHOD(getSupportedFeatures) std::vector<std::string> getSupportedFeatures() noexcept { /* implementation */ }\n"
           "    REACT_SYNC_METHOD(getSupportedFeatures) static std::vector<std::string> getSupportedFeatures() noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          4,
+          "startSampling",
+          "    REACT_METHOD(startSampling) void startSampling() noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(startSampling) static void startSampling() noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          5,
+          "stopSampling",
+          "    REACT_METHOD(stopSampling) void stopSampling() noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(stopSampling) static void stopSampling() noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          6,
+          "setAppForeground",
+          "    REACT_METHOD(setAppForeground) void setAppForeground(bool foreground) noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(setAppForeground) static void setAppForeground(bool foreground) noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          7,
+          "getSamplerDiagnostics",
+          "    REACT_SYNC_METHOD(getSamplerDiagnostics) DeviceAISpecSpec_getSamplerDiagnostics_returnType getSamplerDiagnostics() noexcept { /* implementation */ }\n"
+          "    REACT_SYNC_METHOD(getSamplerDiagnostics) static DeviceAISpecSpec_getSamplerDiagnostics_returnType getSamplerDiagnostics() noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          8,
+          "getMemoryBreakdown",
+          "    REACT_METHOD(getMemoryBreakdown) void getMemoryBreakdown(::React::ReactPromise<DeviceAISpecSpec_getMemoryBreakdown_returnType> &&result) noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(getMemoryBreakdown) static void getMemoryBreakdown(::React::ReactPromise<DeviceAISpecSpec_getMemoryBreakdown_returnType> &&result) noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          9,
+          "startMemoryMonitoring",
+          "    REACT_METHOD(startMemoryMonitoring) void startMemoryMonitoring() noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(startMemoryMonitoring) static void startMemoryMonitoring() noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          10,
+          "stopMemoryMonitoring",
+          "    REACT_METHOD(stopMemoryMonitoring) void stopMemoryMonitoring() noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(stopMemoryMonitoring) static void stopMemoryMonitoring() noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          11,
+          "getProcessProfile",
+          "    REACT_METHOD(getProcessProfile) void getProcessProfile(::React::ReactPromise<DeviceAISpecSpec_getProcessProfile_returnType> &&result) noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(getProcessProfile) static void getProcessProfile(::React::ReactPromise<DeviceAISpecSpec_getProcessProfile_returnType> &&result) noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          12,
+          "setCoalescingWindow",
+          "    REACT_METHOD(setCoalescingWindow) void setCoalescingWindow(double windowMs) noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(setCoalescingWindow) static void setCoalescingWindow(double windowMs) noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          13,
+          "getCollectorStats",
+          "    REACT_SYNC_METHOD(getCollectorStats) DeviceAISpecSpec_getCollectorStats_returnType getCollectorStats() noexcept { /* implementation */ }\n"
+          "    REACT_SYNC_METHOD(getCollectorStats) static DeviceAISpecSpec_getCollectorStats_returnType getCollectorStats() noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          14,
+          "getFallbackStats",
+          "    REACT_SYNC_METHOD(getFallbackStats) std::vector<DeviceAISpecSpec_FieldStats> getFallbackStats() noexcept { /* implementation */ }\n"
+          "    REACT_SYNC_METHOD(getFallbackStats) static std::vector<DeviceAISpecSpec_FieldStats> getFallbackStats() noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          15,
+          "getDiagnostics",
+          "    REACT_SYNC_METHOD(getDiagnostics) std::vector<DeviceAISpecSpec_SpanDiagnostics> getDiagnostics() noexcept { /* implementation */ }\n"
+          "    REACT_SYNC_METHOD(getDiagnostics) static std::vector<DeviceAISpecSpec_SpanDiagnostics> getDiagnostics() noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          16,
+          "setTracingEnabled",
+          "    REACT_METHOD(setTracingEnabled) void setTracingEnabled(bool enabled) noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(setTracingEnabled) static void setTracingEnabled(bool enabled) noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          17,
+          "getTraceEvents",
+          "    REACT_METHOD(getTraceEvents) void getTraceEvents(::React::ReactPromise<std::string> &&result) noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(getTraceEvents) static void getTraceEvents(::React::ReactPromise<std::string> &&result) noexcept { /* implementation */ }\n");
+    REACT_SHOW_METHOD_SPEC_ERRORS(
+          18,
+          "writeTraceFile",
+          "    REACT_METHOD(writeTraceFile) void writeTraceFile(std::string path, ::React::ReactPromise<std::string> &&result) noexcept { /* implementation */ }\n"
+          "    REACT_METHOD(writeTraceFile) static void writeTraceFile(std::string path, ::React::ReactPromise<std::string> &&result) noexcept { /* implementation */ }\n");
   }
 };
 